@@ -0,0 +1,326 @@
+#include "Benchmark.h"
+#include "DynamicResolution.h"
+#include "FrameCapture.h"
+#include "FrameGraph.h"
+#include "GLCapabilities.h"
+#include "GLTrace.h"
+#include "JobSystem.h"
+#include "MeshImport.h"
+#include "RenderTargetPool.h"
+#include "ShaderBatch.h"
+#include "ShaderLibrary.h"
+#include "SoftRasterizer.h"
+#include "TextureCompressor.h"
+#include "TextureUpload.h"
+#include "VecMath.h"
+#include "VertexFormat.h"
+#include "stb_image.h"
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cmath>
+
+struct BenchmarkEntry
+{
+	const char* name;
+	const char* description;
+	void (*run)();
+	bool needsContext;
+};
+
+// set by checks that found a mismatch, so --bench exits with an error
+static bool benchmarkFailed = false;
+
+// largest per-channel difference allowed between GL and the software rasterizer;
+// both filter with 8-bit weights, llvmpipe stays within 3
+static const int rasterCheckTolerance = 4;
+
+static void rasterCheck() {
+	if (!runSoftRasterizerCheck(rasterCheckTolerance))
+		benchmarkFailed = true;
+}
+
+static void compressionBenchmark() {
+	runCompressionBenchmark("container.jpg");
+	runCompressionBenchmark("taylor.jpg");
+}
+
+// Best of several runs, in nanoseconds per item
+template <typename F>
+static double timePerItem(size_t items, F&& work) {
+	double best = 1e30;
+	for (int run = 0; run < 10; run++) {
+		auto start = std::chrono::high_resolution_clock::now();
+		work();
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+		best = std::min(best, elapsed.count());
+	}
+	return best / items;
+}
+
+static void mathBenchmark() {
+	const size_t count = 10000;
+	std::vector<mat4> parents(count), locals(count), out(count);
+	std::vector<float> xs(count), ys(count), zs(count), ox(count), oy(count), oz(count);
+	for (size_t i = 0; i < count; i++) {
+		float f = (float)i;
+		parents[i] = composeTRS(vec3(f, 1, 2), angleAxis(f * 0.01f, vec3(0, 1, 0)), vec3(1.5f));
+		locals[i] = composeTRS(vec3(0, f, 0), angleAxis(f * 0.02f, vec3(1, 0, 0)), vec3(0.5f));
+		xs[i] = f; ys[i] = -f; zs[i] = f * 0.5f;
+	}
+	float checksum = 0.0f;
+
+	double scalarMul = timePerItem(count, [&] {
+		for (size_t i = 0; i < count; i++)
+			out[i] = mulScalar(parents[i], locals[i]);
+		checksum += out[count / 2].cols[3].x;
+	});
+	double simdMul = timePerItem(count, [&] {
+		mulBatch(parents.data(), locals.data(), out.data(), count);
+		checksum += out[count / 2].cols[3].x;
+	});
+
+	const mat4& m = parents[1];
+	double scalarPoints = timePerItem(count, [&] {
+		for (size_t i = 0; i < count; i++) {
+			ox[i] = m.cols[0].x * xs[i] + m.cols[1].x * ys[i] + m.cols[2].x * zs[i] + m.cols[3].x;
+			oy[i] = m.cols[0].y * xs[i] + m.cols[1].y * ys[i] + m.cols[2].y * zs[i] + m.cols[3].y;
+			oz[i] = m.cols[0].z * xs[i] + m.cols[1].z * ys[i] + m.cols[2].z * zs[i] + m.cols[3].z;
+		}
+		checksum += ox[count / 2];
+	});
+	double simdPoints = timePerItem(count, [&] {
+		transformPointsSoA(m, xs.data(), ys.data(), zs.data(), ox.data(), oy.data(), oz.data(), count);
+		checksum += ox[count / 2];
+	});
+
+	std::cout << std::fixed << std::setprecision(2)
+		<< "mat4 * mat4       scalar " << scalarMul << " ns   simd " << simdMul << " ns\n"
+		<< "transform point   scalar " << scalarPoints << " ns   simd " << simdPoints << " ns\n"
+		<< "(checksum " << checksum << ")\n";
+}
+
+// Iterations of z = z^2 + c for one pixel of a 512x512 view of the Mandelbrot set;
+// cost varies a lot between rows, which is what stealing has to even out
+static int mandelbrotRow(int y, int size) {
+	int total = 0;
+	for (int x = 0; x < size; x++) {
+		float cr = -2.0f + 2.5f * x / size, ci = -1.25f + 2.5f * y / size;
+		float zr = 0.0f, zi = 0.0f;
+		int i = 0;
+		for (; i < 256 && zr * zr + zi * zi < 4.0f; i++) {
+			float t = zr * zr - zi * zi + cr;
+			zi = 2.0f * zr * zi + ci;
+			zr = t;
+		}
+		total += i;
+	}
+	return total;
+}
+
+static void jobBenchmark() {
+	int maxThreads = (int)std::max(1u, std::thread::hardware_concurrency());
+	std::vector<int> threadCounts;
+	for (int t = 1; t < maxThreads; t *= 2)
+		threadCounts.push_back(t);
+	threadCounts.push_back(maxThreads);
+
+	const int batch = 4000;			// flat jobs per wait, below the deque capacity
+	const int fanOutDepth = 15;		// binary spawn tree, 2^16 - 2 jobs
+	const size_t fanOutJobs = ((size_t)2 << fanOutDepth) - 2;
+	const int rows = 512;
+	const int decodes = 16;
+
+	double computeBase = 0.0, decodeBase = 0.0;
+	long long checksum = 0;
+	std::cout << "threads  empty job  fan-out job  mandelbrot          16x stb decode\n";
+	for (int threads : threadCounts) {
+		JobSystem jobs(threads);
+
+		double flat = timePerItem(batch, [&] {
+			JobCounter counter;
+			for (int i = 0; i < batch; i++)
+				jobs.run([] {}, &counter);
+			jobs.wait(counter);
+		});
+
+		double fanOut = timePerItem(fanOutJobs, [&] {
+			JobCounter counter;
+			std::function<void(int)> spawn = [&](int depth) {
+				if (depth < 0)
+					return;
+				jobs.run([&spawn, depth] { spawn(depth - 1); }, &counter);
+				jobs.run([&spawn, depth] { spawn(depth - 1); }, &counter);
+			};
+			spawn(fanOutDepth - 1);
+			jobs.wait(counter);
+		});
+
+		std::vector<int> iterations(rows);
+		double compute = timePerItem(1, [&] {
+			jobs.parallelFor(rows, 4, [&](size_t first, size_t last) {
+				for (size_t y = first; y < last; y++)
+					iterations[y] = mandelbrotRow((int)y, rows);
+			});
+			checksum += iterations[rows / 2];
+		}) * 1e-6;
+
+		// stb_image decodes as independent jobs, as the texture loader does
+		double decode = timePerItem(1, [&] {
+			JobCounter counter;
+			for (int i = 0; i < decodes; i++) {
+				jobs.run([] {
+					int width, height, channels;
+					unsigned char* data = loadImageForUpload("container.jpg", &width, &height, &channels);
+					if (data)
+						stbi_image_free(data);
+				}, &counter);
+			}
+			jobs.wait(counter);
+		}) * 1e-6;
+
+		if (threads == 1) {
+			computeBase = compute;
+			decodeBase = decode;
+		}
+		std::cout << std::fixed << std::setprecision(1)
+			<< std::setw(7) << threads
+			<< std::setw(8) << flat << " ns"
+			<< std::setw(10) << fanOut << " ns"
+			<< std::setw(10) << compute << " ms (" << std::setprecision(2) << computeBase / compute << "x)"
+			<< std::setprecision(1) << std::setw(10) << decode << " ms (" << std::setprecision(2) << decodeBase / decode << "x)\n";
+	}
+	std::cout << "(checksum " << checksum << ")\n";
+}
+
+// Startup cost of resolving every entry point up front against on first call, and
+// extension lookups through glad's hash set against the linear strcmp scan it replaced
+static void loaderBenchmark() {
+	GLADloadproc load = (GLADloadproc)glfwGetProcAddress;
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << ", GL " << GLVersion.major << "." << GLVersion.minor << "\n";
+
+	double eagerUs = timePerItem(1, [&]() { gladLoadGLLoader(load); }) / 1000.0;
+	double lazyUs = timePerItem(1, [&]() { gladLoadGLLoaderLazy(load); }) / 1000.0;
+	std::cout << "gladLoadGLLoader      " << std::setw(10) << eagerUs << " us\n";
+	std::cout << "gladLoadGLLoaderLazy  " << std::setw(10) << lazyUs << " us\n";
+
+	// what the lazy load defers: the first call of each function resolves it
+	GLint value = 0;
+	auto start = std::chrono::high_resolution_clock::now();
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &value);
+	double firstNs = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count();
+	double lazyCallNs = timePerItem(1000, [&]() {
+		for (int i = 0; i < 1000; i++)
+			glGetIntegerv(GL_MAX_TEXTURE_SIZE, &value);
+	});
+	gladLoadGLLoader(load);
+	double eagerCallNs = timePerItem(1000, [&]() {
+		for (int i = 0; i < 1000; i++)
+			glGetIntegerv(GL_MAX_TEXTURE_SIZE, &value);
+	});
+	std::cout << "glGetIntegerv         first call " << firstNs << " ns, then " << lazyCallNs
+		<< " ns (eager " << eagerCallNs << " ns)\n";
+
+	std::vector<std::string> names;
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; i++)
+		names.push_back((const char*)glGetStringi(GL_EXTENSIONS, i));
+	std::vector<std::string> queries = names;
+	for (int i = 0; i < 16; i++)
+		queries.push_back("GL_VENDOR_missing_extension_" + std::to_string(i));
+	int found = 0;
+	double linearNs = timePerItem(queries.size(), [&]() {
+		for (const std::string& query : queries) {
+			for (const std::string& name : names) {
+				if (strcmp(name.c_str(), query.c_str()) == 0) {
+					found++;
+					break;
+				}
+			}
+		}
+	});
+	double hashedNs = timePerItem(queries.size(), [&]() {
+		for (const std::string& query : queries)
+			found += gladHasExtension(query.c_str());
+	});
+	std::cout << count << " extensions, lookup: linear scan " << linearNs << " ns, hash set " << hashedNs << " ns"
+		<< (found < 0 ? " " : "") << "\n";
+
+	std::cout << "optional: buffer_storage " << GLAD_GL_ARB_buffer_storage
+		<< ", multi_draw_indirect " << GLAD_GL_ARB_multi_draw_indirect
+		<< ", debug_output " << GLAD_GL_ARB_debug_output
+		<< ", timer_query " << GLAD_GL_ARB_timer_query
+		<< ", get_program_binary " << GLAD_GL_ARB_get_program_binary << "\n";
+}
+
+static const BenchmarkEntry benchmarks[] = {
+	{ "compress", "BC1/BC3/BC4/BC5 encoder quality (PSNR) and throughput", compressionBenchmark, false },
+	{ "math", "SIMD mat4 products and SoA point transforms against scalar code", mathBenchmark, false },
+	{ "mesh", "vertex cache / overdraw optimisation and .mesh against OBJ load times", runMeshBenchmark, false },
+	{ "jobs", "job system throughput and scaling from 1 to all hardware threads", jobBenchmark, false },
+	{ "raster", "software rasterizer fill rate (Mpix/s) per thread count", runSoftRasterizerBenchmark, false },
+	{ "rastercheck", "demo quad through GL and the software rasterizer, fails past a per-channel tolerance", rasterCheck, true },
+	{ "upload", "glTexSubImage2D throughput per format and unpack alignment", runUploadBenchmark, true },
+	{ "vertex", "draw throughput of float, half and compressed vertex formats", runVertexFormatBenchmark, true },
+	{ "trace", "GL call cost issued directly, while recording a trace and replayed from it", runTraceBenchmark, true },
+	{ "capture", "GL thread cost of synchronous glReadPixels against the PBO capture ring", runCaptureBenchmark, true },
+	{ "rtpool", "post chain memory through the render target pool against one texture per target", runRenderTargetPoolBenchmark, true },
+	{ "framegraph", "post chain run inline against the frame graph, with per-pass GPU times", runFrameGraphBenchmark, true },
+	{ "dynres", "frame time and upscale PSNR at native, fixed and dynamic resolution", runDynamicResolutionBenchmark, true },
+	{ "shaders", "lazy shader variant compiles, cached lookups and precompiling 32 permutations", runShaderLibraryBenchmark, true },
+	{ "shaderbatch", "startup compile of 64 programs one by one against one batch, polled for completion", runShaderBatchBenchmark, true },
+	{ "glload", "glad startup with every entry point resolved against resolved on first call, extension lookups", loaderBenchmark, true },
+	{ "caps", "streaming, texture allocation and draw paths selected per driver against their fallbacks", runCapabilityBenchmark, true },
+};
+
+// Runs a benchmark with a hidden 3.3 core window current
+static bool runWithContext(void (*run)()) {
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+	GLFWwindow* window = glfwCreateWindow(64, 64, "Noob OpenGL benchmark", NULL, NULL);
+	if (window == NULL) {
+		std::cout << "Failed to create GLFW window\n";
+		glfwTerminate();
+		return false;
+	}
+	glfwMakeContextCurrent(window);
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		std::cout << "Failed to initialize GLAD\n";
+		glfwTerminate();
+		return false;
+	}
+
+	run();
+
+	glfwDestroyWindow(window);
+	glfwTerminate();
+	return true;
+}
+
+bool runBenchmark(const char* name) {
+	for (const BenchmarkEntry& entry : benchmarks) {
+		if (strcmp(entry.name, name) == 0) {
+			if (entry.needsContext)
+				return runWithContext(entry.run) && !benchmarkFailed;
+			entry.run();
+			return !benchmarkFailed;
+		}
+	}
+
+	std::cout << "Unknown benchmark '" << name << "', available:\n";
+	for (const BenchmarkEntry& entry : benchmarks)
+		std::cout << "  " << entry.name << " - " << entry.description << "\n";
+	return false;
+}
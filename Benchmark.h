@@ -0,0 +1,9 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Runs one of the built-in benchmarks by name ("NoobOpenGL --bench <name>").
+// Returns false and lists the available names if 'name' is unknown, and returns false
+// when a check such as "rastercheck" fails.
+bool runBenchmark(const char* name);
+
+#endif
@@ -0,0 +1,417 @@
+#include "Culling.h"
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <thread>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CULLING_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CULLING_NEON
+#endif
+
+// scenes smaller than this are culled on the calling thread
+static const size_t minObjectsForThreads = 16384;
+static const int maxLeafSize = 4;
+
+enum Containment
+{
+	Outside,
+	Intersecting,
+	Inside
+};
+
+AABB transformAABB(const mat4& m, const AABB& box) {
+	// transform the center, and the extents by the absolute rotation/scale part
+	vec3 center = (box.min + box.max) * 0.5f;
+	vec3 extent = (box.max - box.min) * 0.5f;
+	vec3 c = transformPoint(m, center);
+	vec3 e(
+		std::fabs(m.cols[0].x) * extent.x + std::fabs(m.cols[1].x) * extent.y + std::fabs(m.cols[2].x) * extent.z,
+		std::fabs(m.cols[0].y) * extent.x + std::fabs(m.cols[1].y) * extent.y + std::fabs(m.cols[2].y) * extent.z,
+		std::fabs(m.cols[0].z) * extent.x + std::fabs(m.cols[1].z) * extent.y + std::fabs(m.cols[2].z) * extent.z);
+	return { c - e, c + e };
+}
+
+Frustum Frustum::fromMatrix(const mat4& m) {
+	// rows of the column-major matrix
+	vec4 r0(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x);
+	vec4 r1(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y);
+	vec4 r2(m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z);
+	vec4 r3(m.cols[0].w, m.cols[1].w, m.cols[2].w, m.cols[3].w);
+
+	Frustum f;
+	f.planes[0] = r3 + r0;	// left
+	f.planes[1] = r3 - r0;	// right
+	f.planes[2] = r3 + r1;	// bottom
+	f.planes[3] = r3 - r1;	// top
+	f.planes[4] = r3 + r2;	// near
+	f.planes[5] = r3 - r2;	// far
+	for (vec4& p : f.planes) {
+		float len = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+		if (len > 0.0f)
+			p = p * (1.0f / len);
+	}
+	return f;
+}
+
+static Containment classify(const Frustum& frustum, const AABB& box) {
+	Containment result = Inside;
+	for (const vec4& p : frustum.planes) {
+		// corner furthest along the plane normal, and the one furthest against it
+		float px = p.x >= 0.0f ? box.max.x : box.min.x;
+		float py = p.y >= 0.0f ? box.max.y : box.min.y;
+		float pz = p.z >= 0.0f ? box.max.z : box.min.z;
+		if (p.x * px + p.y * py + p.z * pz + p.w < 0.0f)
+			return Outside;
+		float nx = p.x >= 0.0f ? box.min.x : box.max.x;
+		float ny = p.y >= 0.0f ? box.min.y : box.max.y;
+		float nz = p.z >= 0.0f ? box.min.z : box.max.z;
+		if (p.x * nx + p.y * ny + p.z * nz + p.w < 0.0f)
+			result = Intersecting;
+	}
+	return result;
+}
+
+static AABB sphereBox(const BoundingSphere& sphere) {
+	vec3 r(sphere.radius);
+	return { sphere.center - r, sphere.center + r };
+}
+
+// stands in for the sphere of objects registered with a box
+static BoundingSphere unboundedSphere(const AABB& box) {
+	return { (box.min + box.max) * 0.5f, FLT_MAX };
+}
+
+static AABB emptyBox() {
+	return { vec3(FLT_MAX), vec3(-FLT_MAX) };
+}
+
+static void growBox(AABB& box, const AABB& other) {
+	box.min = vec3(std::min(box.min.x, other.min.x), std::min(box.min.y, other.min.y), std::min(box.min.z, other.min.z));
+	box.max = vec3(std::max(box.max.x, other.max.x), std::max(box.max.y, other.max.y), std::max(box.max.z, other.max.z));
+}
+
+CullingSystem::CullingSystem()
+	: liveCount(0), deadSlots(0), needsBuild(false), needsRefit(false) {
+	lastStats = { 0, 0, 0.0 };
+}
+
+int CullingSystem::addObject(const AABB& bounds, int userValue) {
+	return addProxy(bounds, unboundedSphere(bounds), userValue);
+}
+
+int CullingSystem::addObject(const BoundingSphere& bounds, int userValue) {
+	return addProxy(sphereBox(bounds), bounds, userValue);
+}
+
+int CullingSystem::addProxy(const AABB& bounds, const BoundingSphere& sphere, int userValue) {
+	int proxy;
+	if (!freeProxies.empty()) {
+		proxy = freeProxies.back();
+		freeProxies.pop_back();
+		proxyBounds[proxy] = bounds;
+		proxySphere[proxy] = sphere;
+		proxyValue[proxy] = userValue;
+		proxySlot[proxy] = -1;
+		proxyLive[proxy] = 1;
+	}
+	else {
+		proxy = (int)proxyBounds.size();
+		proxyBounds.push_back(bounds);
+		proxySphere.push_back(sphere);
+		proxyValue.push_back(userValue);
+		proxySlot.push_back(-1);
+		proxyLive.push_back(1);
+	}
+	liveCount++;
+	needsBuild = true;
+	return proxy;
+}
+
+void CullingSystem::updateObject(int proxy, const AABB& bounds) {
+	updateProxy(proxy, bounds, unboundedSphere(bounds));
+}
+
+void CullingSystem::updateObject(int proxy, const BoundingSphere& bounds) {
+	updateProxy(proxy, sphereBox(bounds), bounds);
+}
+
+void CullingSystem::updateProxy(int proxy, const AABB& bounds, const BoundingSphere& sphere) {
+	proxyBounds[proxy] = bounds;
+	proxySphere[proxy] = sphere;
+	int slot = proxySlot[proxy];
+	if (slot < 0)
+		return;
+	writeSlot(slot, proxy);
+	needsRefit = true;
+}
+
+void CullingSystem::writeSlot(int slot, int proxy) {
+	const AABB& b = proxyBounds[proxy];
+	const BoundingSphere& sphere = proxySphere[proxy];
+	minX[slot] = b.min.x; minY[slot] = b.min.y; minZ[slot] = b.min.z;
+	maxX[slot] = b.max.x; maxY[slot] = b.max.y; maxZ[slot] = b.max.z;
+	centerX[slot] = sphere.center.x; centerY[slot] = sphere.center.y; centerZ[slot] = sphere.center.z;
+	radius[slot] = sphere.radius;
+}
+
+void CullingSystem::removeObject(int proxy) {
+	int slot = proxySlot[proxy];
+	proxyLive[proxy] = 0;
+	proxySlot[proxy] = -1;
+	freeProxies.push_back(proxy);
+	liveCount--;
+
+	if (slot >= 0) {
+		// leave an empty box behind until the next rebuild
+		slotProxy[slot] = -1;
+		minX[slot] = minY[slot] = minZ[slot] = FLT_MAX;
+		maxX[slot] = maxY[slot] = maxZ[slot] = -FLT_MAX;
+		deadSlots++;
+		needsRefit = true;
+		if (deadSlots * 4 > liveCount)
+			needsBuild = true;
+	}
+}
+
+void CullingSystem::rebuild() {
+	needsBuild = true;
+}
+
+void CullingSystem::cull(const Frustum& frustum, std::vector<int>& visible, int threads) {
+	auto start = std::chrono::high_resolution_clock::now();
+	if (needsBuild)
+		build();
+	else if (needsRefit)
+		refit();
+
+	visible.clear();
+	if (!nodes.empty()) {
+		if (threads <= 1 || liveCount < minObjectsForThreads) {
+			cullNode(frustum, 0, visible);
+		}
+		else {
+			// split the top of the tree breadth first into a few subtrees per worker, so they
+			// are of similar size; leaves reached on the way are subtrees of their own
+			std::vector<int> subtrees;
+			std::vector<int> queue(1, 0);
+			size_t head = 0;
+			size_t target = (size_t)threads * 4;
+			while (head < queue.size() && queue.size() - head + subtrees.size() < target) {
+				int index = queue[head++];
+				const Node& node = nodes[index];
+				if (node.left < 0) {
+					subtrees.push_back(index);
+					continue;
+				}
+				queue.push_back(node.left);
+				queue.push_back(node.right);
+			}
+			subtrees.insert(subtrees.end(), queue.begin() + head, queue.end());
+
+			// workers take the next subtree as they finish one; results stay per subtree so
+			// the output order doesn't depend on scheduling
+			std::vector<std::vector<int>> results(subtrees.size());
+			std::atomic<size_t> next(0);
+			std::vector<std::thread> workers;
+			auto work = [&]() {
+				for (size_t i = next++; i < subtrees.size(); i = next++)
+					cullNode(frustum, subtrees[i], results[i]);
+			};
+			for (int t = 1; t < threads; t++)
+				workers.emplace_back(work);
+			work();
+			for (std::thread& worker : workers)
+				worker.join();
+			for (const std::vector<int>& r : results)
+				visible.insert(visible.end(), r.begin(), r.end());
+		}
+	}
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+	lastStats = { liveCount, visible.size(), elapsed.count() };
+}
+
+const CullStats& CullingSystem::stats() const {
+	return lastStats;
+}
+
+void CullingSystem::build() {
+	std::vector<int> proxies;
+	proxies.reserve(liveCount);
+	for (size_t p = 0; p < proxyLive.size(); p++) {
+		if (proxyLive[p])
+			proxies.push_back((int)p);
+	}
+
+	// padded so leaves can always load four lanes
+	size_t slots = proxies.size() + 3;
+	minX.assign(slots, FLT_MAX); minY.assign(slots, FLT_MAX); minZ.assign(slots, FLT_MAX);
+	maxX.assign(slots, -FLT_MAX); maxY.assign(slots, -FLT_MAX); maxZ.assign(slots, -FLT_MAX);
+	centerX.assign(slots, 0.0f); centerY.assign(slots, 0.0f); centerZ.assign(slots, 0.0f);
+	radius.assign(slots, FLT_MAX);
+	slotValue.assign(slots, -1);
+	slotProxy.assign(slots, -1);
+
+	nodes.clear();
+	if (!proxies.empty()) {
+		nodes.reserve(2 * proxies.size() / maxLeafSize + 1);
+		buildRange(proxies, 0, (int)proxies.size());
+	}
+	deadSlots = 0;
+	needsBuild = false;
+	needsRefit = false;
+}
+
+int CullingSystem::buildRange(std::vector<int>& proxies, int first, int count) {
+	int index = (int)nodes.size();
+	nodes.push_back(Node());
+
+	AABB bounds = emptyBox();
+	AABB centroids = emptyBox();
+	for (int i = first; i < first + count; i++) {
+		const AABB& b = proxyBounds[proxies[i]];
+		growBox(bounds, b);
+		vec3 c = (b.min + b.max) * 0.5f;
+		growBox(centroids, { c, c });
+	}
+	nodes[index].bounds = bounds;
+	nodes[index].first = first;
+	nodes[index].count = count;
+
+	if (count <= maxLeafSize) {
+		nodes[index].left = nodes[index].right = -1;
+		for (int i = first; i < first + count; i++) {
+			int proxy = proxies[i];
+			writeSlot(i, proxy);
+			slotValue[i] = proxyValue[proxy];
+			slotProxy[i] = proxy;
+			proxySlot[proxy] = i;
+		}
+		return index;
+	}
+
+	// median split on the axis where the centroids spread the most
+	vec3 extent = centroids.max - centroids.min;
+	int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+	auto key = [this, axis](int proxy) {
+		const AABB& b = proxyBounds[proxy];
+		return axis == 0 ? b.min.x + b.max.x : (axis == 1 ? b.min.y + b.max.y : b.min.z + b.max.z);
+	};
+	int half = count / 2;
+	std::nth_element(proxies.begin() + first, proxies.begin() + first + half, proxies.begin() + first + count,
+		[&key](int a, int b) { return key(a) < key(b); });
+
+	// children are created after the parent, so a reverse pass over 'nodes' refits bottom-up
+	int left = buildRange(proxies, first, half);
+	int right = buildRange(proxies, first + half, count - half);
+	nodes[index].left = left;
+	nodes[index].right = right;
+	return index;
+}
+
+void CullingSystem::refit() {
+	for (size_t i = nodes.size(); i-- > 0;) {
+		Node& node = nodes[i];
+		if (node.left >= 0) {
+			node.bounds = nodes[node.left].bounds;
+			growBox(node.bounds, nodes[node.right].bounds);
+			continue;
+		}
+		node.bounds = emptyBox();
+		for (int s = node.first; s < node.first + node.count; s++)
+			growBox(node.bounds, { vec3(minX[s], minY[s], minZ[s]), vec3(maxX[s], maxY[s], maxZ[s]) });
+	}
+	needsRefit = false;
+}
+
+void CullingSystem::cullNode(const Frustum& frustum, int index, std::vector<int>& out) const {
+	const Node& node = nodes[index];
+	Containment c = classify(frustum, node.bounds);
+	if (c == Outside)
+		return;
+	if (c == Inside) {
+		appendAll(index, out);
+		return;
+	}
+	if (node.left < 0) {
+		testLeaf(frustum, node, out);
+		return;
+	}
+	cullNode(frustum, node.left, out);
+	cullNode(frustum, node.right, out);
+}
+
+void CullingSystem::appendAll(int index, std::vector<int>& out) const {
+	// a subtree covers a contiguous slot range
+	const Node& node = nodes[index];
+	for (int s = node.first; s < node.first + node.count; s++) {
+		if (slotProxy[s] >= 0)
+			out.push_back(slotValue[s]);
+	}
+}
+
+void CullingSystem::testLeaf(const Frustum& frustum, const Node& leaf, std::vector<int>& out) const {
+	int s = leaf.first;
+	unsigned int insideMask = 0;
+#if defined(CULLING_SSE)
+	__m128 bMinX = _mm_loadu_ps(&minX[s]), bMinY = _mm_loadu_ps(&minY[s]), bMinZ = _mm_loadu_ps(&minZ[s]);
+	__m128 bMaxX = _mm_loadu_ps(&maxX[s]), bMaxY = _mm_loadu_ps(&maxY[s]), bMaxZ = _mm_loadu_ps(&maxZ[s]);
+	__m128 sX = _mm_loadu_ps(&centerX[s]), sY = _mm_loadu_ps(&centerY[s]), sZ = _mm_loadu_ps(&centerZ[s]);
+	__m128 sR = _mm_loadu_ps(&radius[s]);
+	__m128 outside = _mm_setzero_ps();
+	for (const vec4& p : frustum.planes) {
+		__m128 a = _mm_set1_ps(p.x), b = _mm_set1_ps(p.y), c = _mm_set1_ps(p.z), d = _mm_set1_ps(p.w);
+		__m128 px = p.x >= 0.0f ? bMaxX : bMinX;
+		__m128 py = p.y >= 0.0f ? bMaxY : bMinY;
+		__m128 pz = p.z >= 0.0f ? bMaxZ : bMinZ;
+		__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, px), _mm_mul_ps(b, py)), _mm_add_ps(_mm_mul_ps(c, pz), d));
+		outside = _mm_or_ps(outside, _mm_cmplt_ps(dist, _mm_setzero_ps()));
+		// the sphere is outside once its center is more than the radius behind the plane
+		__m128 center = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, sX), _mm_mul_ps(b, sY)), _mm_add_ps(_mm_mul_ps(c, sZ), d));
+		outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(center, sR), _mm_setzero_ps()));
+	}
+	insideMask = ~(unsigned int)_mm_movemask_ps(outside) & 0xF;
+#elif defined(CULLING_NEON)
+	float32x4_t bMinX = vld1q_f32(&minX[s]), bMinY = vld1q_f32(&minY[s]), bMinZ = vld1q_f32(&minZ[s]);
+	float32x4_t bMaxX = vld1q_f32(&maxX[s]), bMaxY = vld1q_f32(&maxY[s]), bMaxZ = vld1q_f32(&maxZ[s]);
+	float32x4_t sX = vld1q_f32(&centerX[s]), sY = vld1q_f32(&centerY[s]), sZ = vld1q_f32(&centerZ[s]);
+	float32x4_t sR = vld1q_f32(&radius[s]);
+	uint32x4_t outside = vdupq_n_u32(0);
+	for (const vec4& p : frustum.planes) {
+		float32x4_t dist = vdupq_n_f32(p.w);
+		dist = vmlaq_n_f32(dist, p.x >= 0.0f ? bMaxX : bMinX, p.x);
+		dist = vmlaq_n_f32(dist, p.y >= 0.0f ? bMaxY : bMinY, p.y);
+		dist = vmlaq_n_f32(dist, p.z >= 0.0f ? bMaxZ : bMinZ, p.z);
+		outside = vorrq_u32(outside, vcltq_f32(dist, vdupq_n_f32(0.0f)));
+		float32x4_t center = vaddq_f32(sR, vdupq_n_f32(p.w));
+		center = vmlaq_n_f32(center, sX, p.x);
+		center = vmlaq_n_f32(center, sY, p.y);
+		center = vmlaq_n_f32(center, sZ, p.z);
+		outside = vorrq_u32(outside, vcltq_f32(center, vdupq_n_f32(0.0f)));
+	}
+	unsigned int lanes[4];
+	vst1q_u32(lanes, outside);
+	for (int i = 0; i < 4; i++)
+		insideMask |= (lanes[i] ? 0u : 1u) << i;
+#else
+	for (int i = 0; i < 4; i++) {
+		AABB box = { vec3(minX[s + i], minY[s + i], minZ[s + i]), vec3(maxX[s + i], maxY[s + i], maxZ[s + i]) };
+		if (classify(frustum, box) == Outside)
+			continue;
+		bool sphereOutside = false;
+		for (const vec4& p : frustum.planes)
+			sphereOutside |= p.x * centerX[s + i] + p.y * centerY[s + i] + p.z * centerZ[s + i] + p.w + radius[s + i] < 0.0f;
+		if (!sphereOutside)
+			insideMask |= 1u << i;
+	}
+#endif
+	for (int i = 0; i < leaf.count; i++) {
+		if ((insideMask & (1u << i)) && slotProxy[s + i] >= 0)
+			out.push_back(slotValue[s + i]);
+	}
+}
@@ -0,0 +1,109 @@
+#ifndef CULLING_H
+#define CULLING_H
+
+#include <vector>
+#include <cstddef>
+#include "VecMath.h"
+
+struct AABB
+{
+	vec3 min, max;
+};
+
+struct BoundingSphere
+{
+	vec3 center;
+	float radius;
+};
+
+// World-space bounds of a local box after an affine transform
+AABB transformAABB(const mat4& m, const AABB& box);
+
+// Six inward-facing planes (a, b, c, d) with a*x + b*y + c*z + d >= 0 inside
+struct Frustum
+{
+	vec4 planes[6];
+
+	// Extracts the planes from a (projection * view) matrix
+	static Frustum fromMatrix(const mat4& viewProjection);
+};
+
+struct CullStats
+{
+	size_t total;
+	size_t visible;
+	double milliseconds;
+};
+
+// Frustum culling over a bounding volume hierarchy.
+// Objects are registered with their world bounds and a user value (e.g. a draw or
+// instance index). Moving objects only refits the tree; it is rebuilt when objects
+// are added or once enough of them were removed. cull() writes the user values of
+// visible objects into a compact list for the draw stage.
+class CullingSystem
+{
+public:
+	CullingSystem();
+
+	// Returns a proxy handle for the object
+	int addObject(const AABB& bounds, int userValue);
+	void updateObject(int proxy, const AABB& bounds);
+	// Objects given a sphere sit in the tree with the box around it, and leaves test the
+	// sphere as well: round or rotating objects are rejected where their box still
+	// touches the frustum. An update with a box drops the sphere.
+	int addObject(const BoundingSphere& bounds, int userValue);
+	void updateObject(int proxy, const BoundingSphere& bounds);
+	void removeObject(int proxy);
+
+	// Forces a full rebuild, e.g. after objects moved far enough to degrade the tree
+	void rebuild();
+
+	// Appends the user values of objects intersecting the frustum to 'visible' (cleared first).
+	// Large scenes split the traversal across 'threads' workers.
+	void cull(const Frustum& frustum, std::vector<int>& visible, int threads = 1);
+
+	// Counts and timing of the last cull()
+	const CullStats& stats() const;
+
+private:
+	struct Node
+	{
+		AABB bounds;
+		int left, right;		// child nodes, -1 for leaves
+		int first, count;		// slot range of a leaf
+	};
+
+	// Per slot, in leaf order (SoA so leaves test four boxes and spheres per SIMD instruction).
+	// Objects without a sphere have an infinite radius, which never rejects.
+	std::vector<float> minX, minY, minZ, maxX, maxY, maxZ;
+	std::vector<float> centerX, centerY, centerZ, radius;
+	std::vector<int> slotValue;
+	std::vector<int> slotProxy;
+
+	// Per proxy
+	std::vector<AABB> proxyBounds;
+	std::vector<BoundingSphere> proxySphere;
+	std::vector<int> proxyValue;
+	std::vector<int> proxySlot;		// -1 until the next build
+	std::vector<unsigned char> proxyLive;
+	std::vector<int> freeProxies;
+
+	std::vector<Node> nodes;
+	size_t liveCount;
+	size_t deadSlots;
+	bool needsBuild;
+	bool needsRefit;
+	CullStats lastStats;
+
+	int addProxy(const AABB& bounds, const BoundingSphere& sphere, int userValue);
+	void updateProxy(int proxy, const AABB& bounds, const BoundingSphere& sphere);
+	void writeSlot(int slot, int proxy);
+	void build();
+	int buildRange(std::vector<int>& proxies, int first, int count);
+	void refit();
+	void cullNode(const Frustum& frustum, int node, std::vector<int>& out) const;
+	void appendAll(int node, std::vector<int>& out) const;
+	void testLeaf(const Frustum& frustum, const Node& leaf, std::vector<int>& out) const;
+};
+
+#endif
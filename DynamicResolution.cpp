@@ -0,0 +1,345 @@
+#include "DynamicResolution.h"
+#include "Shader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+typedef std::chrono::steady_clock ResolutionClock;
+
+// steps the scale moves in, so the pool sees a handful of target sizes
+static const float scaleStep = 0.05f;
+// aim this far under the target so frame-to-frame noise doesn't cross it
+static const double targetHeadroom = 0.9;
+// GPU timer results trail the frame being rendered by up to this many frames
+static const int settleFrames = 5;
+// GPU frame times averaged per decision
+static const int decisionFrames = 4;
+
+static const char* upscaleVertexShader = R"(#version 330 core
+out vec2 uv;
+void main() {
+	// one triangle covering the viewport
+	vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	uv = corner;
+	gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+})";
+
+static const char* upscaleFragmentShader = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D scene;
+uniform bool edgeAware;
+uniform float sharpness;
+out vec4 FragColor;
+void main() {
+	vec4 color = texture(scene, uv);
+	if (edgeAware) {
+		// bilinear turns an edge into a ramp a source texel wide. Where the four texels the
+		// sample blends have a clear gradient, move the sample across the edge towards the
+		// texel row it is nearer to, so the ramp steepens across the edge but stays smooth
+		// along it; flat regions keep plain bilinear
+		vec2 size = vec2(textureSize(scene, 0));
+		vec2 position = uv * size - 0.5;
+		vec2 base = floor(position);
+		vec2 f = position - base;
+		vec3 weights = vec3(0.299, 0.587, 0.114);
+		float a = dot(texture(scene, (base + vec2(0.5, 0.5)) / size).rgb, weights);
+		float b = dot(texture(scene, (base + vec2(1.5, 0.5)) / size).rgb, weights);
+		float c = dot(texture(scene, (base + vec2(0.5, 1.5)) / size).rgb, weights);
+		float d = dot(texture(scene, (base + vec2(1.5, 1.5)) / size).rgb, weights);
+		vec2 gradient = vec2(b - a + d - c, c - a + d - b) * 0.5;
+		float strength = length(gradient);
+		if (strength > 1e-3) {
+			vec2 across = gradient / strength;
+			float t = dot(f - 0.5, across);
+			float steep = clamp(t * (1.0 + sharpness * smoothstep(0.02, 0.2, strength)), -0.5, 0.5);
+			color = texture(scene, (base + 0.5 + clamp(f + across * (steep - t), 0.0, 1.0)) / size);
+		}
+	}
+	FragColor = color;
+})";
+
+DynamicResolution::DynamicResolution(double targetMs)
+	: targetMs(targetMs), minScale(0.5f), maxScale(1.0f), fixedScale(0.0f), currentScale(1.0f),
+	upscaleFilter(UpscaleFilter::EdgeAware), framesToSkip(settleFrames), gpuSum(0.0), gpuSamples(0), lastGpuMs(0.0),
+	previousScale(1.0f), previousGpuMs(0.0), changes(0), program(0), vao(0), edgeAwareLocation(-1), sharpnessLocation(-1) {
+}
+
+DynamicResolution::~DynamicResolution() {
+	release();
+}
+
+void DynamicResolution::release() {
+	if (program)
+		glDeleteProgram(program);
+	if (vao)
+		glDeleteVertexArrays(1, &vao);
+	program = vao = 0;
+}
+
+void DynamicResolution::setTargetFrameTime(double ms) {
+	targetMs = std::max(ms, 0.1);
+}
+
+void DynamicResolution::setScaleRange(float newMin, float newMax) {
+	minScale = std::max(std::min(newMin, newMax), scaleStep);
+	maxScale = std::max(newMin, newMax);
+	currentScale = std::min(std::max(currentScale, minScale), maxScale);
+}
+
+void DynamicResolution::setFixedScale(float scale) {
+	fixedScale = std::max(scale, 0.0f);
+	if (fixedScale > 0.0f)
+		currentScale = fixedScale;
+	framesToSkip = settleFrames;
+	gpuSum = 0.0;
+	gpuSamples = 0;
+	previousGpuMs = 0.0;
+}
+
+bool DynamicResolution::adaptive() const {
+	return fixedScale == 0.0f;
+}
+
+void DynamicResolution::setFilter(UpscaleFilter filter) {
+	upscaleFilter = filter;
+}
+
+UpscaleFilter DynamicResolution::filter() const {
+	return upscaleFilter;
+}
+
+void DynamicResolution::update(double gpuFrameMs) {
+	if (gpuFrameMs <= 0.0)
+		return;
+	if (framesToSkip > 0) {
+		framesToSkip--;
+		return;
+	}
+	gpuSum += gpuFrameMs;
+	if (++gpuSamples < decisionFrames)
+		return;
+	lastGpuMs = gpuSum / gpuSamples;
+	gpuSum = 0.0;
+	gpuSamples = 0;
+	if (!adaptive())
+		return;
+
+	// Frame time is modelled as fixed + perPixel * scale^2: the upscale and anything else at
+	// output resolution doesn't shrink with the scale. Two measurements at different scales
+	// give both terms; with one, all of it is assumed to scale.
+	double budget = targetMs * targetHeadroom;
+	float wanted = currentScale * (float)std::sqrt(budget / lastGpuMs);
+	if (previousGpuMs > 0.0 && previousScale != currentScale) {
+		double perPixel = (lastGpuMs - previousGpuMs) / (currentScale * currentScale - previousScale * previousScale);
+		double fixed = lastGpuMs - perPixel * currentScale * currentScale;
+		if (perPixel > 0.0 && fixed >= 0.0)
+			wanted = budget > fixed ? (float)std::sqrt((budget - fixed) / perPixel) : minScale;
+	}
+	float next = std::round(wanted / scaleStep) * scaleStep;
+	next = std::min(std::max(next, minScale), maxScale);
+	if (std::fabs(next - currentScale) < scaleStep * 0.5f)
+		return;
+	previousScale = currentScale;
+	previousGpuMs = lastGpuMs;
+	currentScale = next;
+	changes++;
+	framesToSkip = settleFrames;
+}
+
+float DynamicResolution::scale() const {
+	return currentScale;
+}
+
+ResolutionStats DynamicResolution::stats() const {
+	ResolutionStats stats;
+	stats.scale = currentScale;
+	stats.gpuMs = lastGpuMs;
+	stats.targetMs = targetMs;
+	stats.scaleChanges = changes;
+	return stats;
+}
+
+FrameResource DynamicResolution::createSceneTarget(FrameGraph& graph, GLenum colorFormat, GLenum depthFormat) const {
+	return graph.createTarget("scene", RenderTargetDesc::relative(currentScale, colorFormat, depthFormat));
+}
+
+FrameResource DynamicResolution::addUpscalePass(FrameGraph& graph, FrameResource scene, FrameResource output) {
+	if (!program) {
+		Shader shader = Shader::fromSource(upscaleVertexShader, upscaleFragmentShader);
+		program = shader.ID;
+		shader.use();
+		shader.setInt("scene", 0);
+		edgeAwareLocation = glGetUniformLocation(program, "edgeAware");
+		sharpnessLocation = glGetUniformLocation(program, "sharpness");
+		glGenVertexArrays(1, &vao);
+	}
+	bool edgeAware = upscaleFilter == UpscaleFilter::EdgeAware;
+	FramePassBuilder pass = graph.addPass("upscale", [this, scene, edgeAware](const FrameGraph& g) {
+		glUseProgram(program);
+		glUniform1i(edgeAwareLocation, edgeAware ? 1 : 0);
+		glUniform1f(sharpnessLocation, 0.5f);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, g.target(scene).colorTexture);
+		glBindVertexArray(vao);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	});
+	pass.read(scene);
+	return pass.overwrite(output);
+}
+
+// ---------------- benchmark ----------------
+
+static const char* heavySceneFragmentShader = R"(#version 330 core
+in vec2 uv;
+uniform int iterations;
+out vec4 FragColor;
+void main() {
+	// smooth detail that costs per pixel, under rings with sharp edges
+	vec3 color = vec3(0.0);
+	for (int i = 0; i < iterations; i++) {
+		float f = float(i + 1);
+		color += 0.5 + 0.5 * sin(vec3(uv.x * f * 3.1, uv.y * f * 2.3, (uv.x + uv.y) * f * 1.7));
+	}
+	color /= float(iterations);
+	float ring = step(0.5, fract(length(uv - 0.5) * 6.0));
+	FragColor = vec4(mix(color, vec3(1.0) - color, ring), 1.0);
+})";
+
+static double psnr(const std::vector<unsigned char>& a, const std::vector<unsigned char>& b) {
+	double squared = 0.0;
+	size_t count = 0;
+	for (size_t i = 0; i < a.size(); i += 4) {
+		for (int c = 0; c < 3; c++) {
+			double d = (double)a[i + c] - b[i + c];
+			squared += d * d;
+			count++;
+		}
+	}
+	double mse = squared / std::max<size_t>(count, 1);
+	return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+}
+
+void runDynamicResolutionBenchmark() {
+	// stands in for a 4K target with heavy shaders: big enough to be fill bound everywhere
+	const int width = 1280, height = 720;
+	const int iterations = 24;
+
+	Shader scene = Shader::fromSource(upscaleVertexShader, heavySceneFragmentShader);
+	scene.use();
+	scene.setInt("iterations", iterations);
+	GLuint vao;
+	glGenVertexArrays(1, &vao);
+
+	GLuint outputFramebuffer, outputTexture;
+	glGenTextures(1, &outputTexture);
+	glBindTexture(GL_TEXTURE_2D, outputTexture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glGenFramebuffers(1, &outputFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, outputTexture, 0);
+
+	RenderTargetPool pool;
+	pool.setFramebufferSize(width, height);
+	FrameGraph graph(pool);
+	graph.setTiming(true);
+	DynamicResolution resolution;
+
+	// One frame; 'native' draws straight into the output, otherwise through the upscale.
+	// Frames end in glFinish, so their wall time is the GPU time, including work software
+	// renderers defer past the last timestamp. That is what drives the controller here; the
+	// timer queries are reported alongside.
+	auto frame = [&](bool native) {
+		ResolutionClock::time_point start = ResolutionClock::now();
+		pool.beginFrame();
+		graph.reset();
+		FrameResource output = graph.importTarget("output", outputFramebuffer, width, height, outputTexture);
+		FrameResource target = native ? output : resolution.createSceneTarget(graph, GL_RGBA8);
+		FramePassBuilder pass = graph.addPass("scene", [&](const FrameGraph&) {
+			glUseProgram(scene.ID);
+			glBindVertexArray(vao);
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+		});
+		target = pass.overwrite(target);
+		if (!native)
+			resolution.addUpscalePass(graph, target, output);
+		graph.execute();
+		pool.endFrame();
+		glFinish();
+		double ms = std::chrono::duration<double, std::milli>(ResolutionClock::now() - start).count();
+		resolution.update(ms);
+		return ms;
+	};
+	auto readOutput = [&]() {
+		std::vector<unsigned char> pixels((size_t)width * height * 4);
+		glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		return pixels;
+	};
+	// mean frame time over the second half, once the target sizes settled
+	auto run = [&](bool native, int frames) {
+		double sum = 0.0;
+		for (int i = 0; i < frames; i++) {
+			double ms = frame(native);
+			if (i >= frames / 2)
+				sum += ms;
+		}
+		return sum / (frames - frames / 2);
+	};
+	auto report = [&](const char* mode, float scale, double ms, double db) {
+		std::cout << std::left << std::setw(22) << mode << std::right << std::setw(6) << scale << std::setw(10) << ms
+			<< std::setw(12) << graph.gpuFrameMs();
+		if (db > 0.0)
+			std::cout << std::setw(9) << db;
+		std::cout << "\n";
+	};
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << width << "x" << height << " output, " << iterations << " iterations per pixel\n";
+	std::cout << "mode                   scale  frame ms  GPU timer ms  PSNR dB\n";
+
+	double nativeMs = run(true, 8);
+	std::vector<unsigned char> reference = readOutput();
+	report("native", 1.0f, nativeMs, 0.0);
+
+	const UpscaleFilter filters[] = { UpscaleFilter::Bilinear, UpscaleFilter::EdgeAware };
+	const char* filterNames[] = { "fixed, bilinear", "fixed, edge-aware" };
+	for (float fixed : { 0.5f, 0.75f }) {
+		for (int f = 0; f < 2; f++) {
+			resolution.setFixedScale(fixed);
+			resolution.setFilter(filters[f]);
+			double ms = run(false, 8);
+			report(filterNames[f], fixed, ms, psnr(reference, readOutput()));
+		}
+	}
+
+	// hold half the native frame time, starting from full resolution
+	resolution.setScaleRange(0.25f, 1.0f);
+	resolution.setFixedScale(1.0f);
+	resolution.setFixedScale(0.0f);
+	resolution.setTargetFrameTime(nativeMs * 0.5);
+	std::cout << "dynamic, target " << nativeMs * 0.5 << " ms; scale every 4 frames:";
+	const int frames = 48;
+	double lastMs = 0.0;
+	for (int i = 0; i < frames; i++) {
+		double ms = frame(false);
+		if (i >= frames - 8)
+			lastMs += ms / 8;
+		if (i % 4 == 3)
+			std::cout << " " << resolution.scale();
+	}
+	std::cout << "\n";
+	report("dynamic, edge-aware", resolution.scale(), lastMs, psnr(reference, readOutput()));
+	std::cout << resolution.stats().scaleChanges << " scale changes\n";
+
+	pool.clear();
+	glDeleteFramebuffers(1, &outputFramebuffer);
+	glDeleteTextures(1, &outputTexture);
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(scene.ID);
+}
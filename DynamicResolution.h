@@ -0,0 +1,85 @@
+#ifndef DYNAMIC_RESOLUTION_H
+#define DYNAMIC_RESOLUTION_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include "FrameGraph.h"
+
+enum class UpscaleFilter
+{
+	Bilinear,
+	EdgeAware	// bilinear plus contrast-adaptive sharpening, which backs off at edges so they don't ring
+};
+
+// Runtime metrics, e.g. for the title bar
+struct ResolutionStats
+{
+	float scale;			// of the framebuffer size, per axis
+	double gpuMs;			// mean GPU frame time of the last decision window
+	double targetMs;
+	size_t scaleChanges;
+};
+
+// Renders the scene below the output resolution and upscales it.
+// The scale is either pinned (setFixedScale, e.g. 0.5 for half resolution) or adapts to hold
+// a GPU frame time. Cost is modelled as a fixed part plus a part proportional to the pixel
+// count, fitted from the timings at the last two scales; the next scale aims a little under
+// the target and moves in 1/20ths so the render target pool sees few distinct sizes. After a
+// change the controller waits for GPU timings of frames rendered at the new scale.
+class DynamicResolution
+{
+public:
+	DynamicResolution(double targetMs = 1000.0 / 60.0);
+	// Needs the context still current unless release() was called
+	~DynamicResolution();
+	DynamicResolution(const DynamicResolution&) = delete;
+	DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+	void setTargetFrameTime(double ms);
+	void setScaleRange(float minScale, float maxScale);
+	// Pins the scale; 0 makes it adapt again
+	void setFixedScale(float scale);
+	bool adaptive() const;
+	void setFilter(UpscaleFilter filter);
+	UpscaleFilter filter() const;
+
+	// Call once per frame with the newest GPU frame time measured, e.g. FrameGraph::gpuFrameMs()
+	void update(double gpuFrameMs);
+	float scale() const;
+	ResolutionStats stats() const;
+
+	// The scene's offscreen target at the current scale
+	FrameResource createSceneTarget(FrameGraph& graph, GLenum colorFormat, GLenum depthFormat = 0) const;
+	// Adds the pass upscaling 'scene' to cover all of 'output'; returns the new version of 'output'
+	FrameResource addUpscalePass(FrameGraph& graph, FrameResource scene, FrameResource output);
+	// Deletes the upscale program and vertex array, e.g. before the context goes away; the
+	// next upscale pass creates them again
+	void release();
+
+private:
+	double targetMs;
+	float minScale, maxScale;
+	float fixedScale;
+	float currentScale;
+	UpscaleFilter upscaleFilter;
+
+	// controller state
+	int framesToSkip;		// GPU results still describing frames from before the last change
+	double gpuSum;
+	int gpuSamples;
+	double lastGpuMs;
+	float previousScale;	// the scale before the last change, measured at 'previousGpuMs'
+	double previousGpuMs;	// 0 until there was a change
+	size_t changes;
+
+	GLuint program;
+	GLuint vao;
+	GLint edgeAwareLocation;
+	GLint sharpnessLocation;
+};
+
+// GPU time and upscale error (PSNR against a native render) of a heavy fragment shader at
+// native, half and dynamic resolution
+void runDynamicResolutionBenchmark();
+
+#endif
@@ -0,0 +1,361 @@
+#include "FrameCapture.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+typedef std::chrono::steady_clock CaptureClock;
+
+FrameCapture::FrameCapture(int ringSize, size_t maxQueuedFrames)
+	: ring((size_t)std::max(ringSize, 2)), nextSlot(0), pendingCount(0),
+	videoActive(false), videoFormat(CaptureFormat::Y4m), videoFps(60), videoFrame(0),
+	maxQueued(std::max<size_t>(maxQueuedFrames, 1)), encoding(false), stopping(false),
+	totals(), readbackSeconds(0.0), encodeSeconds(0.0) {
+	for (Readback& slot : ring) {
+		slot.buffer = 0;
+		slot.size = 0;
+		slot.fence = 0;
+		slot.width = slot.height = 0;
+		slot.target = Target::Screenshot;
+	}
+	encoder = std::thread(&FrameCapture::encoderLoop, this);
+}
+
+FrameCapture::~FrameCapture() {
+	release();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wakeEncoder.notify_one();
+	encoder.join();
+}
+
+void FrameCapture::release() {
+	if (videoActive)
+		stopRecording();
+	flush();
+	for (Readback& slot : ring) {
+		if (slot.fence)
+			glDeleteSync(slot.fence);
+		if (slot.buffer)
+			glDeleteBuffers(1, &slot.buffer);
+		slot.fence = 0;
+		slot.buffer = 0;
+		slot.size = 0;
+	}
+}
+
+void FrameCapture::screenshot(const std::string& path) {
+	screenshots.push_back(path);
+}
+
+void FrameCapture::startRecording(const std::string& path, CaptureFormat format, int fps) {
+	if (videoActive)
+		stopRecording();
+	videoActive = true;
+	videoFormat = format;
+	videoPath = path;
+	videoFps = std::max(fps, 1);
+	videoFrame = 0;
+}
+
+void FrameCapture::stopRecording() {
+	if (!videoActive)
+		return;
+	videoActive = false;
+	// the frames still in flight belong to the recording, so land them before closing it
+	while (collect(true)) {
+	}
+	if (videoFormat == CaptureFormat::Y4m) {
+		EncodeJob job;
+		job.target = Target::StopVideo;
+		job.width = job.height = job.fps = 0;
+		submit(job, false);
+	}
+}
+
+bool FrameCapture::recording() const {
+	return videoActive;
+}
+
+void FrameCapture::endFrame(int width, int height) {
+	if (pendingCount == 0 && screenshots.empty() && !videoActive)
+		return;
+	CaptureClock::time_point start = CaptureClock::now();
+
+	// land whatever finished first, so the ring has room
+	while (collect(false)) {
+	}
+	if (width > 0 && height > 0) {
+		for (const std::string& path : screenshots)
+			issueReadback(width, height, Target::Screenshot, path);
+		screenshots.clear();
+
+		if (videoActive) {
+			if (videoFormat == CaptureFormat::Y4m) {
+				issueReadback(width, height, Target::Video, videoPath);
+			}
+			else {
+				std::ostringstream path;
+				path << videoPath << "_" << std::setw(5) << std::setfill('0') << videoFrame << ".png";
+				issueReadback(width, height, Target::PngSequence, path.str());
+			}
+			videoFrame++;
+		}
+	}
+
+	std::chrono::duration<double> elapsed = CaptureClock::now() - start;
+	std::lock_guard<std::mutex> lock(mutex);
+	readbackSeconds += elapsed.count();
+}
+
+bool FrameCapture::busy() const {
+	return pendingCount > 0 || !screenshots.empty();
+}
+
+void FrameCapture::flush() {
+	while (collect(true)) {
+	}
+	std::unique_lock<std::mutex> lock(mutex);
+	encoderIdle.wait(lock, [this] { return queue.empty() && !encoding; });
+}
+
+CaptureStats FrameCapture::stats() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	CaptureStats result = totals;
+	result.readbackMs = 1000.0 * readbackSeconds / std::max<size_t>(totals.captured, 1);
+	result.encodeMs = 1000.0 * encodeSeconds / std::max<size_t>(totals.written, 1);
+	return result;
+}
+
+void FrameCapture::issueReadback(int width, int height, Target target, const std::string& path) {
+	if (pendingCount == ring.size()) {
+		// the GPU is more than a ring behind: wait for the oldest rather than overwrite it
+		collect(true);
+		std::lock_guard<std::mutex> lock(mutex);
+		totals.stalls++;
+	}
+
+	Readback& slot = ring[nextSlot];
+	size_t bytes = (size_t)width * height * 4;
+	if (slot.buffer == 0)
+		glGenBuffers(1, &slot.buffer);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	if (slot.size != bytes) {
+		glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+		slot.size = bytes;
+	}
+	// RGBA rows are always 4-byte aligned, so the pack alignment cannot add padding;
+	// with a pack buffer bound the pointer is an offset and the call returns immediately
+	glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot.width = width;
+	slot.height = height;
+	slot.target = target;
+	slot.path = path;
+
+	nextSlot = (nextSlot + 1) % ring.size();
+	pendingCount++;
+	std::lock_guard<std::mutex> lock(mutex);
+	totals.captured++;
+}
+
+bool FrameCapture::collect(bool block) {
+	if (pendingCount == 0)
+		return false;
+	Readback& slot = ring[(nextSlot + ring.size() - pendingCount) % ring.size()];
+
+	GLenum status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+	if (status == GL_TIMEOUT_EXPIRED) {
+		if (!block)
+			return false;
+		do
+			status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+		while (status == GL_TIMEOUT_EXPIRED);
+	}
+	glDeleteSync(slot.fence);
+	slot.fence = 0;
+	pendingCount--;
+
+	EncodeJob job;
+	job.target = slot.target;
+	job.path = slot.path;
+	job.width = slot.width;
+	job.height = slot.height;
+	job.fps = videoFps;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!freeBuffers.empty()) {
+			job.pixels = std::move(freeBuffers.back());
+			freeBuffers.pop_back();
+		}
+	}
+	job.pixels.resize(slot.size);
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	const void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, slot.size, GL_MAP_READ_BIT);
+	if (pixels) {
+		memcpy(job.pixels.data(), pixels, slot.size);
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	if (!pixels) {
+		std::cout << "ERROR::CAPTURE::MAP_FAILED\n";
+		return true;
+	}
+
+	submit(job, job.target != Target::Screenshot);
+	return true;
+}
+
+void FrameCapture::submit(EncodeJob& job, bool droppable) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (droppable && queue.size() >= maxQueued) {
+		totals.dropped++;
+		freeBuffers.push_back(std::move(job.pixels));
+		return;
+	}
+	queue.push_back(std::move(job));
+	wakeEncoder.notify_one();
+}
+
+void FrameCapture::encoderLoop() {
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		wakeEncoder.wait(lock, [this] { return stopping || !queue.empty(); });
+		if (queue.empty())
+			break;
+		EncodeJob job = std::move(queue.front());
+		queue.pop_front();
+		encoding = true;
+		lock.unlock();
+
+		CaptureClock::time_point start = CaptureClock::now();
+		encode(job);
+		std::chrono::duration<double> elapsed = CaptureClock::now() - start;
+
+		lock.lock();
+		if (job.target != Target::StopVideo)
+			encodeSeconds += elapsed.count();
+		if (!job.pixels.empty() && freeBuffers.size() < maxQueued)
+			freeBuffers.push_back(std::move(job.pixels));
+		encoding = false;
+		if (queue.empty())
+			encoderIdle.notify_all();
+	}
+	lock.unlock();
+	video.close();
+}
+
+void FrameCapture::encode(EncodeJob& job) {
+	bool written = false;
+	switch (job.target) {
+	case Target::Screenshot:
+	case Target::PngSequence:
+		// the back buffer's alpha is not meaningful, store RGB
+		written = writePng(job.path.c_str(), job.pixels.data(), job.width, job.height, 4, 3, true);
+		if (written && job.target == Target::Screenshot)
+			std::cout << "Saved " << job.path << "\n";
+		break;
+	case Target::Video:
+		if (!video.isOpen() && !video.open(job.path.c_str(), job.width, job.height, job.fps))
+			break;
+		if (job.width != video.width() || job.height != video.height()) {
+			std::lock_guard<std::mutex> lock(mutex);
+			totals.dropped++;
+			break;
+		}
+		written = video.writeFrame(job.pixels.data(), 4, true);
+		break;
+	case Target::StopVideo:
+		video.close();
+		break;
+	}
+	if (written) {
+		std::lock_guard<std::mutex> lock(mutex);
+		totals.written++;
+	}
+}
+
+void runCaptureBenchmark() {
+	const int width = 1280, height = 720;
+	const int frames = 120;
+	const char* videoPath = "capture_benchmark.y4m";
+
+	GLuint framebuffer, renderbuffer;
+	glGenFramebuffers(1, &framebuffer);
+	glGenRenderbuffers(1, &renderbuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+	glViewport(0, 0, width, height);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << width << "x" << height << ", " << frames << " frames, GL thread ms per frame\n";
+
+	auto render = [&](int frame) {
+		glClearColor((frame % 60) / 60.0f, 0.3f, 1.0f - (frame % 30) / 30.0f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+	};
+
+	std::vector<unsigned char> pixels((size_t)width * height * 4);
+	double syncSeconds = 0.0;
+	for (int frame = 0; frame < frames; frame++) {
+		render(frame);
+		CaptureClock::time_point start = CaptureClock::now();
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+		syncSeconds += std::chrono::duration<double>(CaptureClock::now() - start).count();
+	}
+	std::cout << "glReadPixels   " << std::setw(8) << 1000.0 * syncSeconds / frames << "\n";
+
+	// paced like a 60 Hz render loop, so the encoder thread gets the time between frames
+	// instead of competing with the GL thread
+	const std::chrono::microseconds framePeriod(16667);
+	for (int ringSize = 2; ringSize <= 4; ringSize++) {
+		FrameCapture capture(ringSize);
+		capture.startRecording(videoPath, CaptureFormat::Y4m, 60);
+		CaptureClock::time_point deadline = CaptureClock::now();
+		for (int frame = 0; frame < frames; frame++) {
+			render(frame);
+			capture.endFrame(width, height);
+			deadline += framePeriod;
+			std::this_thread::sleep_until(deadline);
+		}
+		capture.stopRecording();
+		capture.flush();
+		CaptureStats stats = capture.stats();
+		std::cout << "PBO ring of " << ringSize << " " << std::setw(8) << stats.readbackMs << "  (" << stats.stalls
+			<< " stalls, " << stats.written << " written, " << stats.dropped << " dropped, Y4M encode "
+			<< stats.encodeMs << " ms/frame)\n";
+	}
+	std::remove(videoPath);
+
+	// a rendered-looking frame for the PNG encoder: gradients with flat regions
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			unsigned char* p = &pixels[((size_t)y * width + x) * 4];
+			bool flat = (x / 160 + y / 160) % 2 == 0;
+			p[0] = flat ? 51 : (unsigned char)(x * 255 / width);
+			p[1] = flat ? 77 : (unsigned char)(y * 255 / height);
+			p[2] = flat ? 77 : (unsigned char)((x ^ y) & 0xFF);
+			p[3] = 255;
+		}
+	}
+	CaptureClock::time_point start = CaptureClock::now();
+	std::vector<unsigned char> png = encodePng(pixels.data(), width, height, 4, 3, true);
+	double pngMs = std::chrono::duration<double, std::milli>(CaptureClock::now() - start).count();
+	std::cout << "PNG encode " << pngMs << " ms, " << png.size() / 1024 << " KB ("
+		<< 100.0 * png.size() / ((size_t)width * height * 3) << "% of raw RGB)\n";
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteRenderbuffers(1, &renderbuffer);
+}
@@ -0,0 +1,136 @@
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <glad/glad.h>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ImageWriter.h"
+
+enum class CaptureFormat
+{
+	Png,	// one numbered file per frame, lossless
+	Y4m		// a single raw YUV 4:2:0 video file
+};
+
+struct CaptureStats
+{
+	size_t captured;	// readbacks issued
+	size_t written;		// frames encoded to disk
+	size_t dropped;		// frames skipped because the encoder fell behind
+	size_t stalls;		// times the GL thread had to wait for a readback to land
+	double readbackMs;	// mean GL thread time per frame in endFrame
+	double encodeMs;	// mean encoder thread time per frame
+};
+
+// Asynchronous readback of the frames the application renders.
+// endFrame() copies the read framebuffer (the back buffer unless a framebuffer is bound)
+// into one of a ring of GL_PIXEL_PACK_BUFFERs and fences it; the copy is mapped a few
+// frames later, once the fence signaled, so glReadPixels never waits for rendering to
+// finish. Mapped pixels are handed to an encoder thread that writes PNG or Y4M.
+// If the encoder falls behind, video frames are dropped rather than stalling rendering;
+// screenshots are never dropped.
+class FrameCapture
+{
+public:
+	// 'ringSize' buffers: a frame is normally mapped ringSize - 1 frames after its readback
+	FrameCapture(int ringSize = 3, size_t maxQueuedFrames = 8);
+	// Finishes outstanding readbacks and encoding; needs the context still current unless
+	// release() was called
+	~FrameCapture();
+	FrameCapture(const FrameCapture&) = delete;
+	FrameCapture& operator=(const FrameCapture&) = delete;
+
+	// Saves the next frame as a PNG at 'path'
+	void screenshot(const std::string& path);
+
+	// Captures every frame until stopRecording(). Y4M writes 'path' (the frame size must
+	// not change while recording); PNG writes path_00000.png, path_00001.png, ...
+	void startRecording(const std::string& path, CaptureFormat format, int fps = 60);
+	void stopRecording();
+	bool recording() const;
+
+	// Call after rendering a frame, before swapping: issues this frame's readback if
+	// something is being captured and collects finished ones. Needs the context current.
+	void endFrame(int width, int height);
+
+	// True while readbacks are in flight, i.e. more endFrame() calls are needed to finish
+	bool busy() const;
+	// Waits for all readbacks and for the encoder to write them
+	void flush();
+	// Stops recording, flushes and deletes the GL objects, e.g. before the context goes
+	// away; they are recreated if capturing starts again
+	void release();
+
+	CaptureStats stats() const;
+
+private:
+	enum class Target
+	{
+		Screenshot,
+		PngSequence,
+		Video,
+		StopVideo
+	};
+
+	struct Readback
+	{
+		GLuint buffer;
+		size_t size;			// bytes allocated for 'buffer'
+		GLsync fence;
+		int width, height;
+		Target target;
+		std::string path;
+	};
+
+	struct EncodeJob
+	{
+		Target target;
+		std::string path;
+		int width, height, fps;
+		std::vector<unsigned char> pixels;	// RGBA, bottom row first
+	};
+
+	std::vector<Readback> ring;
+	size_t nextSlot;			// where the next readback goes
+	size_t pendingCount;		// readbacks in flight, oldest at nextSlot - pendingCount
+
+	std::vector<std::string> screenshots;	// requested, taken at the next endFrame
+	bool videoActive;
+	CaptureFormat videoFormat;
+	std::string videoPath;
+	int videoFps;
+	size_t videoFrame;
+
+	// encoder thread side
+	std::thread encoder;
+	mutable std::mutex mutex;
+	std::condition_variable wakeEncoder;
+	std::condition_variable encoderIdle;
+	std::deque<EncodeJob> queue;
+	std::vector<std::vector<unsigned char>> freeBuffers;	// recycled pixel storage
+	size_t maxQueued;
+	bool encoding;				// the encoder is working on a job outside the queue
+	bool stopping;
+
+	Y4mWriter video;			// only touched by the encoder thread
+	CaptureStats totals;
+	double readbackSeconds;
+	double encodeSeconds;
+
+	void issueReadback(int width, int height, Target target, const std::string& path);
+	// Maps the oldest readback into an encode job; waits for its fence when 'block'
+	bool collect(bool block);
+	void submit(EncodeJob& job, bool droppable);
+	void encoderLoop();
+	void encode(EncodeJob& job);
+};
+
+// GL thread cost per frame of synchronous glReadPixels against the PBO ring
+void runCaptureBenchmark();
+
+#endif
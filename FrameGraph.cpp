@@ -0,0 +1,659 @@
+#include "FrameGraph.h"
+#include "Shader.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <sstream>
+
+typedef std::chrono::steady_clock GraphClock;
+
+// glInvalidateFramebuffer is GL 4.3 / ARB_invalidate_subdata, which glad loads when the
+// context advertises it
+static bool invalidateSupported() {
+	return GLAD_GL_ARB_invalidate_subdata && glad_glInvalidateFramebuffer;
+}
+
+FrameResource::FrameResource() : index(-1), version(0) {
+}
+
+bool FrameResource::valid() const {
+	return index >= 0;
+}
+
+FramePassBuilder::FramePassBuilder(FrameGraph& graph, int pass) : graph(graph), pass(pass) {
+}
+
+FramePassBuilder& FramePassBuilder::read(FrameResource resource) {
+	if (!resource.valid() || resource.index >= (int)graph.resources.size()) {
+		std::cout << "ERROR::FRAME_GRAPH::INVALID_READ in " << graph.passes[pass].name << std::endl;
+		return *this;
+	}
+	graph.passes[pass].reads.push_back(resource);
+	graph.resources[resource.index].readers[resource.version].push_back(pass);
+	graph.compiled = false;
+	return *this;
+}
+
+FrameResource FramePassBuilder::write(FrameResource target) {
+	return graph.addWrite(pass, target, FrameGraph::WriteMode::Keep);
+}
+
+FrameResource FramePassBuilder::overwrite(FrameResource target) {
+	return graph.addWrite(pass, target, FrameGraph::WriteMode::Overwrite);
+}
+
+FramePassBuilder& FramePassBuilder::sideEffect() {
+	graph.passes[pass].sideEffect = true;
+	graph.compiled = false;
+	return *this;
+}
+
+FrameGraph::FrameGraph(RenderTargetPool& pool) : pool(pool), compiled(false), timing(false), totals() {
+}
+
+void FrameGraph::reset() {
+	resources.clear();
+	passes.clear();
+	order.clear();
+	compiled = false;
+	totals = FrameGraphStats();
+}
+
+FrameResource FrameGraph::createTarget(const std::string& name, const RenderTargetDesc& desc) {
+	Resource resource;
+	resource.name = name;
+	resource.desc = desc;
+	resource.imported = false;
+	resource.clearColor[0] = resource.clearColor[1] = resource.clearColor[2] = resource.clearColor[3] = 0.0f;
+	resource.clearImported = false;
+	resource.producers.push_back(-1);
+	resource.readers.resize(1);
+	resource.firstUse = resource.lastUse = -1;
+	resources.push_back(resource);
+	compiled = false;
+
+	FrameResource handle;
+	handle.index = (int)resources.size() - 1;
+	return handle;
+}
+
+FrameResource FrameGraph::importTarget(const std::string& name, GLuint framebuffer, int width, int height,
+	GLuint colorTexture, GLuint depthTexture) {
+	FrameResource handle = createTarget(name, RenderTargetDesc::fixed(width, height, 0));
+	Resource& resource = resources[handle.index];
+	resource.imported = true;
+	resource.target.framebuffer = framebuffer;
+	resource.target.colorTexture = colorTexture;
+	resource.target.depthTexture = depthTexture;
+	resource.target.width = width;
+	resource.target.height = height;
+	return handle;
+}
+
+void FrameGraph::setClearColor(FrameResource resource, float r, float g, float b, float a) {
+	if (!resource.valid())
+		return;
+	Resource& target = resources[resource.index];
+	target.clearColor[0] = r;
+	target.clearColor[1] = g;
+	target.clearColor[2] = b;
+	target.clearColor[3] = a;
+	target.clearImported = true;
+}
+
+FramePassBuilder FrameGraph::addPass(const std::string& name, FramePassFunction execute) {
+	Pass pass;
+	pass.name = name;
+	pass.execute = execute;
+	pass.mode = WriteMode::None;
+	pass.sideEffect = false;
+	pass.alive = false;
+	pass.clear = false;
+	pass.invalidate = false;
+	passes.push_back(pass);
+	compiled = false;
+	return FramePassBuilder(*this, (int)passes.size() - 1);
+}
+
+FrameResource FrameGraph::addWrite(int passIndex, FrameResource target, WriteMode mode) {
+	Pass& pass = passes[passIndex];
+	if (!target.valid() || target.index >= (int)resources.size()) {
+		std::cout << "ERROR::FRAME_GRAPH::INVALID_WRITE in " << pass.name << std::endl;
+		return FrameResource();
+	}
+	if (pass.output.valid()) {
+		std::cout << "ERROR::FRAME_GRAPH::MULTIPLE_OUTPUTS " << pass.name << " writes " << resources[pass.output.index].name
+			<< " already" << std::endl;
+		return FrameResource();
+	}
+	Resource& resource = resources[target.index];
+	int latest = (int)resource.producers.size() - 1;
+	if (target.version != latest) {
+		// two passes writing the same version would make the order between them ambiguous
+		std::cout << "ERROR::FRAME_GRAPH::STALE_WRITE " << pass.name << " writes version " << target.version << " of "
+			<< resource.name << ", latest is " << latest << std::endl;
+		target.version = latest;
+	}
+	resource.producers.push_back(passIndex);
+	resource.readers.emplace_back();
+	pass.output.index = target.index;
+	pass.output.version = latest + 1;
+	pass.mode = mode;
+	compiled = false;
+	return pass.output;
+}
+
+void FrameGraph::compile() {
+	order.clear();
+	for (Pass& pass : passes) {
+		pass.alive = false;
+		pass.clear = false;
+		pass.invalidate = false;
+		pass.acquires.clear();
+		pass.releases.clear();
+	}
+
+	// passes with visible effects, then everything they depend on
+	std::vector<int> stack;
+	for (size_t i = 0; i < passes.size(); i++) {
+		const Pass& pass = passes[i];
+		if (pass.sideEffect || (pass.output.valid() && resources[pass.output.index].imported))
+			stack.push_back((int)i);
+	}
+	auto require = [&](int producer) {
+		if (producer >= 0 && !passes[producer].alive)
+			stack.push_back(producer);
+	};
+	while (!stack.empty()) {
+		int index = stack.back();
+		stack.pop_back();
+		Pass& pass = passes[index];
+		if (pass.alive)
+			continue;
+		pass.alive = true;
+		for (const FrameResource& input : pass.reads)
+			require(resources[input.index].producers[input.version]);
+		if (pass.mode == WriteMode::Keep)
+			require(resources[pass.output.index].producers[pass.output.version - 1]);
+	}
+
+	// a pass runs after the producers of what it reads and, when it writes a new version,
+	// after the previous version's producer and readers
+	std::vector<std::vector<int>> successors(passes.size());
+	std::vector<int> pending(passes.size(), 0);
+	auto edge = [&](int from, int to) {
+		if (from >= 0 && from != to && passes[from].alive) {
+			successors[from].push_back(to);
+			pending[to]++;
+		}
+	};
+	for (size_t i = 0; i < passes.size(); i++) {
+		const Pass& pass = passes[i];
+		if (!pass.alive)
+			continue;
+		for (const FrameResource& input : pass.reads)
+			edge(resources[input.index].producers[input.version], (int)i);
+		if (pass.output.valid()) {
+			const Resource& output = resources[pass.output.index];
+			edge(output.producers[pass.output.version - 1], (int)i);
+			for (int reader : output.readers[pass.output.version - 1])
+				edge(reader, (int)i);
+		}
+	}
+	std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+	size_t alive = 0;
+	for (size_t i = 0; i < passes.size(); i++) {
+		if (passes[i].alive) {
+			alive++;
+			if (pending[i] == 0)
+				ready.push((int)i);
+		}
+	}
+	while (!ready.empty()) {
+		int index = ready.top();
+		ready.pop();
+		order.push_back(index);
+		for (int next : successors[index]) {
+			if (--pending[next] == 0)
+				ready.push(next);
+		}
+	}
+	if (order.size() != alive) {
+		std::cout << "ERROR::FRAME_GRAPH::CYCLE running passes in declaration order" << std::endl;
+		order.clear();
+		for (size_t i = 0; i < passes.size(); i++) {
+			if (passes[i].alive)
+				order.push_back((int)i);
+		}
+	}
+
+	// lifetimes of transient targets, and the clears and invalidates each pass needs
+	for (Resource& resource : resources)
+		resource.firstUse = resource.lastUse = -1;
+	auto use = [&](int resourceIndex, int position) {
+		Resource& resource = resources[resourceIndex];
+		if (resource.firstUse < 0)
+			resource.firstUse = position;
+		resource.lastUse = position;
+	};
+	for (size_t position = 0; position < order.size(); position++) {
+		Pass& pass = passes[order[position]];
+		for (const FrameResource& input : pass.reads)
+			use(input.index, (int)position);
+		if (!pass.output.valid())
+			continue;
+		use(pass.output.index, (int)position);
+		const Resource& output = resources[pass.output.index];
+		bool fresh = output.producers[pass.output.version - 1] < 0;
+		pass.clear = pass.mode == WriteMode::Keep && fresh && (!output.imported || output.clearImported);
+		pass.invalidate = pass.mode == WriteMode::Overwrite && invalidateSupported();
+	}
+	for (size_t i = 0; i < resources.size(); i++) {
+		const Resource& resource = resources[i];
+		if (resource.imported || resource.firstUse < 0)
+			continue;
+		passes[order[resource.firstUse]].acquires.push_back((int)i);
+		passes[order[resource.lastUse]].releases.push_back((int)i);
+	}
+
+	totals.passes = passes.size();
+	totals.culledPasses = passes.size() - order.size();
+	compiled = true;
+}
+
+void FrameGraph::execute() {
+	if (!compiled)
+		compile();
+	totals.clears = totals.invalidates = totals.transientTargets = 0;
+	if (timing)
+		timer.beginFrame();
+	std::vector<FramePassTiming> executed;
+
+	for (int index : order) {
+		Pass& pass = passes[index];
+		GraphClock::time_point start = GraphClock::now();
+
+		for (int resourceIndex : pass.acquires) {
+			Resource& resource = resources[resourceIndex];
+			resource.target = pool.acquire(resource.desc);
+			totals.transientTargets++;
+			// read before anything wrote it: give the pass defined contents at least
+			if (pass.output.index != resourceIndex || pass.mode == WriteMode::None) {
+				std::cout << "ERROR::FRAME_GRAPH::READ_BEFORE_WRITE " << pass.name << " reads " << resource.name << std::endl;
+				resource.target.bind();
+				glClearColor(resource.clearColor[0], resource.clearColor[1], resource.clearColor[2], resource.clearColor[3]);
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+				totals.clears++;
+			}
+		}
+
+		if (pass.output.valid()) {
+			Resource& output = resources[pass.output.index];
+			output.target.bind();
+			if (pass.invalidate) {
+				invalidateTarget(output);
+				totals.invalidates++;
+			}
+			if (pass.clear) {
+				bool color = output.imported || output.target.colorTexture;
+				bool depth = output.imported || output.target.depthTexture;
+				glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+				glDepthMask(GL_TRUE);
+				glStencilMask(0xFF);
+				glClearColor(output.clearColor[0], output.clearColor[1], output.clearColor[2], output.clearColor[3]);
+				glClearDepth(1.0);
+				glClearStencil(0);
+				glClear((color ? GL_COLOR_BUFFER_BIT : 0) | (depth ? GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT : 0));
+				totals.clears++;
+			}
+		}
+
+		pass.execute(*this);
+
+		for (int resourceIndex : pass.releases) {
+			Resource& resource = resources[resourceIndex];
+			if (invalidateSupported()) {
+				glBindFramebuffer(GL_FRAMEBUFFER, resource.target.framebuffer);
+				invalidateTarget(resource);
+				totals.invalidates++;
+			}
+			pool.release(resource.target);
+		}
+
+		FramePassTiming passTiming;
+		passTiming.name = pass.name;
+		passTiming.cpuMs = std::chrono::duration<double, std::milli>(GraphClock::now() - start).count();
+		passTiming.gpuMs = -1.0;
+		executed.push_back(passTiming);
+		if (timing)
+			timer.mark(pass.name);
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	if (timing) {
+		timer.endFrame();
+		// the GPU results describe an earlier frame; passes are matched by name
+		for (FramePassTiming& passTiming : executed) {
+			for (const GpuInterval& interval : timer.intervals()) {
+				if (interval.label == passTiming.name) {
+					passTiming.gpuMs = interval.ms;
+					break;
+				}
+			}
+		}
+	}
+	passTimings.swap(executed);
+}
+
+const RenderTarget& FrameGraph::target(FrameResource resource) const {
+	return resources[resource.index].target;
+}
+
+void FrameGraph::setTiming(bool enabled) {
+	timing = enabled;
+}
+
+void FrameGraph::release() {
+	timer.release();
+}
+
+const std::vector<FramePassTiming>& FrameGraph::timings() const {
+	return passTimings;
+}
+
+double FrameGraph::gpuFrameMs() const {
+	return timer.hasResults() ? timer.frameMs() : 0.0;
+}
+
+const GpuTimer& FrameGraph::gpuTimer() const {
+	return timer;
+}
+
+FrameGraphStats FrameGraph::stats() const {
+	return totals;
+}
+
+std::string FrameGraph::describe() const {
+	std::ostringstream text;
+	for (size_t position = 0; position < order.size(); position++) {
+		const Pass& pass = passes[order[position]];
+		text << position + 1 << ". " << pass.name;
+		if (!pass.reads.empty()) {
+			text << " reads";
+			for (const FrameResource& input : pass.reads)
+				text << " " << resources[input.index].name << "#" << input.version;
+		}
+		if (pass.output.valid()) {
+			text << (pass.mode == WriteMode::Overwrite ? " overwrites " : " writes ") << resources[pass.output.index].name
+				<< "#" << pass.output.version;
+		}
+		if (pass.clear)
+			text << " [clear]";
+		if (pass.invalidate)
+			text << " [invalidate]";
+		for (int resourceIndex : pass.acquires)
+			text << " [acquire " << resources[resourceIndex].name << "]";
+		for (int resourceIndex : pass.releases)
+			text << " [release " << resources[resourceIndex].name << "]";
+		text << "\n";
+	}
+	for (const Pass& pass : passes) {
+		if (!pass.alive)
+			text << "culled: " << pass.name << "\n";
+	}
+	return text.str();
+}
+
+void FrameGraph::invalidateTarget(const Resource& resource) {
+	if (!invalidateSupported())
+		return;
+	GLenum attachments[3];
+	GLsizei count = 0;
+	if (resource.target.framebuffer == 0) {
+		attachments[count++] = GL_COLOR;
+		attachments[count++] = GL_DEPTH;
+		attachments[count++] = GL_STENCIL;
+	}
+	else {
+		if (resource.target.colorTexture)
+			attachments[count++] = GL_COLOR_ATTACHMENT0;
+		if (resource.target.depthTexture) {
+			bool stencil = resource.desc.depthFormat == GL_DEPTH24_STENCIL8 || resource.desc.depthFormat == GL_DEPTH32F_STENCIL8;
+			attachments[count++] = stencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+		}
+	}
+	glInvalidateFramebuffer(GL_FRAMEBUFFER, count, attachments);
+}
+
+// ---------------- benchmark ----------------
+
+static const char* graphBenchmarkVertexShader = R"(#version 330 core
+out vec2 uv;
+void main() {
+	// one triangle covering the viewport
+	vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	uv = corner;
+	gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+})";
+
+static const char* graphBenchmarkFragmentShader = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source0;
+uniform sampler2D source1;
+uniform sampler2D source2;
+uniform vec4 tint;
+out vec4 FragColor;
+void main() {
+	// a small blur of each input, about what a post pass costs per pixel
+	vec2 texel = 1.0 / vec2(textureSize(source0, 0));
+	vec4 color = vec4(0.0);
+	for (int i = -2; i <= 2; i++)
+		color += texture(source0, uv + vec2(i, -i) * texel);
+	color = color * 0.2 + texture(source1, uv) * 0.5 + texture(source2, uv) * 0.5;
+	FragColor = color * 0.5 + tint;
+})";
+
+struct GraphBenchmarkTarget
+{
+	const char* name;
+	float scale;
+	GLenum color, depth;
+};
+
+struct GraphBenchmarkPass
+{
+	const char* name;
+	int output;			// -1 for the imported output target
+	int inputs[3];		// -1 for none
+	bool overwrite;
+};
+
+// a deferred-style frame; "debug normals" and "luminance" are switched-off features
+// whose results nothing reads
+static const GraphBenchmarkTarget graphBenchmarkTargets[] = {
+	{ "scene", 1.0f, GL_RGBA16F, GL_DEPTH24_STENCIL8 },
+	{ "ao", 0.5f, GL_R8, 0 },
+	{ "ao blurred", 0.5f, GL_R8, 0 },
+	{ "lit", 1.0f, GL_RGBA16F, 0 },
+	{ "bright", 0.5f, GL_RGBA16F, 0 },
+	{ "bloom 1", 0.25f, GL_RGBA16F, 0 },
+	{ "bloom 2", 0.125f, GL_RGBA16F, 0 },
+	{ "bloom 3", 0.0625f, GL_RGBA16F, 0 },
+	{ "hdr", 1.0f, GL_RGBA16F, 0 },
+	{ "normals view", 1.0f, GL_RGBA8, 0 },
+	{ "luminance", 0.25f, GL_R16F, 0 },
+	{ "ldr", 1.0f, GL_RGBA8, 0 },
+};
+
+static const GraphBenchmarkPass graphBenchmarkPasses[] = {
+	{ "scene", 0, { -1, -1, -1 }, false },
+	{ "ssao", 1, { 0, -1, -1 }, true },
+	{ "ssao blur", 2, { 1, -1, -1 }, true },
+	{ "lighting", 3, { 0, 2, -1 }, true },
+	{ "bright pass", 4, { 3, -1, -1 }, true },
+	{ "bloom down 1", 5, { 4, -1, -1 }, true },
+	{ "bloom down 2", 6, { 5, -1, -1 }, true },
+	{ "bloom down 3", 7, { 6, -1, -1 }, true },
+	{ "composite", 8, { 3, 5, 7 }, true },
+	{ "debug normals", 9, { 0, -1, -1 }, true },
+	{ "luminance", 10, { 8, -1, -1 }, true },
+	{ "tonemap", 11, { 8, -1, -1 }, true },
+	{ "fxaa", -1, { 11, -1, -1 }, true },
+	{ "ui", -1, { -1, -1, -1 }, false },
+};
+
+void runFrameGraphBenchmark() {
+	const int width = 1280, height = 720;
+	const int frames = 30;
+	const size_t targetCount = sizeof(graphBenchmarkTargets) / sizeof(graphBenchmarkTargets[0]);
+	const size_t passCount = sizeof(graphBenchmarkPasses) / sizeof(graphBenchmarkPasses[0]);
+
+	Shader shader = Shader::fromSource(graphBenchmarkVertexShader, graphBenchmarkFragmentShader);
+	shader.use();
+	shader.setInt("source0", 0);
+	shader.setInt("source1", 1);
+	shader.setInt("source2", 2);
+	GLint tintLocation = glGetUniformLocation(shader.ID, "tint");
+	GLuint vao;
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+
+	// stands in for the window, which is tiny in the benchmark
+	GLuint outputFramebuffer, outputTexture;
+	glGenTextures(1, &outputTexture);
+	glBindTexture(GL_TEXTURE_2D, outputTexture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glGenFramebuffers(1, &outputFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, outputTexture, 0);
+
+	auto draw = [&](size_t pass, GLuint inputs[3]) {
+		for (int unit = 0; unit < 3; unit++) {
+			glActiveTexture(GL_TEXTURE0 + unit);
+			glBindTexture(GL_TEXTURE_2D, inputs[unit]);
+		}
+		glUniform4f(tintLocation, 0.05f * pass, 0.02f, 0.01f, 1.0f);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	};
+
+	RenderTargetPool pool;
+	pool.setFramebufferSize(width, height);
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << width << "x" << height << ", " << passCount << " passes, " << frames << " frames\n";
+
+	// inline: every pass in declaration order into its own target, each cleared first
+	double inlineSeconds = 0.0;
+	for (int frame = 0; frame < frames; frame++) {
+		GraphClock::time_point start = GraphClock::now();
+		pool.beginFrame();
+		std::vector<RenderTarget> targets(targetCount);
+		for (size_t i = 0; i < targetCount; i++) {
+			const GraphBenchmarkTarget& target = graphBenchmarkTargets[i];
+			targets[i] = pool.acquire(RenderTargetDesc::relative(target.scale, target.color, target.depth));
+		}
+		for (size_t p = 0; p < passCount; p++) {
+			const GraphBenchmarkPass& pass = graphBenchmarkPasses[p];
+			if (pass.output >= 0) {
+				targets[pass.output].bind();
+			}
+			else {
+				glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+				glViewport(0, 0, width, height);
+			}
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+			GLuint inputs[3];
+			for (int k = 0; k < 3; k++)
+				inputs[k] = pass.inputs[k] >= 0 ? targets[pass.inputs[k]].colorTexture : 0;
+			draw(p, inputs);
+		}
+		pool.endFrame();
+		glFinish();
+		inlineSeconds += std::chrono::duration<double>(GraphClock::now() - start).count();
+	}
+	RenderTargetPoolStats inlineMemory = pool.stats();
+	pool.clear();
+
+	FrameGraph graph(pool);
+	graph.setTiming(true);
+	std::vector<double> gpuSums(passCount, 0.0);
+	std::vector<int> gpuSamples(passCount, 0);
+	double graphSeconds = 0.0, compileSeconds = 0.0;
+	for (int frame = 0; frame < frames; frame++) {
+		GraphClock::time_point start = GraphClock::now();
+		pool.beginFrame();
+		graph.reset();
+		std::vector<FrameResource> resources(targetCount);
+		for (size_t i = 0; i < targetCount; i++) {
+			const GraphBenchmarkTarget& target = graphBenchmarkTargets[i];
+			resources[i] = graph.createTarget(target.name, RenderTargetDesc::relative(target.scale, target.color, target.depth));
+		}
+		FrameResource output = graph.importTarget("output", outputFramebuffer, width, height, outputTexture);
+		graph.setClearColor(output, 0.0f, 0.0f, 0.0f, 1.0f);
+		for (size_t p = 0; p < passCount; p++) {
+			const GraphBenchmarkPass& pass = graphBenchmarkPasses[p];
+			FrameResource inputs[3];
+			for (int k = 0; k < 3; k++) {
+				if (pass.inputs[k] >= 0)
+					inputs[k] = resources[pass.inputs[k]];
+			}
+			FramePassBuilder builder = graph.addPass(pass.name, [&, p, inputs](const FrameGraph& g) {
+				GLuint textures[3];
+				for (int k = 0; k < 3; k++)
+					textures[k] = inputs[k].valid() ? g.target(inputs[k]).colorTexture : 0;
+				draw(p, textures);
+			});
+			for (int k = 0; k < 3; k++) {
+				if (inputs[k].valid())
+					builder.read(inputs[k]);
+			}
+			FrameResource& written = pass.output >= 0 ? resources[pass.output] : output;
+			written = pass.overwrite ? builder.overwrite(written) : builder.write(written);
+		}
+		GraphClock::time_point compileStart = GraphClock::now();
+		graph.compile();
+		compileSeconds += std::chrono::duration<double>(GraphClock::now() - compileStart).count();
+		graph.execute();
+		pool.endFrame();
+		glFinish();
+		graphSeconds += std::chrono::duration<double>(GraphClock::now() - start).count();
+
+		for (const FramePassTiming& timing : graph.timings()) {
+			for (size_t p = 0; p < passCount; p++) {
+				if (timing.gpuMs >= 0.0 && timing.name == graphBenchmarkPasses[p].name) {
+					gpuSums[p] += timing.gpuMs;
+					gpuSamples[p]++;
+				}
+			}
+		}
+	}
+	RenderTargetPoolStats graphMemory = pool.stats();
+	FrameGraphStats stats = graph.stats();
+
+	std::cout << graph.describe();
+	std::cout << "inline       " << std::setw(8) << 1000.0 * inlineSeconds / frames << " ms/frame, "
+		<< std::setw(7) << inlineMemory.pooledBytes / (1024.0 * 1024.0) << " MB of targets, " << passCount
+		<< " passes, " << passCount << " clears\n";
+	std::cout << "frame graph  " << std::setw(8) << 1000.0 * graphSeconds / frames << " ms/frame, "
+		<< std::setw(7) << graphMemory.pooledBytes / (1024.0 * 1024.0) << " MB of targets, "
+		<< stats.passes - stats.culledPasses << " passes, " << stats.clears << " clears, " << stats.invalidates
+		<< " invalidates, compile " << 1000.0 * compileSeconds / frames << " ms\n";
+	std::cout << "GPU ms per pass:\n";
+	for (size_t p = 0; p < passCount; p++) {
+		std::cout << "  " << std::left << std::setw(16) << graphBenchmarkPasses[p].name << std::right;
+		if (gpuSamples[p])
+			std::cout << std::setw(8) << gpuSums[p] / gpuSamples[p] << "\n";
+		else
+			std::cout << "  culled\n";
+	}
+
+	pool.clear();
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &outputFramebuffer);
+	glDeleteTextures(1, &outputTexture);
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(shader.ID);
+}
@@ -0,0 +1,169 @@
+#ifndef FRAME_GRAPH_H
+#define FRAME_GRAPH_H
+
+#include <glad/glad.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include "GpuTimer.h"
+#include "RenderTargetPool.h"
+
+// A version of a render target in the graph. Every write makes a new version, so a pass that
+// reads a handle depends on exactly the pass that produced it.
+struct FrameResource
+{
+	int index;
+	int version;
+
+	FrameResource();
+	bool valid() const;
+};
+
+class FrameGraph;
+typedef std::function<void(const FrameGraph&)> FramePassFunction;
+
+// Declares what a pass reads and writes; returned by FrameGraph::addPass
+class FramePassBuilder
+{
+public:
+	FramePassBuilder(FrameGraph& graph, int pass);
+
+	// The pass samples 'resource'
+	FramePassBuilder& read(FrameResource resource);
+	// The pass renders into 'target', keeping what it holds; a target nothing wrote yet
+	// is cleared to its clear values first. Returns the new version.
+	FrameResource write(FrameResource target);
+	// The pass covers every pixel of 'target' (a fullscreen pass), so its old contents are
+	// discarded instead of loaded or cleared. Returns the new version.
+	FrameResource overwrite(FrameResource target);
+	// Never culled, for passes with effects outside the graph such as readbacks
+	FramePassBuilder& sideEffect();
+
+private:
+	FrameGraph& graph;
+	int pass;
+};
+
+struct FramePassTiming
+{
+	std::string name;
+	double cpuMs;	// recording the pass's GL calls
+	double gpuMs;	// negative until a GPU result for the pass came back
+};
+
+struct FrameGraphStats
+{
+	size_t passes;			// declared
+	size_t culledPasses;	// whose outputs nothing used
+	size_t clears;			// inserted before first writes
+	size_t invalidates;		// framebuffers whose contents were discarded
+	size_t transientTargets;	// acquired from the pool
+};
+
+// Per-frame graph of render passes over pooled render targets.
+// Each frame: reset(), declare targets and passes, then execute(). The graph orders passes
+// by their dependencies (declaration order among independent ones), culls passes whose
+// outputs reach neither an imported target nor a side effect, acquires each transient
+// target from the pool just before its first use and releases it after its last, so targets
+// with disjoint lifetimes share textures. Clears are inserted where a pass loads a target
+// nothing wrote, and discarded contents are invalidated when glInvalidateFramebuffer is
+// available (GL 4.3 or ARB_invalidate_subdata), which saves bandwidth on tiled GPUs.
+class FrameGraph
+{
+public:
+	FrameGraph(RenderTargetPool& pool);
+
+	// Drops the previous frame's passes and targets
+	void reset();
+
+	// A transient target allocated from the pool for this frame only
+	FrameResource createTarget(const std::string& name, const RenderTargetDesc& desc);
+	// A target owned outside the graph, e.g. framebuffer 0 for the window. Passes writing
+	// imported targets are never culled.
+	FrameResource importTarget(const std::string& name, GLuint framebuffer, int width, int height,
+		GLuint colorTexture = 0, GLuint depthTexture = 0);
+	// Values inserted clears use; black, depth 1 and stencil 0 by default
+	void setClearColor(FrameResource resource, float r, float g, float b, float a);
+
+	// 'execute' runs with the pass's written target bound and its viewport set
+	FramePassBuilder addPass(const std::string& name, FramePassFunction execute);
+
+	// Orders and culls the declared passes; execute() calls it when needed
+	void compile();
+	// Runs the surviving passes and releases transient targets to the pool
+	void execute();
+
+	// The target behind 'resource', valid while the pass using it runs
+	const RenderTarget& target(FrameResource resource) const;
+
+	// Records a GPU timestamp after every pass
+	void setTiming(bool enabled);
+	// Surviving passes of the last execute() in execution order
+	const std::vector<FramePassTiming>& timings() const;
+	// GPU time of the newest frame measured, 0 before any
+	double gpuFrameMs() const;
+	const GpuTimer& gpuTimer() const;
+	// Deletes the timer's queries, e.g. before the context goes away
+	void release();
+
+	FrameGraphStats stats() const;
+	// Execution order with each pass's inputs, outputs and inserted operations
+	std::string describe() const;
+
+private:
+	friend class FramePassBuilder;
+
+	enum class WriteMode
+	{
+		None,
+		Keep,
+		Overwrite
+	};
+
+	struct Resource
+	{
+		std::string name;
+		RenderTargetDesc desc;
+		bool imported;
+		RenderTarget target;
+		float clearColor[4];
+		bool clearImported;					// setClearColor() was called on an imported target
+		std::vector<int> producers;			// per version, -1 for version 0
+		std::vector<std::vector<int>> readers;	// per version
+		int firstUse, lastUse;				// positions in 'order'
+	};
+
+	struct Pass
+	{
+		std::string name;
+		FramePassFunction execute;
+		std::vector<FrameResource> reads;
+		FrameResource output;
+		WriteMode mode;
+		bool sideEffect;
+		bool alive;
+		bool clear;			// output is cleared before the pass
+		bool invalidate;	// output's contents are discarded before the pass
+		std::vector<int> acquires;	// transient targets first used by this pass
+		std::vector<int> releases;	// and last used
+	};
+
+	RenderTargetPool& pool;
+	std::vector<Resource> resources;
+	std::vector<Pass> passes;
+	std::vector<int> order;		// surviving passes in execution order
+	bool compiled;
+	bool timing;
+	GpuTimer timer;
+	std::vector<FramePassTiming> passTimings;
+	FrameGraphStats totals;
+
+	FrameResource addWrite(int pass, FrameResource target, WriteMode mode);
+	void invalidateTarget(const Resource& resource);
+};
+
+// Frame time of a post chain with unused passes, run inline in declaration order against
+// the frame graph, plus per-pass GPU times
+void runFrameGraphBenchmark();
+
+#endif
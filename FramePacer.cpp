@@ -0,0 +1,205 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// present-to-present times kept for the statistics
+static const size_t statWindow = 240;
+// on-time frames before the emulated adaptive mode re-enables vsync
+static const int onTimeFramesForVsync = 8;
+// bounds of the adaptive sleep-to-spin margin, seconds
+static const double minSpinMargin = 0.0002;
+static const double maxSpinMargin = 0.004;
+
+static double seconds(std::chrono::steady_clock::duration d) {
+	return std::chrono::duration<double>(d).count();
+}
+
+FramePacer::FramePacer(double targetFps, VsyncMode mode)
+	: targetPeriod(0.0), vsyncMode(mode), appliedInterval(2), tearControl(false), onTimeFrames(0), lastFrameLate(false),
+	refreshPeriod(0.0), hasPresented(false), resuming(false), spinMargin(0.001), lastDelta(0.0), maxQueued(0), fenceIndex(0),
+	intervals(statWindow, 0.0), intervalCount(0) {
+	setTargetRate(targetFps);
+}
+
+FramePacer::~FramePacer() {
+	releaseFences();
+}
+
+void FramePacer::setTargetRate(double fps) {
+	targetPeriod = fps > 0.0 ? 1.0 / fps : 0.0;
+}
+
+void FramePacer::setVsyncMode(VsyncMode mode) {
+	vsyncMode = mode;
+}
+
+void FramePacer::setLowLatency(int maxQueuedFrames) {
+	releaseFences();
+	maxQueued = std::max(maxQueuedFrames, 0);
+	fences.assign(maxQueued, (GLsync)0);
+	fenceIndex = 0;
+}
+
+void FramePacer::release() {
+	releaseFences();
+}
+
+void FramePacer::present(GLFWwindow* window) {
+	if (!hasPresented) {
+		// both need the context current, so they wait for the first frame
+		tearControl = glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+		GLFWmonitor* monitor = glfwGetWindowMonitor(window);
+		const GLFWvidmode* mode = glfwGetVideoMode(monitor ? monitor : glfwGetPrimaryMonitor());
+		refreshPeriod = mode && mode->refreshRate > 0 ? 1.0 / mode->refreshRate : 0.0;
+	}
+	applySwapInterval();
+	waitForDeadline();
+	glfwSwapBuffers(window);
+	limitQueuedFrames();
+
+	Clock::time_point now = Clock::now();
+	if (hasPresented && !resuming) {
+		lastDelta = seconds(now - lastPresent);
+		intervals[intervalCount % statWindow] = lastDelta;
+		intervalCount++;
+
+		double period = framePeriod();
+		lastFrameLate = period > 0.0 && lastDelta > period * 1.5;
+		onTimeFrames = lastFrameLate ? 0 : onTimeFrames + 1;
+	}
+	else {
+		deadline = now;
+	}
+	lastPresent = now;
+	hasPresented = true;
+	resuming = false;
+	if (targetPeriod > 0.0)
+		deadline += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(targetPeriod));
+}
+
+void FramePacer::resume() {
+	resuming = true;
+	lastFrameLate = false;
+}
+
+double FramePacer::deltaTime() const {
+	return lastDelta;
+}
+
+FrameStats FramePacer::stats() const {
+	FrameStats result = { 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0 };
+	size_t count = std::min(intervalCount, statWindow);
+	if (count == 0)
+		return result;
+
+	std::vector<double> ms(intervals.begin(), intervals.begin() + count);
+	for (double& t : ms)
+		t *= 1000.0;
+
+	double sum = 0.0;
+	for (double t : ms)
+		sum += t;
+	result.frames = count;
+	result.meanMs = sum / count;
+	for (double t : ms)
+		result.varianceMs += (t - result.meanMs) * (t - result.meanMs);
+	result.varianceMs /= count;
+	result.stdDevMs = std::sqrt(result.varianceMs);
+	result.minMs = *std::min_element(ms.begin(), ms.end());
+	result.maxMs = *std::max_element(ms.begin(), ms.end());
+
+	double lateMs = framePeriod() * 1.5 * 1000.0;
+	if (lateMs > 0.0)
+		result.lateFrames = (size_t)std::count_if(ms.begin(), ms.end(), [lateMs](double t) { return t > lateMs; });
+
+	std::vector<double>::iterator p99 = ms.begin() + (count - 1) * 99 / 100;
+	std::nth_element(ms.begin(), p99, ms.end());
+	result.p99Ms = *p99;
+	return result;
+}
+
+double FramePacer::framePeriod() const {
+	if (targetPeriod > 0.0)
+		return targetPeriod;
+	return vsyncMode != VsyncMode::Off ? refreshPeriod : 0.0;
+}
+
+void FramePacer::applySwapInterval() {
+	int interval = 0;
+	switch (vsyncMode) {
+	case VsyncMode::Off:
+		interval = 0;
+		break;
+	case VsyncMode::On:
+		interval = 1;
+		break;
+	case VsyncMode::Adaptive:
+		if (tearControl)
+			interval = -1;
+		// emulated: stop waiting for vblank right after a late frame, resume once frames are on time again
+		else if (lastFrameLate)
+			interval = 0;
+		else
+			interval = appliedInterval == 0 && onTimeFrames < onTimeFramesForVsync ? 0 : 1;
+		break;
+	}
+
+	if (interval != appliedInterval) {
+		glfwSwapInterval(interval);
+		appliedInterval = interval;
+	}
+}
+
+void FramePacer::waitForDeadline() {
+	if (targetPeriod <= 0.0 || !hasPresented)
+		return;
+
+	Clock::time_point now = Clock::now();
+	// after a stall, pace from now on instead of rushing frames to catch up
+	if (seconds(now - deadline) > targetPeriod)
+		deadline = now;
+
+	// sleep most of the way; the OS may oversleep, so keep a margin that tracks the worst recent overshoot
+	double remaining = seconds(deadline - now);
+	while (remaining > spinMargin) {
+		double request = remaining - spinMargin;
+		std::this_thread::sleep_for(std::chrono::duration<double>(request));
+		Clock::time_point woke = Clock::now();
+		double overshoot = seconds(woke - now) - request;
+		spinMargin = std::min(maxSpinMargin, std::max(minSpinMargin, std::max(spinMargin * 0.95, overshoot * 1.25)));
+		now = woke;
+		remaining = seconds(deadline - now);
+	}
+
+	while (Clock::now() < deadline)
+		std::this_thread::yield();
+}
+
+void FramePacer::limitQueuedFrames() {
+	if (maxQueued <= 0)
+		return;
+
+	GLsync& slot = fences[fenceIndex];
+	if (slot)
+		glDeleteSync(slot);
+	slot = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	fenceIndex = (fenceIndex + 1) % maxQueued;
+
+	// the fence from maxQueued - 1 swaps ago must pass before the next frame is built
+	GLsync oldest = fences[fenceIndex];
+	if (!oldest)
+		return;
+	GLenum result;
+	do {
+		result = glClientWaitSync(oldest, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+	} while (result == GL_TIMEOUT_EXPIRED);
+}
+
+void FramePacer::releaseFences() {
+	for (GLsync& fence : fences) {
+		if (fence)
+			glDeleteSync(fence);
+		fence = (GLsync)0;
+	}
+}
@@ -0,0 +1,97 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+enum class VsyncMode
+{
+	Off,		// swap immediately, pacing only by the target rate
+	On,			// wait for vblank every frame
+	Adaptive	// wait for vblank, but tear instead of waiting a whole refresh when late
+};
+
+// Present-to-present statistics over the recent frame window, in milliseconds
+struct FrameStats
+{
+	size_t frames;
+	double meanMs;
+	double varianceMs;		// ms^2
+	double stdDevMs;
+	double minMs;
+	double maxMs;
+	double p99Ms;
+	size_t lateFrames;		// frames that took more than 1.5 periods (target rate, else refresh rate)
+};
+
+// Paces the render loop and owns the swap.
+// With a target rate the pacer sleeps until shortly before the frame's deadline and
+// spins for the rest; the spin margin adapts to how much the OS oversleeps. Adaptive
+// vsync uses the driver's late-swap-tear mode (swap interval -1) when the
+// *_EXT_swap_control_tear extension exists and otherwise toggles the interval itself.
+// Low-latency mode bounds how many frames the driver may queue by waiting on a fence
+// placed after each swap, so input sampled at the start of a frame is displayed sooner.
+class FramePacer
+{
+public:
+	// 'targetFps' 0 leaves the rate to vsync (or uncapped with vsync off)
+	FramePacer(double targetFps = 0.0, VsyncMode mode = VsyncMode::Adaptive);
+	~FramePacer();
+
+	void setTargetRate(double fps);
+	void setVsyncMode(VsyncMode mode);
+	// 'maxQueuedFrames' frames may be in flight on the GPU; 0 disables the limit
+	void setLowLatency(int maxQueuedFrames);
+	// Deletes the low-latency fences, e.g. before the context goes away; the next
+	// present starts placing them again
+	void release();
+
+	// Waits for the frame's deadline, swaps and records the present time.
+	// Needs the window's context current.
+	void present(GLFWwindow* window);
+
+	// Call before a present that follows an idle gap (on-demand redraw); the gap is
+	// neither recorded as a frame nor used to judge lateness
+	void resume();
+
+	// Seconds between the last two presents, for frame-rate independent updates
+	double deltaTime() const;
+
+	FrameStats stats() const;
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	double targetPeriod;		// seconds, 0 = uncapped
+	VsyncMode vsyncMode;
+	int appliedInterval;		// last value passed to glfwSwapInterval, or 2 for none yet
+	bool tearControl;			// driver supports swap interval -1
+	int onTimeFrames;			// consecutive on-time frames, for the emulated adaptive mode
+	bool lastFrameLate;
+
+	double refreshPeriod;		// seconds per refresh of the window's monitor, 0 if unknown
+	Clock::time_point lastPresent;
+	Clock::time_point deadline;
+	bool hasPresented;
+	bool resuming;
+	double spinMargin;			// seconds before the deadline at which sleeping stops
+	double lastDelta;
+
+	int maxQueued;
+	std::vector<GLsync> fences;	// ring, one per queued frame
+	size_t fenceIndex;
+
+	std::vector<double> intervals;	// ring of recent present-to-present times, seconds
+	size_t intervalCount;
+
+	double framePeriod() const;
+	void applySwapInterval();
+	void waitForDeadline();
+	void limitQueuedFrames();
+	void releaseFences();
+};
+
+#endif
@@ -0,0 +1,342 @@
+#include "GLCapabilities.h"
+#include "RenderQueue.h"
+#include "Shader.h"
+#include "StreamBuffer.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+typedef std::chrono::steady_clock CapsClock;
+
+static GLCapabilities capabilities;
+static bool detected = false;
+static bool forcedOff[(int)GLFeature::Count] = {};
+
+static const char* const featureNames[(int)GLFeature::Count] = {
+	"buffer_storage",
+	"multi_draw_indirect",
+	"texture_storage",
+	"direct_state_access"
+};
+
+static void selectPaths() {
+	for (int i = 0; i < (int)GLFeature::Count; i++)
+		capabilities.enabled[i] = capabilities.supported[i] && !forcedOff[i];
+	const bool* enabled = capabilities.enabled;
+
+	capabilities.streamPath = enabled[(int)GLFeature::BufferStorage] ? StreamPath::PersistentMapped : StreamPath::MapRange;
+	// glTextureStorage2D comes from texture_storage, the DSA spelling needs both
+	if (enabled[(int)GLFeature::DirectStateAccess] && enabled[(int)GLFeature::TextureStorage])
+		capabilities.texturePath = TexturePath::DirectStateAccess;
+	else if (enabled[(int)GLFeature::TextureStorage])
+		capabilities.texturePath = TexturePath::TextureStorage;
+	else
+		capabilities.texturePath = TexturePath::TexImage;
+	capabilities.drawPath = enabled[(int)GLFeature::MultiDrawIndirect] ? DrawPath::MultiDrawIndirect : DrawPath::Individual;
+}
+
+static bool coreVersion(int major, int minor) {
+	return capabilities.major > major || (capabilities.major == major && capabilities.minor >= minor);
+}
+
+const GLCapabilities& glCapabilities() {
+	if (detected)
+		return capabilities;
+	detected = true;
+
+	capabilities.major = GLVersion.major;
+	capabilities.minor = GLVersion.minor;
+	const char* renderer = (const char*)glGetString(GL_RENDERER);
+	capabilities.renderer = renderer ? renderer : "";
+	// a feature is there when the context advertises the extension or its version has it in
+	// core; glad loads the entry points (same names) in both cases
+	bool* supported = capabilities.supported;
+	supported[(int)GLFeature::BufferStorage] = (GLAD_GL_ARB_buffer_storage || coreVersion(4, 4)) && glad_glBufferStorage;
+	supported[(int)GLFeature::MultiDrawIndirect] =
+		((GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_draw_indirect) || coreVersion(4, 3)) &&
+		glad_glMultiDrawArraysIndirect && glad_glMultiDrawElementsIndirect;
+	supported[(int)GLFeature::TextureStorage] = (GLAD_GL_ARB_texture_storage || coreVersion(4, 2)) && glad_glTexStorage2D;
+	supported[(int)GLFeature::DirectStateAccess] = (GLAD_GL_ARB_direct_state_access || coreVersion(4, 5)) &&
+		glad_glCreateTextures && glad_glTextureStorage2D && glad_glTextureSubImage2D && glad_glTextureParameteri;
+	selectPaths();
+	return capabilities;
+}
+
+void resetCapabilities() {
+	detected = false;
+}
+
+void forceFallback(GLFeature feature, bool off) {
+	forcedOff[(int)feature] = off;
+	if (detected)
+		selectPaths();
+}
+
+bool forceFallbacks(const std::string& list) {
+	std::stringstream stream(list);
+	std::string name;
+	bool ok = true;
+	while (std::getline(stream, name, ',')) {
+		if (name.empty())
+			continue;
+		if (name == "all") {
+			for (int i = 0; i < (int)GLFeature::Count; i++)
+				forceFallback((GLFeature)i);
+			continue;
+		}
+		if (name == "dsa")
+			name = "direct_state_access";
+		else if (name == "mdi")
+			name = "multi_draw_indirect";
+		int found = -1;
+		for (int i = 0; i < (int)GLFeature::Count; i++) {
+			if (name == featureNames[i])
+				found = i;
+		}
+		if (found < 0) {
+			std::cout << "ERROR::CAPABILITIES::UNKNOWN_FEATURE " << name << std::endl;
+			ok = false;
+			continue;
+		}
+		forceFallback((GLFeature)found);
+	}
+	return ok;
+}
+
+const char* featureName(GLFeature feature) {
+	return featureNames[(int)feature];
+}
+
+const char* streamPathName(StreamPath path) {
+	switch (path) {
+	case StreamPath::PersistentMapped: return "persistent mapped";
+	case StreamPath::MapRange: return "unsynchronized map range";
+	case StreamPath::SubData: return "buffer sub data";
+	}
+	return "";
+}
+
+const char* texturePathName(TexturePath path) {
+	switch (path) {
+	case TexturePath::DirectStateAccess: return "direct state access";
+	case TexturePath::TextureStorage: return "texture storage";
+	case TexturePath::TexImage: return "tex image";
+	}
+	return "";
+}
+
+const char* drawPathName(DrawPath path) {
+	switch (path) {
+	case DrawPath::MultiDrawIndirect: return "multi-draw indirect";
+	case DrawPath::Individual: return "individual draws";
+	}
+	return "";
+}
+
+void logCapabilities() {
+	const GLCapabilities& caps = glCapabilities();
+	std::cout << "GL " << caps.major << "." << caps.minor << ", " << caps.renderer << "\n";
+	for (int i = 0; i < (int)GLFeature::Count; i++) {
+		std::cout << "  " << std::left << std::setw(20) << featureNames[i] << std::right
+			<< (!caps.supported[i] ? "not supported" : forcedOff[i] ? "forced off" : "on") << "\n";
+	}
+	std::cout << "  streaming: " << streamPathName(caps.streamPath) << ", textures: " << texturePathName(caps.texturePath)
+		<< ", draws: " << drawPathName(caps.drawPath) << std::endl;
+}
+
+static void setTextureParameters(GLenum target, GLuint texture, int levels, GLint filter, GLint wrap, bool directStateAccess) {
+	const GLenum names[] = { GL_TEXTURE_MIN_FILTER, GL_TEXTURE_MAG_FILTER, GL_TEXTURE_WRAP_S, GL_TEXTURE_WRAP_T, GL_TEXTURE_MAX_LEVEL };
+	const GLint values[] = { filter, filter, wrap, wrap, levels - 1 };
+	for (int i = 0; i < 5; i++) {
+		if (directStateAccess)
+			glTextureParameteri(texture, names[i], values[i]);
+		else
+			glTexParameteri(target, names[i], values[i]);
+	}
+}
+
+GLuint allocateTexture2D(GLenum internalFormat, int width, int height, int levels, GLenum format, GLenum type,
+	GLint filter, GLint wrap) {
+	TexturePath path = glCapabilities().texturePath;
+	GLuint texture = 0;
+	if (path == TexturePath::DirectStateAccess) {
+		glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+		glTextureStorage2D(texture, levels, internalFormat, width, height);
+		setTextureParameters(GL_TEXTURE_2D, texture, levels, filter, wrap, true);
+		return texture;
+	}
+
+	GLint previous;
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	if (path == TexturePath::TextureStorage) {
+		glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height);
+	}
+	else {
+		for (int level = 0; level < levels; level++)
+			glTexImage2D(GL_TEXTURE_2D, level, internalFormat, std::max(1, width >> level), std::max(1, height >> level), 0,
+				format, type, nullptr);
+	}
+	setTextureParameters(GL_TEXTURE_2D, texture, levels, filter, wrap, false);
+	glBindTexture(GL_TEXTURE_2D, previous);
+	return texture;
+}
+
+// ---------------- benchmark ----------------
+
+static const char* capsBenchmarkVertex = R"(#version 330 core
+layout (location = 0) in vec4 aPosition;
+void main() {
+	gl_Position = vec4(aPosition.xy, 0.0, 1.0);
+	gl_PointSize = 1.0;
+})";
+
+static const char* capsBenchmarkFragment = R"(#version 330 core
+out vec4 FragColor;
+void main() {
+	FragColor = vec4(1.0, 0.5, 0.25, 1.0);
+})";
+
+void runCapabilityBenchmark() {
+	logCapabilities();
+	const GLCapabilities& caps = glCapabilities();
+	bool savedForced[(int)GLFeature::Count];
+	std::copy(forcedOff, forcedOff + (int)GLFeature::Count, savedForced);
+
+	GLuint target = 0, framebuffer = 0;
+	glGenTextures(1, &target);
+	glBindTexture(GL_TEXTURE_2D, target);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 64, 64, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target, 0);
+	glViewport(0, 0, 64, 64);
+	Shader shader = Shader::fromSource(capsBenchmarkVertex, capsBenchmarkFragment);
+	glUseProgram(shader.ID);
+	GLuint vao;
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	glEnableVertexAttribArray(0);
+	std::cout << std::fixed << std::setprecision(3);
+
+	// streaming: per-draw vertex data pushed and drawn straight from the ring
+	{
+		const int frames = 60, chunks = 256, points = 64;
+		std::vector<float> chunk(points * 4);
+		std::vector<StreamPath> paths;
+		if (caps.supported[(int)GLFeature::BufferStorage])
+			paths.push_back(StreamPath::PersistentMapped);
+		paths.push_back(StreamPath::MapRange);
+		paths.push_back(StreamPath::SubData);
+		std::cout << "streaming " << chunks << " x " << chunk.size() * sizeof(float) << " bytes per frame:\n";
+		for (StreamPath path : paths) {
+			StreamBuffer stream(GL_ARRAY_BUFFER, 3 * chunks * chunk.size() * sizeof(float), path);
+			glFinish();
+			CapsClock::time_point start = CapsClock::now();
+			for (int frame = 0; frame < frames; frame++) {
+				for (int c = 0; c < chunks; c++) {
+					for (int p = 0; p < points; p++) {
+						chunk[p * 4 + 0] = (p % 8) / 4.0f - 1.0f + frame * 0.001f;
+						chunk[p * 4 + 1] = c / 128.0f - 1.0f;
+						chunk[p * 4 + 2] = chunk[p * 4 + 3] = 0.0f;
+					}
+					size_t offset = stream.push(chunk.data(), chunk.size() * sizeof(float), 16);
+					glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, (void*)offset);
+					glDrawArrays(GL_POINTS, 0, points);
+				}
+				stream.endFrame();
+			}
+			glFinish();
+			double ms = std::chrono::duration<double, std::milli>(CapsClock::now() - start).count() / frames;
+			StreamBufferStats stats = stream.stats();
+			std::cout << "  " << std::left << std::setw(26) << streamPathName(path) << std::right << std::setw(9) << ms
+				<< " ms/frame (" << stats.wraps << " wraps, " << stats.waits << " waits)\n";
+		}
+	}
+
+	// texture allocation through each path, forcing the better ones off in turn
+	{
+		const int count = 200;
+		std::cout << "allocating " << count << " 256x256 RGBA8 textures, 9 levels:\n";
+		for (int step = 0; step < 3; step++) {
+			if (step == 1)
+				forceFallback(GLFeature::DirectStateAccess);
+			if (step == 2)
+				forceFallback(GLFeature::TextureStorage);
+			TexturePath path = caps.texturePath;
+			if (step == 0 && path != TexturePath::DirectStateAccess)
+				continue;
+			if (step == 1 && path != TexturePath::TextureStorage)
+				continue;
+			std::vector<GLuint> textures;
+			glFinish();
+			CapsClock::time_point start = CapsClock::now();
+			for (int i = 0; i < count; i++)
+				textures.push_back(allocateTexture2D(GL_RGBA8, 256, 256, 9, GL_RGBA, GL_UNSIGNED_BYTE, GL_LINEAR_MIPMAP_LINEAR));
+			glFinish();
+			double us = std::chrono::duration<double, std::micro>(CapsClock::now() - start).count() / count;
+			glDeleteTextures((GLsizei)textures.size(), textures.data());
+			std::cout << "  " << std::left << std::setw(26) << texturePathName(path) << std::right << std::setw(9) << us
+				<< " us/texture\n";
+		}
+		std::copy(savedForced, savedForced + (int)GLFeature::Count, forcedOff);
+		selectPaths();
+	}
+
+	// draws sharing all state, which the queue can merge
+	{
+		const int draws = 4000, frames = 30;
+		std::vector<float> vertices;
+		for (int i = 0; i < draws; i++) {
+			float x = (i % 64) / 32.0f - 1.0f, y = (i / 64) / 32.0f - 1.0f;
+			const float quad[] = { x, y, 0, 1, x + 0.02f, y, 0, 1, x, y + 0.02f, 0, 1 };
+			vertices.insert(vertices.end(), quad, quad + 12);
+		}
+		GLuint vbo, drawVao;
+		glGenVertexArrays(1, &drawVao);
+		glBindVertexArray(drawVao);
+		glGenBuffers(1, &vbo);
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+		std::cout << draws << " draws with identical state:\n";
+		for (int step = 0; step < 2; step++) {
+			if (step == 0 && caps.drawPath != DrawPath::MultiDrawIndirect)
+				continue;
+			if (step == 1)
+				forceFallback(GLFeature::MultiDrawIndirect);
+			RenderQueue queue;
+			double cpuMs = 0.0;
+			glFinish();
+			CapsClock::time_point start = CapsClock::now();
+			for (int frame = 0; frame < frames; frame++) {
+				CommandBuffer& commands = queue.buffer(0);
+				for (int i = 0; i < draws; i++)
+					commands.draw(opaqueSortKey(0, shader.ID, 0, i / (float)draws), shader.ID, drawVao, GL_TRIANGLES, 3, 0, i * 3);
+				CapsClock::time_point executeStart = CapsClock::now();
+				queue.execute();
+				cpuMs += std::chrono::duration<double, std::milli>(CapsClock::now() - executeStart).count();
+			}
+			glFinish();
+			double ms = std::chrono::duration<double, std::milli>(CapsClock::now() - start).count() / frames;
+			std::cout << "  " << std::left << std::setw(26) << drawPathName(caps.drawPath) << std::right << std::setw(9) << ms
+				<< " ms/frame, execute " << cpuMs / frames << " ms, " << queue.stats().drawCalls << " draw calls\n";
+		}
+		std::copy(savedForced, savedForced + (int)GLFeature::Count, forcedOff);
+		selectPaths();
+		glDeleteBuffers(1, &vbo);
+		glDeleteVertexArrays(1, &drawVao);
+	}
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(shader.ID);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteTextures(1, &target);
+}
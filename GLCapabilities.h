@@ -0,0 +1,80 @@
+#ifndef GL_CAPABILITIES_H
+#define GL_CAPABILITIES_H
+
+#include <glad/glad.h>
+#include <string>
+
+// Optional GL features with a faster path than the 3.3 core baseline
+enum class GLFeature
+{
+	BufferStorage,		// ARB_buffer_storage or GL 4.4: persistently mapped streaming buffers
+	MultiDrawIndirect,	// ARB_multi_draw_indirect or GL 4.3: many draws in one call
+	TextureStorage,		// ARB_texture_storage or GL 4.2: immutable textures, allocated once
+	DirectStateAccess,	// ARB_direct_state_access or GL 4.5: create and set up objects without binding
+	Count
+};
+
+// How StreamBuffer gets data to the GPU
+enum class StreamPath
+{
+	PersistentMapped,	// written through a pointer mapped once, fenced per frame
+	MapRange,			// glMapBufferRange unsynchronized, fenced per frame
+	SubData				// glBufferSubData, orphaning the buffer when it wraps
+};
+
+// How allocateTexture2D creates textures
+enum class TexturePath
+{
+	DirectStateAccess,	// glCreateTextures + glTextureStorage2D, no binds
+	TextureStorage,		// glTexStorage2D
+	TexImage			// glTexImage2D per level
+};
+
+// How RenderQueue issues runs of draws that share all state
+enum class DrawPath
+{
+	MultiDrawIndirect,	// one glMultiDraw*Indirect per run
+	Individual			// one glDraw* per packet
+};
+
+struct GLCapabilities
+{
+	int major, minor;
+	std::string renderer;
+	bool supported[(int)GLFeature::Count];	// offered by the context
+	bool enabled[(int)GLFeature::Count];	// supported and not forced off
+	StreamPath streamPath;
+	TexturePath texturePath;
+	DrawPath drawPath;
+};
+
+// Queries the current context once (version and glad's extension flags, so glad must be
+// loaded) and selects a path per task. Later calls return the same result until
+// resetCapabilities(), e.g. after making a different context current.
+const GLCapabilities& glCapabilities();
+void resetCapabilities();
+
+// Turns a feature off so its fallback is used, as if the driver lacked it. Takes effect
+// for objects created afterwards.
+void forceFallback(GLFeature feature, bool off = true);
+// A comma separated list for the command line, e.g. "buffer_storage,dsa"; "all" turns off
+// every feature. Returns false on an unknown name.
+bool forceFallbacks(const std::string& list);
+
+const char* featureName(GLFeature feature);
+const char* streamPathName(StreamPath path);
+const char* texturePathName(TexturePath path);
+const char* drawPathName(DrawPath path);
+// Prints the context and the selected paths
+void logCapabilities();
+
+// A 2D texture with 'levels' levels, its filters and wrap mode set, through the selected
+// path. 'format' and 'type' are only used by the glTexImage2D fallback. Leaves the
+// GL_TEXTURE_2D binding as it was.
+GLuint allocateTexture2D(GLenum internalFormat, int width, int height, int levels, GLenum format, GLenum type,
+	GLint filter = GL_LINEAR, GLint wrap = GL_CLAMP_TO_EDGE);
+
+// Every streaming, texture and draw path the context supports, side by side
+void runCapabilityBenchmark();
+
+#endif
@@ -0,0 +1,1254 @@
+#include "GLTrace.h"
+#include "MappedFile.h"
+#include "Shader.h"
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Every GL function the project calls, with one character per parameter saying what the
+// recorder stores and how replay translates it:
+//   v          plain value (enum, integer, float, boolean)
+//   o          pointer used as an offset into a bound buffer (vertex attributes, indices)
+//   b t a f r  buffer, texture, vertex array, framebuffer, renderbuffer name
+//   p s q      program, shader, query name
+//   B T A F R Q  array of names of that kind, the preceding argument is the count
+//   l          uniform location in the program in use
+//   g          sync object
+//   d          client memory the call reads, size worked out from the other arguments
+//   i          texel data, from client memory or an offset into the GL_PIXEL_UNPACK_BUFFER
+//   w          memory the call writes (queries, glReadPixels), replayed into scratch memory
+//   c          null-terminated string
+//   S L        glShaderSource strings and their lengths
+// and one for the result: '-' ignored, 'p'/'s' creates a program/shader, 'g' a sync,
+// 'l' a uniform location, 'm' a buffer mapping, '*' the name array is output (glGen*).
+// Adding a function here is all it takes to trace it.
+#define GL_TRACE_FUNCTIONS(X) \
+	X(ActiveTexture, '-', "v") \
+	X(AttachShader, '-', "ps") \
+	X(BindBuffer, '-', "vb") \
+	X(BindFramebuffer, '-', "vf") \
+	X(BindRenderbuffer, '-', "vr") \
+	X(BindTexture, '-', "vt") \
+	X(BindVertexArray, '-', "a") \
+	X(BlendFunc, '-', "vv") \
+	X(BlitFramebuffer, '-', "vvvvvvvvvv") \
+	X(BufferData, '-', "vvdv") \
+	X(BufferStorage, '-', "vvdv") \
+	X(BufferSubData, '-', "vvvd") \
+	X(CheckFramebufferStatus, '-', "v") \
+	X(Clear, '-', "v") \
+	X(ClearColor, '-', "vvvv") \
+	X(ClearDepth, '-', "v") \
+	X(ClearStencil, '-', "v") \
+	X(ClientWaitSync, '-', "gvv") \
+	X(ColorMask, '-', "vvvv") \
+	X(CompileShader, '-', "s") \
+	X(CompressedTexImage2D, '-', "vvvvvvvi") \
+	X(CopyTexSubImage3D, '-', "vvvvvvvvv") \
+	X(CreateProgram, 'p', "") \
+	X(CreateShader, 's', "v") \
+	X(CreateTextures, '*', "vvT") \
+	X(CullFace, '-', "v") \
+	X(DeleteBuffers, '-', "vB") \
+	X(DeleteFramebuffers, '-', "vF") \
+	X(DeleteProgram, '-', "p") \
+	X(DeleteQueries, '-', "vQ") \
+	X(DeleteRenderbuffers, '-', "vR") \
+	X(DeleteShader, '-', "s") \
+	X(DeleteSync, '-', "g") \
+	X(DeleteTextures, '-', "vT") \
+	X(DeleteVertexArrays, '-', "vA") \
+	X(DepthFunc, '-', "v") \
+	X(DepthMask, '-', "v") \
+	X(Disable, '-', "v") \
+	X(DisableVertexAttribArray, '-', "v") \
+	X(DrawArrays, '-', "vvv") \
+	X(DrawArraysInstanced, '-', "vvvv") \
+	X(DrawBuffer, '-', "v") \
+	X(DrawBuffers, '-', "vd") \
+	X(DrawElements, '-', "vvvo") \
+	X(DrawElementsInstanced, '-', "vvvov") \
+	X(Enable, '-', "v") \
+	X(EnableVertexAttribArray, '-', "v") \
+	X(FenceSync, 'g', "vv") \
+	X(Finish, '-', "") \
+	X(Flush, '-', "") \
+	X(FramebufferRenderbuffer, '-', "vvvr") \
+	X(FramebufferTexture2D, '-', "vvvtv") \
+	X(FramebufferTextureLayer, '-', "vvtvv") \
+	X(GenBuffers, '*', "vB") \
+	X(GenFramebuffers, '*', "vF") \
+	X(GenQueries, '*', "vQ") \
+	X(GenRenderbuffers, '*', "vR") \
+	X(GenTextures, '*', "vT") \
+	X(GenVertexArrays, '*', "vA") \
+	X(GenerateMipmap, '-', "v") \
+	X(GetError, '-', "") \
+	X(GetIntegerv, '-', "vw") \
+	X(GetProgramInfoLog, '-', "pvww") \
+	X(GetProgramiv, '-', "pvw") \
+	X(GetQueryObjectiv, '-', "qvw") \
+	X(GetQueryObjectui64v, '-', "qvw") \
+	X(GetShaderInfoLog, '-', "svww") \
+	X(GetShaderiv, '-', "svw") \
+	X(GetString, '-', "v") \
+	X(GetStringi, '-', "vv") \
+	X(GetUniformLocation, 'l', "pc") \
+	X(InvalidateFramebuffer, '-', "vvd") \
+	X(LinkProgram, '-', "p") \
+	X(MapBufferRange, 'm', "vvvv") \
+	X(MultiDrawArraysIndirect, '-', "vovv") \
+	X(MultiDrawElementsIndirect, '-', "vvovv") \
+	X(PixelStorei, '-', "vv") \
+	X(QueryCounter, '-', "qv") \
+	X(ReadBuffer, '-', "v") \
+	X(ReadPixels, '-', "vvvvvvw") \
+	X(RenderbufferStorage, '-', "vvvv") \
+	X(Scissor, '-', "vvvv") \
+	X(ShaderSource, '-', "svSL") \
+	X(TexImage2D, '-', "vvvvvvvvi") \
+	X(TexImage3D, '-', "vvvvvvvvvi") \
+	X(TexParameteri, '-', "vvv") \
+	X(TexParameteriv, '-', "vvd") \
+	X(TexStorage2D, '-', "vvvvv") \
+	X(TexSubImage2D, '-', "vvvvvvvvi") \
+	X(TexSubImage3D, '-', "vvvvvvvvvvi") \
+	X(TextureParameteri, '-', "tvv") \
+	X(TextureStorage2D, '-', "tvvvv") \
+	X(TextureSubImage2D, '-', "tvvvvvvvi") \
+	X(Uniform1f, '-', "lv") \
+	X(Uniform1i, '-', "lv") \
+	X(Uniform2f, '-', "lvv") \
+	X(Uniform3f, '-', "lvvv") \
+	X(Uniform3fv, '-', "lvd") \
+	X(Uniform4f, '-', "lvvvv") \
+	X(Uniform4fv, '-', "lvd") \
+	X(UniformMatrix3fv, '-', "lvvd") \
+	X(UniformMatrix4fv, '-', "lvvd") \
+	X(UnmapBuffer, '-', "v") \
+	X(UseProgram, '-', "p") \
+	X(VertexAttribDivisor, '-', "vv") \
+	X(VertexAttribIPointer, '-', "vvvvo") \
+	X(VertexAttribPointer, '-', "vvvvvo") \
+	X(Viewport, '-', "vvvv")
+
+enum TraceFunction
+{
+#define TRACE_ENUM(name, result, kinds) trace##name,
+	GL_TRACE_FUNCTIONS(TRACE_ENUM)
+#undef TRACE_ENUM
+	traceFunctionCount
+};
+
+static const uint32_t traceMagic = 0x54474C4E;	// "NGLT"
+static const uint32_t traceVersion = 1;
+static const int maxTraceArguments = 12;
+static const size_t traceFlushSize = 1 << 20;
+
+// Object kinds with a name table in the replayer, by their kind character
+static const char objectKinds[] = "btafrpsq";
+static const int objectKindCount = sizeof(objectKinds) - 1;
+
+static int objectKind(char kind) {
+	const char* found = strchr(objectKinds, kind >= 'A' && kind <= 'Z' ? kind - 'A' + 'a' : kind);
+	return found ? (int)(found - objectKinds) : -1;
+}
+
+// Arguments travel as 64-bit values: integers zero-extended from their own width (so -1
+// stays a 5 byte varint), floats as their bits, pointers as addresses
+template <typename T>
+static typename std::enable_if<std::is_integral<T>::value, uint64_t>::type encodeArg(T value) {
+	return (uint64_t)(typename std::make_unsigned<T>::type)value;
+}
+
+static uint64_t encodeArg(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+static uint64_t encodeArg(double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+template <typename T>
+static uint64_t encodeArg(T* pointer) {
+	return (uint64_t)(uintptr_t)pointer;
+}
+
+template <typename T>
+struct ArgDecoder
+{
+	static T decode(uint64_t value) { return (T)value; }
+};
+
+template <>
+struct ArgDecoder<float>
+{
+	static float decode(uint64_t value) {
+		uint32_t bits = (uint32_t)value;
+		float result;
+		memcpy(&result, &bits, sizeof(result));
+		return result;
+	}
+};
+
+template <>
+struct ArgDecoder<double>
+{
+	static double decode(uint64_t value) {
+		double result;
+		memcpy(&result, &value, sizeof(result));
+		return result;
+	}
+};
+
+template <typename T>
+struct ArgDecoder<T*>
+{
+	static T* decode(uint64_t value) { return reinterpret_cast<T*>((uintptr_t)value); }
+};
+
+// Unpack/pack state and buffer bindings that decide how much texel memory a call touches.
+// Kept by the recorder and again by the loader, which walks the same stream.
+struct PixelStoreState
+{
+	GLint unpackAlignment, unpackRowLength, unpackImageHeight;
+	GLint packAlignment, packRowLength;
+	GLuint unpackBuffer, packBuffer;
+
+	PixelStoreState()
+		: unpackAlignment(4), unpackRowLength(0), unpackImageHeight(0), packAlignment(4), packRowLength(0),
+		unpackBuffer(0), packBuffer(0) {
+	}
+
+	void update(int function, const uint64_t* args) {
+		if (function == tracePixelStorei) {
+			GLint value = (GLint)args[1];
+			switch ((GLenum)args[0]) {
+			case GL_UNPACK_ALIGNMENT: unpackAlignment = value; break;
+			case GL_UNPACK_ROW_LENGTH: unpackRowLength = value; break;
+			case GL_UNPACK_IMAGE_HEIGHT: unpackImageHeight = value; break;
+			case GL_PACK_ALIGNMENT: packAlignment = value; break;
+			case GL_PACK_ROW_LENGTH: packRowLength = value; break;
+			}
+		}
+		else if (function == traceBindBuffer) {
+			if ((GLenum)args[0] == GL_PIXEL_UNPACK_BUFFER)
+				unpackBuffer = (GLuint)args[1];
+			else if ((GLenum)args[0] == GL_PIXEL_PACK_BUFFER)
+				packBuffer = (GLuint)args[1];
+		}
+	}
+};
+
+// Bytes GL reads or writes for a width x height x depth image with the given row padding
+static size_t imageSize(uint64_t width, uint64_t height, uint64_t depth, uint64_t format, uint64_t type,
+	GLint alignment, GLint rowLength, GLint imageHeight) {
+	GLsizei w = (GLsizei)width, h = (GLsizei)height, d = (GLsizei)depth;
+	if (w <= 0 || h <= 0 || d <= 0)
+		return 0;
+
+	size_t components = 4;
+	switch ((GLenum)format) {
+	case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+		components = 1;
+		break;
+	case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+		components = 2;
+		break;
+	case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+		components = 3;
+		break;
+	}
+	size_t pixelSize;
+	switch ((GLenum)type) {
+	case GL_UNSIGNED_BYTE: case GL_BYTE:
+		pixelSize = components;
+		break;
+	case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+		pixelSize = components * 2;
+		break;
+	case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV: case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+		pixelSize = 2;
+		break;
+	case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+		pixelSize = 4;
+		break;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+		pixelSize = 8;
+		break;
+	default:	// GL_FLOAT, GL_INT, GL_UNSIGNED_INT
+		pixelSize = components * 4;
+		break;
+	}
+
+	size_t align = (size_t)std::max(alignment, 1);
+	size_t rowBytes = ((rowLength > 0 ? (size_t)rowLength : (size_t)w) * pixelSize + align - 1) / align * align;
+	size_t rows = imageHeight > 0 ? (size_t)imageHeight : (size_t)h;
+	// the last row of the last image is not padded
+	return rowBytes * (rows * (d - 1) + (h - 1)) + (size_t)w * pixelSize;
+}
+
+// Size of the memory behind 'd', 'i' and 'w' arguments
+static size_t dataSize(int function, int argument, const uint64_t* args, const PixelStoreState& pixels) {
+	switch (function) {
+	case traceBufferData: case traceBufferStorage:
+		return (size_t)args[1];
+	case traceBufferSubData:
+		return (size_t)args[2];
+	case traceCompressedTexImage2D:
+		return (uint32_t)args[6];
+	case traceDrawBuffers:
+		return (uint32_t)args[0] * sizeof(GLenum);
+	case traceInvalidateFramebuffer:
+		return (uint32_t)args[1] * sizeof(GLenum);
+	case traceTexParameteriv:
+		return ((GLenum)args[1] == GL_TEXTURE_SWIZZLE_RGBA || (GLenum)args[1] == GL_TEXTURE_BORDER_COLOR ? 4 : 1) * sizeof(GLint);
+	case traceUniform3fv:
+		return (uint32_t)args[1] * 3 * sizeof(GLfloat);
+	case traceUniform4fv:
+		return (uint32_t)args[1] * 4 * sizeof(GLfloat);
+	case traceUniformMatrix3fv:
+		return (uint32_t)args[1] * 9 * sizeof(GLfloat);
+	case traceUniformMatrix4fv:
+		return (uint32_t)args[1] * 16 * sizeof(GLfloat);
+	case traceTexImage2D:
+		return imageSize(args[3], args[4], 1, args[6], args[7], pixels.unpackAlignment, pixels.unpackRowLength, 0);
+	case traceTexSubImage2D: case traceTextureSubImage2D:
+		return imageSize(args[4], args[5], 1, args[6], args[7], pixels.unpackAlignment, pixels.unpackRowLength, 0);
+	case traceTexImage3D:
+		return imageSize(args[3], args[4], args[5], args[7], args[8], pixels.unpackAlignment, pixels.unpackRowLength,
+			pixels.unpackImageHeight);
+	case traceTexSubImage3D:
+		return imageSize(args[5], args[6], args[7], args[8], args[9], pixels.unpackAlignment, pixels.unpackRowLength,
+			pixels.unpackImageHeight);
+	case traceReadPixels:
+		return imageSize(args[2], args[3], 1, args[4], args[5], pixels.packAlignment, pixels.packRowLength, 0);
+	case traceGetIntegerv:
+		return 16 * sizeof(GLint);
+	case traceGetShaderiv: case traceGetProgramiv:
+		return 4 * sizeof(GLint);
+	case traceGetQueryObjectiv:
+		return sizeof(GLint);
+	case traceGetQueryObjectui64v:
+		return sizeof(GLuint64);
+	case traceGetShaderInfoLog: case traceGetProgramInfoLog:
+		return argument == 2 ? sizeof(GLsizei) : (size_t)(uint32_t)args[1];
+	}
+	return 0;
+}
+
+struct BufferMapping
+{
+	const unsigned char* pointer;
+	size_t length;
+	GLbitfield access;
+};
+
+// Output side of a recording; only one exists at a time since the wrappers are global
+struct TraceWriter
+{
+	std::string path;
+	std::ofstream file;
+	std::vector<unsigned char> buffer;
+	PixelStoreState pixels;
+	std::unordered_map<GLenum, BufferMapping> mappings;	// by target, written back at glUnmapBuffer
+	size_t calls, frames, bytes;
+
+	TraceWriter() : calls(0), frames(0), bytes(0) { buffer.reserve(traceFlushSize + 4096); }
+
+	void putVarint(uint64_t value) {
+		while (value >= 0x80) {
+			buffer.push_back((unsigned char)(value | 0x80));
+			value >>= 7;
+		}
+		buffer.push_back((unsigned char)value);
+	}
+
+	void putBytes(const void* data, size_t size) {
+		const unsigned char* bytes = (const unsigned char*)data;
+		buffer.insert(buffer.end(), bytes, bytes + size);
+		if (buffer.size() >= traceFlushSize)
+			flush();
+	}
+
+	// 0 for a null pointer, otherwise size + 2 and the bytes; 1 is an offset into a buffer
+	void putData(const void* data, size_t size) {
+		if (data == nullptr) {
+			putVarint(0);
+			return;
+		}
+		putVarint(size + 2);
+		putBytes(data, size);
+	}
+
+	void flush() {
+		file.write((const char*)buffer.data(), buffer.size());
+		bytes += buffer.size();
+		buffer.clear();
+	}
+
+	void writeCall(int function, const uint64_t* args, uint64_t result);
+};
+
+static TraceWriter* traceWriter = nullptr;
+
+template <typename F>
+struct TraceArity;
+
+template <typename R, typename... Args>
+struct TraceArity<R (APIENTRYP)(Args...)>
+{
+	enum { value = sizeof...(Args) };
+};
+
+// The wrapper installed into a glad pointer while recording and the thunk replay calls
+// through the same pointer with decoded arguments
+template <int Function, typename F, F* Slot>
+struct TracedFunction;
+
+template <int Function, typename R, typename... Args, R (APIENTRYP* Slot)(Args...)>
+struct TracedFunction<Function, R (APIENTRYP)(Args...), Slot>
+{
+	typedef R (APIENTRYP Pointer)(Args...);
+	static Pointer driver;
+
+	static void install() {
+		driver = *Slot;
+		if (driver)
+			*Slot = &record;
+	}
+
+	static void uninstall() {
+		if (driver)
+			*Slot = driver;
+	}
+
+	static R APIENTRY record(Args... args) {
+		const uint64_t encoded[sizeof...(Args) + 1] = { encodeArg(args)... };
+		return forward(encoded, std::is_void<R>(), args...);
+	}
+
+	// Written after the driver call: glGen* fill their array and mapped pointers exist only then
+	static R forward(const uint64_t* encoded, std::false_type, Args... args) {
+		R result = driver(args...);
+		traceWriter->writeCall(Function, encoded, encodeArg(result));
+		return result;
+	}
+
+	static void forward(const uint64_t* encoded, std::true_type, Args... args) {
+		driver(args...);
+		traceWriter->writeCall(Function, encoded, 0);
+	}
+
+	static uint64_t replay(const uint64_t* args) {
+		return invoke(args, std::is_void<R>(), std::index_sequence_for<Args...>());
+	}
+
+	template <size_t... I>
+	static uint64_t invoke(const uint64_t* args, std::false_type, std::index_sequence<I...>) {
+		return encodeArg((*Slot)(ArgDecoder<Args>::decode(args[I])...));
+	}
+
+	template <size_t... I>
+	static uint64_t invoke(const uint64_t* args, std::true_type, std::index_sequence<I...>) {
+		(*Slot)(ArgDecoder<Args>::decode(args[I])...);
+		return 0;
+	}
+};
+
+template <int Function, typename R, typename... Args, R (APIENTRYP* Slot)(Args...)>
+typename TracedFunction<Function, R (APIENTRYP)(Args...), Slot>::Pointer
+	TracedFunction<Function, R (APIENTRYP)(Args...), Slot>::driver = nullptr;
+
+#define TRACE_CHECK(name, result, kinds) \
+	static_assert(sizeof(kinds) - 1 == TraceArity<decltype(glad_gl##name)>::value, "gl" #name ": one kind per parameter"); \
+	static_assert(sizeof(kinds) - 1 <= maxTraceArguments, "gl" #name ": too many parameters");
+GL_TRACE_FUNCTIONS(TRACE_CHECK)
+#undef TRACE_CHECK
+
+struct TraceFunctionInfo
+{
+	const char* name;
+	char result;
+	const char* kinds;
+	void (*install)();
+	void (*uninstall)();
+	uint64_t (*replay)(const uint64_t* args);
+};
+
+#define TRACE_INFO(name, result, kinds) \
+	{ "gl" #name, result, kinds, \
+		&TracedFunction<trace##name, decltype(glad_gl##name), &glad_gl##name>::install, \
+		&TracedFunction<trace##name, decltype(glad_gl##name), &glad_gl##name>::uninstall, \
+		&TracedFunction<trace##name, decltype(glad_gl##name), &glad_gl##name>::replay },
+static const TraceFunctionInfo traceFunctions[] = {
+	GL_TRACE_FUNCTIONS(TRACE_INFO)
+};
+#undef TRACE_INFO
+
+void TraceWriter::writeCall(int function, const uint64_t* args, uint64_t result) {
+	const TraceFunctionInfo& info = traceFunctions[function];
+	putVarint((uint64_t)function);
+	for (int i = 0; info.kinds[i]; i++) {
+		const uint64_t value = args[i];
+		const void* pointer = (const void*)(uintptr_t)value;
+		switch (info.kinds[i]) {
+		case 'd':
+			putData(pointer, dataSize(function, i, args, pixels));
+			break;
+		case 'i':
+			if (pixels.unpackBuffer != 0) {
+				putVarint(1);
+				putVarint(value);
+			}
+			else {
+				putData(pointer, dataSize(function, i, args, pixels));
+			}
+			break;
+		case 'w':
+			// the output itself is not needed, only where it goes
+			if (function == traceReadPixels && pixels.packBuffer != 0) {
+				putVarint(1);
+				putVarint(value);
+			}
+			else {
+				putVarint(0);
+			}
+			break;
+		case 'c': {
+			size_t length = pointer ? strlen((const char*)pointer) : 0;
+			putVarint(length);
+			putBytes(pointer, length);
+			break;
+		}
+		case 'S': {
+			const GLchar* const* strings = (const GLchar* const*)pointer;
+			const GLint* lengths = (const GLint*)(uintptr_t)args[i + 1];
+			for (GLsizei s = 0; s < (GLsizei)args[i - 1]; s++) {
+				size_t length = lengths && lengths[s] >= 0 ? (size_t)lengths[s] : strlen(strings[s]);
+				putVarint(length);
+				putBytes(strings[s], length);
+			}
+			break;
+		}
+		case 'L':
+			break;
+		case 'B': case 'T': case 'A': case 'F': case 'R': case 'Q': {
+			const GLuint* names = (const GLuint*)pointer;
+			for (GLsizei n = 0; n < (GLsizei)args[i - 1]; n++)
+				putVarint(names[n]);
+			break;
+		}
+		default:
+			putVarint(value);
+			break;
+		}
+	}
+
+	if (info.result == 'p' || info.result == 's' || info.result == 'g' || info.result == 'l')
+		putVarint(result);
+	else if (info.result == 'm' && result != 0)
+		mappings[(GLenum)args[0]] = { (const unsigned char*)(uintptr_t)result, (size_t)args[2], (GLbitfield)args[3] };
+
+	if (function == traceUnmapBuffer) {
+		// whatever the application wrote through the mapping, as of the unmap
+		auto mapping = mappings.find((GLenum)args[0]);
+		if (mapping != mappings.end() && (mapping->second.access & GL_MAP_WRITE_BIT))
+			putData(mapping->second.pointer, mapping->second.length);
+		else
+			putVarint(0);
+		if (mapping != mappings.end())
+			mappings.erase(mapping);
+	}
+
+	pixels.update(function, args);
+	calls++;
+	if (buffer.size() >= traceFlushSize)
+		flush();
+}
+
+bool startTrace(const char* path) {
+	if (traceWriter) {
+		std::cout << "ERROR::GLTRACE::ALREADY_RECORDING\n";
+		return false;
+	}
+	TraceWriter* writer = new TraceWriter();
+	writer->path = path;
+	writer->file.open(path, std::ios::binary);
+	if (!writer->file) {
+		std::cout << "ERROR::GLTRACE::FILE_NOT_WRITTEN: " << path << "\n";
+		delete writer;
+		return false;
+	}
+
+	// state the stream starts from, re-issued through the wrappers below so replay sets it up too
+	GLint viewport[4], unpackAlignment, unpackRowLength, unpackImageHeight, packAlignment, packRowLength;
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
+	glGetIntegerv(GL_UNPACK_ROW_LENGTH, &unpackRowLength);
+	glGetIntegerv(GL_UNPACK_IMAGE_HEIGHT, &unpackImageHeight);
+	glGetIntegerv(GL_PACK_ALIGNMENT, &packAlignment);
+	glGetIntegerv(GL_PACK_ROW_LENGTH, &packRowLength);
+
+	writer->putBytes(&traceMagic, sizeof(traceMagic));
+	writer->putVarint(traceVersion);
+	writer->putVarint((uint64_t)viewport[2]);
+	writer->putVarint((uint64_t)viewport[3]);
+	writer->putVarint(traceFunctionCount);
+	for (const TraceFunctionInfo& info : traceFunctions) {
+		size_t length = strlen(info.name);
+		writer->putVarint(length);
+		writer->putBytes(info.name, length);
+	}
+
+	traceWriter = writer;
+	for (const TraceFunctionInfo& info : traceFunctions)
+		info.install();
+
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, unpackRowLength);
+	glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, unpackImageHeight);
+	glPixelStorei(GL_PACK_ALIGNMENT, packAlignment);
+	glPixelStorei(GL_PACK_ROW_LENGTH, packRowLength);
+	return true;
+}
+
+void endTraceFrame() {
+	if (!traceWriter)
+		return;
+	traceWriter->putVarint(traceFunctionCount);
+	traceWriter->frames++;
+}
+
+void stopTrace() {
+	if (!traceWriter)
+		return;
+	for (const TraceFunctionInfo& info : traceFunctions)
+		info.uninstall();
+
+	TraceWriter* writer = traceWriter;
+	traceWriter = nullptr;
+	writer->flush();
+	writer->file.close();
+	std::cout << "Trace: " << writer->calls << " calls, " << writer->frames << " frames, "
+		<< writer->bytes / 1024 << " KB written to " << writer->path << "\n";
+	delete writer;
+}
+
+bool traceActive() {
+	return traceWriter != nullptr;
+}
+
+// A trace decoded once into flat arrays, so replay does no parsing
+struct TraceCommand
+{
+	uint16_t function;	// index into traceFunctions, traceFunctionCount for a frame boundary
+	uint32_t firstArg;
+	uint64_t result;	// recorded result of calls that create something
+	const unsigned char* extra;	// what was written through a mapping, at glUnmapBuffer
+	size_t extraSize;
+};
+
+struct LoadedTrace
+{
+	MappedFile file;
+	int width, height;
+	std::vector<TraceCommand> commands;
+	std::vector<uint64_t> args;	// arguments as passed, payloads pointing into the file
+	std::vector<GLuint> names;		// name arrays
+	std::vector<char> strings;		// 'c' and 'S' strings, null-terminated
+	std::vector<const char*> stringLists;	// 'S' arrays
+	std::vector<GLint> lengths;		// 'L' arrays
+	std::vector<unsigned char> scratch;	// where 'w' arguments write
+	std::vector<size_t> counts;	// calls per function
+	size_t calls, frames, payloadBytes;
+
+	LoadedTrace() : width(0), height(0), calls(0), frames(0), payloadBytes(0) {}
+};
+
+struct TraceReader
+{
+	const unsigned char* at;
+	const unsigned char* end;
+	bool failed;
+
+	uint64_t varint() {
+		uint64_t value = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			if (at >= end) {
+				failed = true;
+				return 0;
+			}
+			unsigned char byte = *at++;
+			value |= (uint64_t)(byte & 0x7F) << shift;
+			if (!(byte & 0x80))
+				return value;
+		}
+		failed = true;
+		return 0;
+	}
+
+	const unsigned char* bytes(uint64_t size) {
+		if (size > (uint64_t)(end - at)) {
+			failed = true;
+			return nullptr;
+		}
+		const unsigned char* data = at;
+		at += size;
+		return data;
+	}
+};
+
+// Payload pointers into vectors that are still growing, resolved once decoding is done
+struct TraceFixup
+{
+	size_t arg;
+	char storage;	// 'n' names, 'c' strings, 'S' string lists, 'L' lengths, 'w' scratch
+	size_t offset;
+};
+
+static bool loadTrace(const char* path, LoadedTrace& trace) {
+	if (!trace.file.open(path)) {
+		std::cout << "ERROR::GLTRACE::FILE_NOT_SUCCESFULLY_READ: " << path << "\n";
+		return false;
+	}
+	TraceReader reader = { trace.file.data(), trace.file.data() + trace.file.size(), false };
+	uint32_t magic = 0;
+	const unsigned char* header = reader.bytes(sizeof(magic));
+	if (header)
+		memcpy(&magic, header, sizeof(magic));
+	if (magic != traceMagic || reader.varint() != traceVersion) {
+		std::cout << "ERROR::GLTRACE::NOT_A_TRACE: " << path << "\n";
+		return false;
+	}
+	trace.width = (int)reader.varint();
+	trace.height = (int)reader.varint();
+
+	// ids are resolved by name, so traces survive additions to the function table
+	uint64_t fileFunctions = reader.varint();
+	if (reader.failed || fileFunctions > 0xFFFF) {
+		std::cout << "ERROR::GLTRACE::NOT_A_TRACE: " << path << "\n";
+		return false;
+	}
+	std::vector<uint16_t> functionIds((size_t)fileFunctions, (uint16_t)traceFunctionCount);
+	for (uint64_t id = 0; id < fileFunctions; id++) {
+		uint64_t length = reader.varint();
+		const unsigned char* name = reader.bytes(length);
+		if (!name)
+			break;
+		std::string functionName((const char*)name, (size_t)length);
+		for (int f = 0; f < traceFunctionCount; f++) {
+			if (functionName == traceFunctions[f].name)
+				functionIds[(size_t)id] = (uint16_t)f;
+		}
+	}
+
+	PixelStoreState pixels;
+	std::vector<TraceFixup> fixups;
+	size_t scratchSize = 1;
+	trace.counts.assign(traceFunctionCount, 0);
+	while (!reader.failed && reader.at < reader.end) {
+		uint64_t id = reader.varint();
+		TraceCommand command = { (uint16_t)traceFunctionCount, (uint32_t)trace.args.size(), 0, nullptr, 0 };
+		if (id == fileFunctions) {
+			trace.commands.push_back(command);
+			trace.frames++;
+			continue;
+		}
+		if (id > fileFunctions || reader.failed)
+			break;
+		int function = functionIds[(size_t)id];
+		if (function == traceFunctionCount) {
+			std::cout << "ERROR::GLTRACE::UNKNOWN_FUNCTION: call " << id << " in " << path << "\n";
+			return false;
+		}
+		command.function = (uint16_t)function;
+
+		const TraceFunctionInfo& info = traceFunctions[function];
+		const size_t first = trace.args.size();
+		size_t lengthsOffset = 0;
+		for (int i = 0; info.kinds[i]; i++) {
+			uint64_t value = 0;
+			switch (info.kinds[i]) {
+			case 'd': case 'i': {
+				uint64_t tag = reader.varint();
+				if (tag == 1) {
+					value = reader.varint();
+				}
+				else if (tag >= 2) {
+					value = (uint64_t)(uintptr_t)reader.bytes(tag - 2);
+					trace.payloadBytes += (size_t)(tag - 2);
+				}
+				break;
+			}
+			case 'w':
+				if (reader.varint() == 1) {
+					value = reader.varint();
+				}
+				else {
+					scratchSize = std::max(scratchSize, dataSize(function, i, trace.args.data() + first, pixels));
+					fixups.push_back({ trace.args.size(), 'w', 0 });
+				}
+				break;
+			case 'c': {
+				uint64_t length = reader.varint();
+				const unsigned char* text = reader.bytes(length);
+				fixups.push_back({ trace.args.size(), 'c', trace.strings.size() });
+				if (text)
+					trace.strings.insert(trace.strings.end(), text, text + length);
+				trace.strings.push_back('\0');
+				break;
+			}
+			case 'S': {
+				fixups.push_back({ trace.args.size(), 'S', trace.stringLists.size() });
+				lengthsOffset = trace.lengths.size();
+				for (GLsizei s = 0; s < (GLsizei)trace.args[first + i - 1] && !reader.failed; s++) {
+					uint64_t length = reader.varint();
+					const unsigned char* text = reader.bytes(length);
+					// an offset for now, made a pointer once 'strings' stops moving
+					trace.stringLists.push_back((const char*)(uintptr_t)trace.strings.size());
+					trace.lengths.push_back((GLint)length);
+					if (text)
+						trace.strings.insert(trace.strings.end(), text, text + length);
+					trace.strings.push_back('\0');
+				}
+				break;
+			}
+			case 'L':
+				fixups.push_back({ trace.args.size(), 'L', lengthsOffset });
+				break;
+			case 'B': case 'T': case 'A': case 'F': case 'R': case 'Q':
+				fixups.push_back({ trace.args.size(), 'n', trace.names.size() });
+				for (GLsizei n = 0; n < (GLsizei)trace.args[first + i - 1] && !reader.failed; n++)
+					trace.names.push_back((GLuint)reader.varint());
+				break;
+			default:
+				value = reader.varint();
+				break;
+			}
+			trace.args.push_back(value);
+		}
+
+		if (info.result == 'p' || info.result == 's' || info.result == 'g' || info.result == 'l')
+			command.result = reader.varint();
+		if (function == traceUnmapBuffer) {
+			uint64_t tag = reader.varint();
+			if (tag >= 2) {
+				command.extra = reader.bytes(tag - 2);
+				command.extraSize = (size_t)(tag - 2);
+				trace.payloadBytes += command.extraSize;
+			}
+		}
+		if (reader.failed)
+			break;
+
+		pixels.update(function, trace.args.data() + first);
+		trace.counts[function]++;
+		trace.calls++;
+		trace.commands.push_back(command);
+	}
+	if (reader.failed) {
+		std::cout << "ERROR::GLTRACE::TRUNCATED: " << path << " after " << trace.calls << " calls\n";
+		return false;
+	}
+
+	trace.scratch.resize(scratchSize);
+	for (const char*& text : trace.stringLists)
+		text = trace.strings.data() + (uintptr_t)text;
+	for (const TraceFixup& fixup : fixups) {
+		const void* pointer = nullptr;
+		switch (fixup.storage) {
+		case 'n': pointer = trace.names.data() + fixup.offset; break;
+		case 'c': pointer = trace.strings.data() + fixup.offset; break;
+		case 'S': pointer = trace.stringLists.data() + fixup.offset; break;
+		case 'L': pointer = trace.lengths.data() + fixup.offset; break;
+		case 'w': pointer = trace.scratch.data(); break;
+		}
+		trace.args[fixup.arg] = (uint64_t)(uintptr_t)pointer;
+	}
+	return true;
+}
+
+// Issues a loaded trace against the current context, translating recorded object names,
+// uniform locations and syncs into the ones this context created
+class TraceReplayer
+{
+public:
+	explicit TraceReplayer(LoadedTrace& trace) : trace(trace), program(0) {}
+
+	// One pass over the trace; submission time of each frame goes to 'frameMs'
+	void run(std::vector<double>* frameMs) {
+		auto frameStart = std::chrono::high_resolution_clock::now();
+		for (const TraceCommand& command : trace.commands) {
+			if (command.function == traceFunctionCount) {
+				auto now = std::chrono::high_resolution_clock::now();
+				if (frameMs)
+					frameMs->push_back(std::chrono::duration<double, std::milli>(now - frameStart).count());
+				frameStart = now;
+				continue;
+			}
+			execute(command);
+		}
+	}
+
+	// Deletes what the trace created and did not delete itself
+	void reset() {
+		glBindVertexArray(0);
+		glUseProgram(0);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		for (int kind = 0; kind < objectKindCount; kind++) {
+			for (GLuint name : objects[kind]) {
+				if (name == 0)
+					continue;
+				switch (objectKinds[kind]) {
+				case 'b': glDeleteBuffers(1, &name); break;
+				case 't': glDeleteTextures(1, &name); break;
+				case 'a': glDeleteVertexArrays(1, &name); break;
+				case 'f': glDeleteFramebuffers(1, &name); break;
+				case 'r': glDeleteRenderbuffers(1, &name); break;
+				case 'p': glDeleteProgram(name); break;
+				case 's': glDeleteShader(name); break;
+				case 'q': glDeleteQueries(1, &name); break;
+				}
+			}
+			objects[kind].clear();
+		}
+		for (auto& sync : syncs)
+			glDeleteSync(sync.second);
+		syncs.clear();
+		locations.clear();
+		mappings.clear();
+		program = 0;
+	}
+
+private:
+	LoadedTrace& trace;
+	std::vector<GLuint> objects[objectKindCount];	// recorded name -> replayed name, 0 when unknown
+	std::unordered_map<uint64_t, GLint> locations;	// recorded program << 32 | recorded location
+	std::unordered_map<uint64_t, GLsync> syncs;
+	std::unordered_map<GLenum, void*> mappings;	// by target
+	std::vector<GLuint> nameScratch;
+	GLuint program;	// recorded name of the program in use
+
+	// Names from before the trace started are passed through unchanged
+	GLuint translate(int kind, GLuint name) const {
+		return name < objects[kind].size() && objects[kind][name] != 0 ? objects[kind][name] : name;
+	}
+
+	void bind(int kind, GLuint recorded, GLuint replayed) {
+		if (recorded >= objects[kind].size())
+			objects[kind].resize(recorded + 1, 0);
+		objects[kind][recorded] = replayed;
+	}
+
+	GLint location(GLint recorded) const {
+		if (recorded < 0)
+			return recorded;
+		auto found = locations.find((uint64_t)program << 32 | (uint32_t)recorded);
+		return found != locations.end() ? found->second : recorded;
+	}
+
+	void execute(const TraceCommand& command) {
+		const TraceFunctionInfo& info = traceFunctions[command.function];
+		const uint64_t* recorded = trace.args.data() + command.firstArg;
+		uint64_t actual[maxTraceArguments];
+		const GLuint* recordedNames = nullptr;
+		int namesKind = -1;
+		GLsizei namesCount = 0;
+		for (int i = 0; info.kinds[i]; i++) {
+			uint64_t value = recorded[i];
+			switch (info.kinds[i]) {
+			case 'b': case 't': case 'a': case 'f': case 'r': case 'p': case 's': case 'q':
+				value = translate(objectKind(info.kinds[i]), (GLuint)value);
+				break;
+			case 'B': case 'T': case 'A': case 'F': case 'R': case 'Q': {
+				GLsizei count = (GLsizei)recorded[i - 1];
+				recordedNames = (const GLuint*)(uintptr_t)value;
+				namesKind = objectKind(info.kinds[i]);
+				namesCount = count;
+				nameScratch.resize((size_t)std::max(count, 1));
+				if (info.result != '*') {
+					for (GLsizei n = 0; n < count; n++)
+						nameScratch[n] = translate(namesKind, recordedNames[n]);
+				}
+				value = (uint64_t)(uintptr_t)nameScratch.data();
+				break;
+			}
+			case 'l':
+				value = encodeArg(location((GLint)value));
+				break;
+			case 'g': {
+				auto sync = syncs.find(value);
+				value = sync != syncs.end() ? (uint64_t)(uintptr_t)sync->second : 0;
+				break;
+			}
+			}
+			actual[i] = value;
+		}
+
+		if (command.function == traceUnmapBuffer && command.extra) {
+			auto mapping = mappings.find((GLenum)recorded[0]);
+			if (mapping != mappings.end() && mapping->second)
+				memcpy(mapping->second, command.extra, command.extraSize);
+		}
+
+		uint64_t result = info.replay(actual);
+
+		switch (info.result) {
+		case 'p': case 's':
+			bind(objectKind(info.result), (GLuint)command.result, (GLuint)result);
+			break;
+		case 'g':
+			syncs[command.result] = (GLsync)(uintptr_t)result;
+			break;
+		case 'l':
+			locations[recorded[0] << 32 | (uint32_t)command.result] = (GLint)result;
+			break;
+		case 'm':
+			mappings[(GLenum)recorded[0]] = (void*)(uintptr_t)result;
+			break;
+		case '*':
+			for (GLsizei n = 0; n < namesCount; n++)
+				bind(namesKind, recordedNames[n], nameScratch[n]);
+			break;
+		default:
+			// glDelete* with a name array
+			if (recordedNames) {
+				for (GLsizei n = 0; n < namesCount; n++)
+					bind(namesKind, recordedNames[n], 0);
+			}
+			break;
+		}
+
+		switch (command.function) {
+		case traceUseProgram:
+			program = (GLuint)recorded[0];
+			break;
+		case traceDeleteProgram: case traceDeleteShader:
+			bind(objectKind(info.kinds[0]), (GLuint)recorded[0], 0);
+			break;
+		case traceDeleteSync:
+			syncs.erase(recorded[0]);
+			break;
+		}
+	}
+};
+
+// Replays 'loops' times and prints the timings; returns the best loop in milliseconds
+static double replayLoaded(LoadedTrace& trace, int loops) {
+	TraceReplayer replayer(trace);
+	std::vector<double> frameMs;
+	double bestMs = 1e30;
+	for (int loop = 0; loop < std::max(loops, 1); loop++) {
+		frameMs.clear();
+		auto start = std::chrono::high_resolution_clock::now();
+		replayer.run(&frameMs);
+		glFinish();
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		replayer.reset();
+		glFinish();
+
+		double frameMean = 0.0, frameMax = 0.0;
+		for (double frame : frameMs) {
+			frameMean += frame;
+			frameMax = std::max(frameMax, frame);
+		}
+		frameMean /= std::max<size_t>(frameMs.size(), 1);
+		std::cout << "  loop " << loop + 1 << ": " << std::setw(9) << ms << " ms, " << std::setw(7)
+			<< ms * 1e6 / std::max<size_t>(trace.calls, 1) << " ns/call, frame submit mean " << frameMean
+			<< " ms, max " << frameMax << " ms" << (loop == 0 ? "  (cold: compiles and uploads)" : "") << "\n";
+		if (loop > 0 || loops <= 1)
+			bestMs = std::min(bestMs, ms);
+	}
+	return bestMs;
+}
+
+bool replayTrace(const char* path, int loops) {
+	LoadedTrace trace;
+	if (!loadTrace(path, trace))
+		return false;
+
+	glfwInit();
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+	// the default framebuffer at the recorded size, so viewport-sized work matches
+	GLFWwindow* window = glfwCreateWindow(std::max(trace.width, 1), std::max(trace.height, 1), "Noob OpenGL replay", NULL, NULL);
+	if (window == NULL) {
+		std::cout << "Failed to create GLFW window\n";
+		glfwTerminate();
+		return false;
+	}
+	glfwMakeContextCurrent(window);
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		std::cout << "Failed to initialize GLAD\n";
+		glfwTerminate();
+		return false;
+	}
+
+	std::cout << std::fixed << std::setprecision(2) << path << ": " << trace.calls << " calls, " << trace.frames
+		<< " frames, " << trace.payloadBytes / 1024 << " KB of data, " << trace.width << "x" << trace.height << "\n";
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	double bestMs = replayLoaded(trace, loops);
+	std::cout << "best warm loop " << bestMs << " ms, " << bestMs * 1e6 / std::max<size_t>(trace.calls, 1) << " ns/call\n";
+
+	glfwDestroyWindow(window);
+	glfwTerminate();
+	return true;
+}
+
+bool printTraceStats(const char* path, const char* comparePath) {
+	LoadedTrace traces[2];
+	if (!loadTrace(path, traces[0]))
+		return false;
+	if (comparePath && !loadTrace(comparePath, traces[1]))
+		return false;
+
+	std::vector<int> order;
+	for (int f = 0; f < traceFunctionCount; f++) {
+		if (traces[0].counts[f] || (comparePath && traces[1].counts[f]))
+			order.push_back(f);
+	}
+	std::sort(order.begin(), order.end(), [&](int a, int b) {
+		size_t countA = std::max(traces[0].counts[a], comparePath ? traces[1].counts[a] : 0);
+		size_t countB = std::max(traces[0].counts[b], comparePath ? traces[1].counts[b] : 0);
+		return countA != countB ? countA > countB : a < b;
+	});
+
+	std::cout << std::left << std::setw(28) << "function" << std::right << std::setw(10) << "calls";
+	if (comparePath)
+		std::cout << std::setw(10) << "after" << std::setw(10) << "change";
+	std::cout << "\n";
+	auto row = [&](const char* name, size_t before, size_t after) {
+		std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << before;
+		if (comparePath)
+			std::cout << std::setw(10) << after << std::setw(10) << (long long)after - (long long)before;
+		std::cout << "\n";
+	};
+	for (int f : order)
+		row(traceFunctions[f].name, traces[0].counts[f], comparePath ? traces[1].counts[f] : 0);
+	row("total", traces[0].calls, traces[1].calls);
+	row("frames", traces[0].frames, traces[1].frames);
+
+	std::cout << std::fixed << std::setprecision(1) << "calls/frame " << (double)traces[0].calls / std::max<size_t>(traces[0].frames, 1);
+	if (comparePath)
+		std::cout << " -> " << (double)traces[1].calls / std::max<size_t>(traces[1].frames, 1);
+	std::cout << ", data " << traces[0].payloadBytes / 1024 << " KB";
+	if (comparePath)
+		std::cout << " -> " << traces[1].payloadBytes / 1024 << " KB";
+	std::cout << "\n";
+	return true;
+}
+
+static const char* traceBenchmarkVertexShader =
+	"#version 330 core\n"
+	"layout (location = 0) in vec2 aPos;\n"
+	"uniform vec4 offsetScale;\n"
+	"void main() { gl_Position = vec4(aPos * offsetScale.zw + offsetScale.xy, 0.0, 1.0); }\n";
+
+static const char* traceBenchmarkFragmentShader =
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"uniform vec4 color;\n"
+	"void main() { FragColor = color; }\n";
+
+// Small draws with a couple of uniforms each, the pattern where per-call overhead dominates
+static void traceBenchmarkWorkload(int frames, int drawsPerFrame) {
+	Shader shader = Shader::fromSource(traceBenchmarkVertexShader, traceBenchmarkFragmentShader);
+	shader.use();
+	GLint offsetScale = glGetUniformLocation(shader.ID, "offsetScale");
+	GLint color = glGetUniformLocation(shader.ID, "color");
+
+	const float triangle[] = { -1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 1.0f };
+	GLuint vao, vbo;
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &vbo);
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	for (int frame = 0; frame < frames; frame++) {
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (int draw = 0; draw < drawsPerFrame; draw++) {
+			float x = (float)(draw % 32) / 16.0f - 1.0f, y = (float)(draw / 32 % 32) / 16.0f - 1.0f;
+			const float transform[4] = { x, y, 0.03f, 0.03f };
+			const float rgba[4] = { (float)draw / drawsPerFrame, (float)frame / frames, 0.5f, 1.0f };
+			glUniform4fv(offsetScale, 1, transform);
+			glUniform4fv(color, 1, rgba);
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+		}
+		endTraceFrame();
+	}
+	glFinish();
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteBuffers(1, &vbo);
+	glDeleteProgram(shader.ID);
+}
+
+void runTraceBenchmark() {
+	const int frames = 30;
+	const int drawsPerFrame = 1000;
+	const char* path = "trace_benchmark.gltrace";
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+
+	auto timeMs = [&](bool record) {
+		double best = 1e30;
+		for (int run = 0; run < 3; run++) {
+			if (record && !startTrace(path))
+				return 0.0;
+			auto start = std::chrono::high_resolution_clock::now();
+			traceBenchmarkWorkload(frames, drawsPerFrame);
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+			if (record)
+				stopTrace();
+			best = std::min(best, ms);
+		}
+		return best;
+	};
+	traceBenchmarkWorkload(1, drawsPerFrame);	// warm up the driver's shader cache
+	double directMs = timeMs(false);
+	double recordMs = timeMs(true);
+
+	LoadedTrace trace;
+	if (!loadTrace(path, trace))
+		return;
+	double callNs = 1e6 / std::max<size_t>(trace.calls, 1);
+	std::cout << trace.calls << " calls in " << frames << " frames of " << drawsPerFrame << " draws, trace "
+		<< trace.file.size() / 1024 << " KB (" << (double)trace.file.size() / trace.calls << " bytes/call)\n";
+	std::cout << "replay:\n";
+	double replayMs = replayLoaded(trace, 5);
+	std::cout << "direct     " << std::setw(9) << directMs << " ms  " << std::setw(7) << directMs * callNs << " ns/call\n";
+	std::cout << "recording  " << std::setw(9) << recordMs << " ms  " << std::setw(7) << recordMs * callNs << " ns/call  ("
+		<< 100.0 * (recordMs / directMs - 1.0) << "% overhead)\n";
+	std::cout << "replay     " << std::setw(9) << replayMs << " ms  " << std::setw(7) << replayMs * callNs << " ns/call\n";
+
+	trace.file.close();
+	std::remove(path);
+}
@@ -0,0 +1,41 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <cstddef>
+
+// GL command stream capture and replay. While a trace is being recorded, the glad_gl*
+// pointers of every GL function the project calls point at wrappers that append the call,
+// its arguments and the client memory it reads (buffer contents, texel data, shader
+// sources, uniform values, mapped buffer writes) to a binary trace before forwarding to
+// the driver. Replay re-issues the calls as fast as possible, remapping object names,
+// uniform locations and syncs to the ones the replaying context hands out.
+//
+// Trace file layout: "NGLT" magic, version, the recorded viewport and the names of the
+// functions the call ids refer to, then per call a varint id, varint-encoded arguments,
+// payloads and the result for calls that create something. A frame boundary is a call
+// with id == function count.
+//
+// GL must only be called from the thread the trace was started on. Functions outside
+// the interception table reach the driver unrecorded.
+
+// Starts recording every GL call to 'path'; needs a current context with glad loaded.
+// Objects created before this call are not in the trace, so start right after loading GL.
+bool startTrace(const char* path);
+// Marks the end of a frame, call once per presented frame; does nothing when not recording
+void endTraceFrame();
+// Restores the driver function pointers and finishes the file
+void stopTrace();
+bool traceActive();
+
+// Replays 'path' 'loops' times in a hidden window of the recorded size and prints timings.
+// Objects left alive at the end of a loop are deleted so every loop starts from scratch.
+bool replayTrace(const char* path, int loops);
+
+// Prints per-function call counts of a trace; with 'comparePath' the counts of both traces
+// side by side with their difference, e.g. before and after batching draws
+bool printTraceStats(const char* path, const char* comparePath = nullptr);
+
+// Cost per GL call issued directly, while recording and replayed from a trace
+void runTraceBenchmark();
+
+#endif
@@ -0,0 +1,110 @@
+#include "GpuTimer.h"
+#include <algorithm>
+
+GpuTimer::GpuTimer(int framesInFlight)
+	: frames((size_t)std::max(framesInFlight, 2)), current(0), recording(false), totalMs(0.0), available(false),
+	lost(0) {
+	for (Frame& frame : frames) {
+		frame.used = 0;
+		frame.pending = false;
+	}
+}
+
+GpuTimer::~GpuTimer() {
+	release();
+}
+
+void GpuTimer::release() {
+	for (Frame& frame : frames) {
+		if (!frame.queries.empty())
+			glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+		frame.queries.clear();
+		frame.labels.clear();
+		frame.used = 0;
+		frame.pending = false;
+	}
+	recording = false;
+}
+
+void GpuTimer::beginFrame() {
+	if (recording)
+		endFrame();
+	// 'current' is the oldest slot; going oldest first leaves the newest finished frame in 'results'
+	for (size_t i = 0; i < frames.size(); i++) {
+		Frame& frame = frames[(current + i) % frames.size()];
+		if (frame.pending)
+			collect(frame);
+	}
+
+	Frame& frame = frames[current];
+	if (frame.pending) {
+		lost++;
+		frame.pending = false;
+	}
+	frame.used = 0;
+	frame.labels.clear();
+	recording = true;
+	timestamp(frame);
+}
+
+void GpuTimer::mark(const std::string& label) {
+	if (!recording)
+		return;
+	Frame& frame = frames[current];
+	frame.labels.push_back(label);
+	timestamp(frame);
+}
+
+void GpuTimer::endFrame() {
+	if (!recording)
+		return;
+	recording = false;
+	frames[current].pending = frames[current].used > 1;
+	current = (current + 1) % frames.size();
+}
+
+bool GpuTimer::hasResults() const {
+	return available;
+}
+
+const std::vector<GpuInterval>& GpuTimer::intervals() const {
+	return results;
+}
+
+double GpuTimer::frameMs() const {
+	return totalMs;
+}
+
+size_t GpuTimer::lostFrames() const {
+	return lost;
+}
+
+void GpuTimer::timestamp(Frame& frame) {
+	if (frame.used == frame.queries.size()) {
+		GLuint query;
+		glGenQueries(1, &query);
+		frame.queries.push_back(query);
+	}
+	glQueryCounter(frame.queries[frame.used++], GL_TIMESTAMP);
+}
+
+bool GpuTimer::collect(Frame& frame) {
+	// queries complete in order, so the last one landing means all of them did
+	GLint ready = 0;
+	glGetQueryObjectiv(frame.queries[frame.used - 1], GL_QUERY_RESULT_AVAILABLE, &ready);
+	if (!ready)
+		return false;
+
+	std::vector<GLuint64> times(frame.used);
+	for (size_t i = 0; i < frame.used; i++)
+		glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &times[i]);
+	results.resize(frame.labels.size());
+	for (size_t i = 0; i < frame.labels.size(); i++) {
+		results[i].label = frame.labels[i];
+		results[i].ms = times[i + 1] > times[i] ? (times[i + 1] - times[i]) / 1e6 : 0.0;
+	}
+	totalMs = times.back() > times.front() ? (times.back() - times.front()) / 1e6 : 0.0;
+	available = true;
+	frame.pending = false;
+	return true;
+}
@@ -0,0 +1,67 @@
+#ifndef GPU_TIMER_H
+#define GPU_TIMER_H
+
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+
+struct GpuInterval
+{
+	std::string label;
+	double ms;
+};
+
+// GPU time of the parts of a frame, from GL_TIMESTAMP queries.
+// Timestamps are written at beginFrame() and at every mark(); an interval is the GPU time
+// between a mark and the one before it. Results are read without waiting, a few frames
+// later once the queries landed, so they describe an earlier frame than the current one.
+// Timestamps are used rather than GL_TIME_ELAPSED because those cannot be nested.
+class GpuTimer
+{
+public:
+	GpuTimer(int framesInFlight = 4);
+	// Needs the context still current unless release() was called
+	~GpuTimer();
+	GpuTimer(const GpuTimer&) = delete;
+	GpuTimer& operator=(const GpuTimer&) = delete;
+
+	// Collects finished frames and starts timing a new one
+	void beginFrame();
+	// Ends the interval called 'label' and starts the next one
+	void mark(const std::string& label);
+	void endFrame();
+
+	// False until the first frame's results came back
+	bool hasResults() const;
+	// Intervals of the newest frame whose results came back, in mark() order
+	const std::vector<GpuInterval>& intervals() const;
+	// From beginFrame() to the last mark() of that frame
+	double frameMs() const;
+	// Frames whose queries had not landed when their slot came round again
+	size_t lostFrames() const;
+	// Deletes the queries, dropping frames still in flight, e.g. before the context goes
+	// away; the next beginFrame() creates new ones
+	void release();
+
+private:
+	struct Frame
+	{
+		std::vector<GLuint> queries;	// grown on demand, reused frame after frame
+		std::vector<std::string> labels;
+		size_t used;
+		bool pending;
+	};
+
+	std::vector<Frame> frames;
+	size_t current;
+	bool recording;
+	std::vector<GpuInterval> results;
+	double totalMs;
+	bool available;
+	size_t lost;
+
+	void timestamp(Frame& frame);
+	bool collect(Frame& frame);
+};
+
+#endif
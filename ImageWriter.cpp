@@ -0,0 +1,397 @@
+#include "ImageWriter.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+// deflate (RFC 1951) with the fixed Huffman tables: no code lengths to build or send, and
+// greedy LZ77 over hash chains finds the long runs and repeated rows that make up most of
+// a rendered frame
+static const int deflateWindow = 32768;
+static const int deflateHashBits = 15;
+static const int deflateMaxProbes = 16;
+static const int deflateMinMatch = 3;
+static const int deflateMaxMatch = 258;
+
+static const uint16_t lengthBase[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t lengthExtra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t distanceBase[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+	4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t distanceExtra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+// LSB-first bit packing as deflate wants it
+struct BitWriter
+{
+	std::vector<unsigned char>& out;
+	uint32_t bits;
+	int count;
+
+	explicit BitWriter(std::vector<unsigned char>& out) : out(out), bits(0), count(0) {}
+
+	void put(uint32_t value, int length) {
+		bits |= value << count;
+		count += length;
+		while (count >= 8) {
+			out.push_back((unsigned char)bits);
+			bits >>= 8;
+			count -= 8;
+		}
+	}
+
+	void flush() {
+		if (count > 0)
+			out.push_back((unsigned char)bits);
+		bits = 0;
+		count = 0;
+	}
+};
+
+// Fixed literal/length codes, bit-reversed so they can go through BitWriter::put
+struct FixedHuffman
+{
+	uint16_t code[288];
+	uint8_t length[288];
+	uint8_t lengthSymbol[deflateMaxMatch + 1];	// match length -> index into lengthBase
+
+	FixedHuffman() {
+		for (int symbol = 0; symbol < 288; symbol++) {
+			uint32_t value;
+			int bits;
+			if (symbol < 144) { value = 0x30 + symbol; bits = 8; }
+			else if (symbol < 256) { value = 0x190 + symbol - 144; bits = 9; }
+			else if (symbol < 280) { value = symbol - 256; bits = 7; }
+			else { value = 0xC0 + symbol - 280; bits = 8; }
+			uint32_t reversed = 0;
+			for (int b = 0; b < bits; b++)
+				reversed |= ((value >> b) & 1) << (bits - 1 - b);
+			code[symbol] = (uint16_t)reversed;
+			length[symbol] = (uint8_t)bits;
+		}
+		int index = 0;
+		for (int matchLength = deflateMinMatch; matchLength <= deflateMaxMatch; matchLength++) {
+			while (index + 1 < 29 && lengthBase[index + 1] <= matchLength)
+				index++;
+			lengthSymbol[matchLength] = (uint8_t)index;
+		}
+	}
+};
+
+static const FixedHuffman& fixedHuffman() {
+	static const FixedHuffman table;
+	return table;
+}
+
+static void putSymbol(BitWriter& writer, const FixedHuffman& huffman, int symbol) {
+	writer.put(huffman.code[symbol], huffman.length[symbol]);
+}
+
+static void putMatch(BitWriter& writer, const FixedHuffman& huffman, int length, int distance) {
+	int lengthIndex = huffman.lengthSymbol[length];
+	putSymbol(writer, huffman, 257 + lengthIndex);
+	writer.put((uint32_t)(length - lengthBase[lengthIndex]), lengthExtra[lengthIndex]);
+
+	int distanceIndex = 0;
+	while (distanceIndex + 1 < 30 && distanceBase[distanceIndex + 1] <= distance)
+		distanceIndex++;
+	// the 5-bit distance codes are sent most significant bit first as well
+	uint32_t reversed = 0;
+	for (int b = 0; b < 5; b++)
+		reversed |= ((distanceIndex >> b) & 1) << (4 - b);
+	writer.put(reversed, 5);
+	writer.put((uint32_t)(distance - distanceBase[distanceIndex]), distanceExtra[distanceIndex]);
+}
+
+static uint32_t hash3(const unsigned char* p) {
+	return ((uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2]) * 2654435761u >> (32 - deflateHashBits);
+}
+
+static uint32_t adler32(const unsigned char* data, size_t size) {
+	uint32_t a = 1, b = 0;
+	while (size > 0) {
+		size_t block = std::min<size_t>(size, 5552);	// largest run before b can overflow
+		for (size_t i = 0; i < block; i++) {
+			a += data[i];
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+		data += block;
+		size -= block;
+	}
+	return b << 16 | a;
+}
+
+// zlib stream (RFC 1950) holding one fixed-Huffman deflate block
+static void zlibCompress(const unsigned char* data, size_t size, std::vector<unsigned char>& out) {
+	const FixedHuffman& huffman = fixedHuffman();
+	out.push_back(0x78);	// deflate, 32K window
+	out.push_back(0x01);	// fastest compression level, header checksum
+
+	BitWriter writer(out);
+	writer.put(1, 1);	// final block
+	writer.put(1, 2);	// fixed Huffman codes
+
+	std::vector<int32_t> head((size_t)1 << deflateHashBits, -1);
+	std::vector<int32_t> previous(deflateWindow, -1);
+	auto insert = [&](size_t position) {
+		uint32_t hash = hash3(data + position);
+		previous[position & (deflateWindow - 1)] = head[hash];
+		head[hash] = (int32_t)position;
+	};
+
+	size_t i = 0;
+	while (i < size) {
+		int bestLength = 0, bestDistance = 0;
+		if (i + deflateMinMatch <= size) {
+			int maxLength = (int)std::min<size_t>(deflateMaxMatch, size - i);
+			int32_t candidate = head[hash3(data + i)];
+			for (int probe = 0; probe < deflateMaxProbes && candidate >= 0; probe++) {
+				size_t distance = i - (size_t)candidate;
+				if (distance > (size_t)deflateWindow)
+					break;
+				const unsigned char* a = data + candidate;
+				const unsigned char* b = data + i;
+				if (a[bestLength] == b[bestLength]) {
+					int length = 0;
+					while (length < maxLength && a[length] == b[length])
+						length++;
+					if (length > bestLength) {
+						bestLength = length;
+						bestDistance = (int)distance;
+						if (length == maxLength)
+							break;
+					}
+				}
+				int32_t next = previous[candidate & (deflateWindow - 1)];
+				if (next >= candidate)	// slot reused by a newer position
+					break;
+				candidate = next;
+			}
+			insert(i);
+		}
+
+		if (bestLength >= deflateMinMatch) {
+			putMatch(writer, huffman, bestLength, bestDistance);
+			for (size_t k = i + 1; k < i + bestLength && k + deflateMinMatch <= size; k++)
+				insert(k);
+			i += bestLength;
+		}
+		else {
+			putSymbol(writer, huffman, data[i]);
+			i++;
+		}
+	}
+	putSymbol(writer, huffman, 256);	// end of block
+	writer.flush();
+
+	uint32_t checksum = adler32(data, size);
+	for (int shift = 24; shift >= 0; shift -= 8)
+		out.push_back((unsigned char)(checksum >> shift));
+}
+
+struct CrcTable
+{
+	uint32_t entries[256];
+
+	CrcTable() {
+		for (uint32_t n = 0; n < 256; n++) {
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++)
+				c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			entries[n] = c;
+		}
+	}
+};
+
+static uint32_t crc32(const unsigned char* data, size_t size) {
+	static const CrcTable table;
+	uint32_t crc = 0xFFFFFFFFu;
+	for (size_t i = 0; i < size; i++)
+		crc = table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+static void putBigEndian(std::vector<unsigned char>& out, uint32_t value) {
+	for (int shift = 24; shift >= 0; shift -= 8)
+		out.push_back((unsigned char)(value >> shift));
+}
+
+static void putChunk(std::vector<unsigned char>& out, const char* type, const unsigned char* data, size_t size) {
+	putBigEndian(out, (uint32_t)size);
+	size_t start = out.size();
+	out.insert(out.end(), type, type + 4);
+	out.insert(out.end(), data, data + size);
+	putBigEndian(out, crc32(&out[start], size + 4));
+}
+
+static int paeth(int a, int b, int c) {
+	int p = a + b - c;
+	int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+	if (pa <= pb && pa <= pc)
+		return a;
+	return pb <= pc ? b : c;
+}
+
+std::vector<unsigned char> encodePng(const unsigned char* pixels, int width, int height, int sourceChannels,
+	int channels, bool bottomUp) {
+	const size_t rowBytes = (size_t)width * channels;
+	std::vector<unsigned char> filtered((rowBytes + 1) * height);
+	std::vector<unsigned char> row(rowBytes), previousRow(rowBytes, 0);
+	std::vector<unsigned char> candidate(rowBytes);
+
+	for (int y = 0; y < height; y++) {
+		const unsigned char* source = pixels + (size_t)(bottomUp ? height - 1 - y : y) * width * sourceChannels;
+		for (int x = 0; x < width; x++) {
+			for (int c = 0; c < channels; c++)
+				row[(size_t)x * channels + c] = source[(size_t)x * sourceChannels + std::min(c, sourceChannels - 1)];
+		}
+
+		// the filter with the smallest sum of absolute residuals usually compresses best
+		unsigned char* out = &filtered[y * (rowBytes + 1)];
+		long bestCost = -1;
+		for (int filter = 0; filter < 5; filter++) {
+			long cost = 0;
+			for (size_t i = 0; i < rowBytes; i++) {
+				int left = i >= (size_t)channels ? row[i - channels] : 0;
+				int up = previousRow[i];
+				int upLeft = i >= (size_t)channels ? previousRow[i - channels] : 0;
+				int predicted = 0;
+				switch (filter) {
+				case 1: predicted = left; break;
+				case 2: predicted = up; break;
+				case 3: predicted = (left + up) / 2; break;
+				case 4: predicted = paeth(left, up, upLeft); break;
+				}
+				unsigned char residual = (unsigned char)(row[i] - predicted);
+				candidate[i] = residual;
+				cost += residual < 128 ? residual : 256 - residual;
+			}
+			if (bestCost < 0 || cost < bestCost) {
+				bestCost = cost;
+				out[0] = (unsigned char)filter;
+				std::copy(candidate.begin(), candidate.end(), out + 1);
+			}
+		}
+		std::swap(row, previousRow);
+	}
+
+	std::vector<unsigned char> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	std::vector<unsigned char> header;
+	putBigEndian(header, (uint32_t)width);
+	putBigEndian(header, (uint32_t)height);
+	header.push_back(8);	// bits per channel
+	header.push_back(channels == 4 ? 6 : channels == 3 ? 2 : 0);	// RGBA, RGB or grey
+	header.push_back(0);	// deflate
+	header.push_back(0);	// adaptive filtering
+	header.push_back(0);	// not interlaced
+	putChunk(png, "IHDR", header.data(), header.size());
+
+	std::vector<unsigned char> compressed;
+	compressed.reserve(filtered.size() / 2);
+	zlibCompress(filtered.data(), filtered.size(), compressed);
+	putChunk(png, "IDAT", compressed.data(), compressed.size());
+	putChunk(png, "IEND", nullptr, 0);
+	return png;
+}
+
+bool writePng(const char* path, const unsigned char* pixels, int width, int height, int sourceChannels,
+	int channels, bool bottomUp) {
+	std::vector<unsigned char> png = encodePng(pixels, width, height, sourceChannels, channels, bottomUp);
+	std::ofstream file(path, std::ios::binary);
+	file.write((const char*)png.data(), png.size());
+	if (!file) {
+		std::cout << "ERROR::IMAGE::FILE_NOT_WRITTEN: " << path << "\n";
+		return false;
+	}
+	return true;
+}
+
+Y4mWriter::Y4mWriter() : frameWidth(0), frameHeight(0) {
+}
+
+bool Y4mWriter::open(const char* path, int width, int height, int fps) {
+	close();
+	file.open(path, std::ios::binary);
+	if (!file) {
+		std::cout << "ERROR::IMAGE::FILE_NOT_WRITTEN: " << path << "\n";
+		return false;
+	}
+	frameWidth = width;
+	frameHeight = height;
+	std::ostringstream header;
+	header << "YUV4MPEG2 W" << width << " H" << height << " F" << fps << ":1 Ip A1:1 C420jpeg XCOLORRANGE=FULL\n";
+	file << header.str();
+	size_t chroma = (size_t)((width + 1) / 2) * ((height + 1) / 2);
+	planes.resize((size_t)width * height + 2 * chroma);
+	return true;
+}
+
+void Y4mWriter::close() {
+	if (file.is_open())
+		file.close();
+	frameWidth = frameHeight = 0;
+}
+
+bool Y4mWriter::isOpen() const {
+	return file.is_open();
+}
+
+int Y4mWriter::width() const {
+	return frameWidth;
+}
+
+int Y4mWriter::height() const {
+	return frameHeight;
+}
+
+bool Y4mWriter::writeFrame(const unsigned char* pixels, int sourceChannels, bool bottomUp) {
+	if (!file.is_open())
+		return false;
+	const int width = frameWidth, height = frameHeight;
+	const int chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+	unsigned char* yPlane = planes.data();
+	unsigned char* cbPlane = yPlane + (size_t)width * height;
+	unsigned char* crPlane = cbPlane + (size_t)chromaWidth * chromaHeight;
+
+	auto pixel = [&](int x, int y) {
+		return pixels + ((size_t)(bottomUp ? height - 1 - y : y) * width + x) * sourceChannels;
+	};
+	// full range BT.601 in 8.8 fixed point, as JPEG does it
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			const unsigned char* p = pixel(x, y);
+			yPlane[(size_t)y * width + x] = (unsigned char)((77 * p[0] + 150 * p[1] + 29 * p[2] + 128) >> 8);
+		}
+	}
+	for (int cy = 0; cy < chromaHeight; cy++) {
+		for (int cx = 0; cx < chromaWidth; cx++) {
+			// average of the 2x2 block, edge pixels repeated for odd sizes
+			int r = 0, g = 0, b = 0;
+			for (int dy = 0; dy < 2; dy++) {
+				for (int dx = 0; dx < 2; dx++) {
+					const unsigned char* p = pixel(std::min(cx * 2 + dx, width - 1), std::min(cy * 2 + dy, height - 1));
+					r += p[0];
+					g += p[1];
+					b += p[2];
+				}
+			}
+			size_t index = (size_t)cy * chromaWidth + cx;
+			cbPlane[index] = (unsigned char)((-43 * r - 85 * g + 128 * b + (128 << 10) + 512) >> 10);
+			crPlane[index] = (unsigned char)((128 * r - 107 * g - 21 * b + (128 << 10) + 512) >> 10);
+		}
+	}
+
+	file << "FRAME\n";
+	file.write((const char*)planes.data(), planes.size());
+	return (bool)file;
+}
@@ -0,0 +1,42 @@
+#ifndef IMAGE_WRITER_H
+#define IMAGE_WRITER_H
+
+#include <cstddef>
+#include <fstream>
+#include <vector>
+
+// Encoders for captured frames: PNG for screenshots and golden images, Y4M (raw YUV 4:2:0
+// frames behind a text header, readable by ffmpeg and most players) for video.
+// Input is 8-bit pixels with 'sourceChannels' components, e.g. glReadPixels RGBA output;
+// 'bottomUp' rows (GL order) are flipped so the file is the right way up.
+
+// PNG with per-row adaptive filtering and deflate (fixed Huffman codes, greedy matching).
+// 'channels' is what the file stores: 1 grey, 3 RGB (alpha dropped) or 4 RGBA.
+std::vector<unsigned char> encodePng(const unsigned char* pixels, int width, int height, int sourceChannels,
+	int channels, bool bottomUp);
+bool writePng(const char* path, const unsigned char* pixels, int width, int height, int sourceChannels,
+	int channels, bool bottomUp);
+
+// Appends RGB(A) frames to a .y4m file as full range BT.601 YCbCr with 2x2 subsampled chroma
+class Y4mWriter
+{
+public:
+	Y4mWriter();
+
+	bool open(const char* path, int width, int height, int fps);
+	void close();
+	bool isOpen() const;
+
+	// Frames must have the size given to open()
+	bool writeFrame(const unsigned char* pixels, int sourceChannels, bool bottomUp);
+
+	int width() const;
+	int height() const;
+
+private:
+	std::ofstream file;
+	int frameWidth, frameHeight;
+	std::vector<unsigned char> planes;	// Y, then Cb, then Cr
+};
+
+#endif
@@ -0,0 +1,193 @@
+#include "Input.h"
+#include <algorithm>
+
+// ---------------- InputEventRing ----------------
+
+bool InputEventRing::push(const InputEvent& event) {
+	size_t h = head.load(std::memory_order_relaxed);
+	if (h - tail.load(std::memory_order_acquire) == capacity) {
+		dropped++;
+		return false;
+	}
+	events[h % capacity] = event;
+	head.store(h + 1, std::memory_order_release);
+	return true;
+}
+
+bool InputEventRing::pop(InputEvent& event) {
+	size_t t = tail.load(std::memory_order_relaxed);
+	if (t == head.load(std::memory_order_acquire))
+		return false;
+	event = events[t % capacity];
+	tail.store(t + 1, std::memory_order_release);
+	return true;
+}
+
+// ---------------- Input ----------------
+
+Input::Input(GLFWwindow* window)
+	: keyDown(keyCount, 0), keyPressed(keyCount, 0), keyReleased(keyCount, 0), downSince(keyCount, 0.0), held(keyCount, 0.0),
+	lastUpdate(glfwGetTime()), scroll(0.0), lastEventCount(0), damaged(false) {
+	std::fill(buttonDown, buttonDown + GLFW_MOUSE_BUTTON_LAST + 1, 0);
+	glfwGetCursorPos(window, &cursor[0], &cursor[1]);
+
+	glfwSetWindowUserPointer(window, this);
+	glfwSetKeyCallback(window, keyCallback);
+	glfwSetCharCallback(window, charCallback);
+	glfwSetCursorPosCallback(window, cursorCallback);
+	glfwSetMouseButtonCallback(window, mouseButtonCallback);
+	glfwSetScrollCallback(window, scrollCallback);
+	glfwSetWindowRefreshCallback(window, refreshCallback);
+	previousFramebufferSize = glfwSetFramebufferSizeCallback(window, framebufferSizeCallback);
+}
+
+void Input::update() {
+	double now = glfwGetTime();
+	std::fill(keyPressed.begin(), keyPressed.end(), 0);
+	std::fill(keyReleased.begin(), keyReleased.end(), 0);
+	std::fill(held.begin(), held.end(), 0.0);
+	scroll = 0.0;
+	chars.clear();
+	damaged = false;
+
+	size_t events = 0;
+	InputEvent event;
+	while (ring.pop(event)) {
+		events++;
+		// clamp so events timestamped before the previous update count from its start
+		double time = std::min(std::max(event.time, lastUpdate), now);
+		switch (event.type) {
+		case InputEvent::Key:
+			if (event.code < 0 || event.code >= keyCount)
+				break;
+			if (event.action == GLFW_PRESS && !keyDown[event.code]) {
+				keyDown[event.code] = 1;
+				keyPressed[event.code] = 1;
+				downSince[event.code] = time;
+			}
+			else if (event.action == GLFW_RELEASE && keyDown[event.code]) {
+				keyDown[event.code] = 0;
+				keyReleased[event.code] = 1;
+				held[event.code] += time - std::max(downSince[event.code], lastUpdate);
+			}
+			break;
+		case InputEvent::Char:
+			chars.push_back((unsigned int)event.code);
+			break;
+		case InputEvent::CursorMove:
+			cursor[0] = event.x;
+			cursor[1] = event.y;
+			break;
+		case InputEvent::MouseButton:
+			if (event.code >= 0 && event.code <= GLFW_MOUSE_BUTTON_LAST)
+				buttonDown[event.code] = event.action == GLFW_PRESS;
+			break;
+		case InputEvent::Scroll:
+			scroll += event.y;
+			break;
+		case InputEvent::Resize:
+		case InputEvent::Refresh:
+			damaged = true;
+			break;
+		}
+	}
+
+	// keys still down were held from their press (or the last update) until now
+	for (int key = 0; key < keyCount; key++) {
+		if (keyDown[key])
+			held[key] += now - std::max(downSince[key], lastUpdate);
+	}
+	lastUpdate = now;
+	lastEventCount = events;
+}
+
+bool Input::down(int key) const {
+	return key >= 0 && key < keyCount && keyDown[key];
+}
+
+bool Input::pressed(int key) const {
+	return key >= 0 && key < keyCount && keyPressed[key];
+}
+
+bool Input::released(int key) const {
+	return key >= 0 && key < keyCount && keyReleased[key];
+}
+
+double Input::heldTime(int key) const {
+	return key >= 0 && key < keyCount ? held[key] : 0.0;
+}
+
+bool Input::mouseDown(int button) const {
+	return button >= 0 && button <= GLFW_MOUSE_BUTTON_LAST && buttonDown[button];
+}
+
+double Input::axis(int negative, int positive) const {
+	return heldTime(positive) - heldTime(negative);
+}
+
+double Input::cursorX() const {
+	return cursor[0];
+}
+
+double Input::cursorY() const {
+	return cursor[1];
+}
+
+double Input::scrollY() const {
+	return scroll;
+}
+
+const std::vector<unsigned int>& Input::text() const {
+	return chars;
+}
+
+bool Input::windowDamaged() const {
+	return damaged;
+}
+
+bool Input::idle() const {
+	return lastEventCount == 0 && std::find(keyDown.begin(), keyDown.end(), 1) == keyDown.end();
+}
+
+bool Input::waitEvents(double timeout) {
+	glfwWaitEventsTimeout(timeout);
+	return !ring.empty();
+}
+
+Input* Input::fromWindow(GLFWwindow* window) {
+	return static_cast<Input*>(glfwGetWindowUserPointer(window));
+}
+
+void Input::keyCallback(GLFWwindow* window, int key, int /*scancode*/, int action, int mods) {
+	// repeats carry no state change; the held time already covers them
+	if (action == GLFW_REPEAT)
+		return;
+	fromWindow(window)->ring.push({ InputEvent::Key, glfwGetTime(), key, action, mods, 0.0, 0.0 });
+}
+
+void Input::charCallback(GLFWwindow* window, unsigned int codepoint) {
+	fromWindow(window)->ring.push({ InputEvent::Char, glfwGetTime(), (int)codepoint, GLFW_PRESS, 0, 0.0, 0.0 });
+}
+
+void Input::cursorCallback(GLFWwindow* window, double x, double y) {
+	fromWindow(window)->ring.push({ InputEvent::CursorMove, glfwGetTime(), 0, 0, 0, x, y });
+}
+
+void Input::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+	fromWindow(window)->ring.push({ InputEvent::MouseButton, glfwGetTime(), button, action, mods, 0.0, 0.0 });
+}
+
+void Input::scrollCallback(GLFWwindow* window, double x, double y) {
+	fromWindow(window)->ring.push({ InputEvent::Scroll, glfwGetTime(), 0, 0, 0, x, y });
+}
+
+void Input::framebufferSizeCallback(GLFWwindow* window, int width, int height) {
+	Input* input = fromWindow(window);
+	if (input->previousFramebufferSize)
+		input->previousFramebufferSize(window, width, height);
+	input->ring.push({ InputEvent::Resize, glfwGetTime(), 0, 0, 0, (double)width, (double)height });
+}
+
+void Input::refreshCallback(GLFWwindow* window) {
+	fromWindow(window)->ring.push({ InputEvent::Refresh, glfwGetTime(), 0, 0, 0, 0.0, 0.0 });
+}
@@ -0,0 +1,117 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <GLFW/glfw3.h>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+struct InputEvent
+{
+	enum Type
+	{
+		Key,
+		Char,
+		CursorMove,
+		MouseButton,
+		Scroll,
+		Resize,		// framebuffer size in x, y
+		Refresh		// window contents were damaged (exposed, restored)
+	};
+
+	Type type;
+	double time;		// glfwGetTime() when the callback ran
+	int code;			// key or mouse button, codepoint for Char
+	int action;			// GLFW_PRESS / GLFW_RELEASE / GLFW_REPEAT
+	int mods;
+	double x, y;		// cursor position, scroll offset or framebuffer size
+};
+
+// Single-producer single-consumer ring; push and pop never block or lock.
+// When full, new events are dropped and counted.
+class InputEventRing
+{
+public:
+	InputEventRing() : head(0), tail(0), dropped(0) {}
+
+	bool push(const InputEvent& event);
+	bool pop(InputEvent& event);
+	bool empty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+	size_t droppedCount() const { return dropped; }
+
+private:
+	static const size_t capacity = 1024;
+
+	InputEvent events[capacity];
+	std::atomic<size_t> head;	// next slot to write, producer only
+	std::atomic<size_t> tail;	// next slot to read, consumer only
+	size_t dropped;
+};
+
+// Event-driven input for one window.
+// GLFW callbacks push timestamped events into a ring; update() drains it once per
+// frame and rebuilds the key state. Held keys are measured in seconds of the frame
+// they were held for, using the event timestamps, so actions scale with time rather
+// than with the frame rate. Installs the window's key, char, cursor, mouse button,
+// scroll and refresh callbacks and uses its user pointer; a framebuffer size callback
+// set before construction keeps being called.
+class Input
+{
+public:
+	Input(GLFWwindow* window);
+
+	// Applies the events queued since the last call, up to glfwGetTime()
+	void update();
+
+	bool down(int key) const;
+	bool pressed(int key) const;	// went down during the last update
+	bool released(int key) const;	// went up during the last update
+
+	// Seconds 'key' was held between the last two updates
+	double heldTime(int key) const;
+	bool mouseDown(int button) const;
+	// heldTime(positive) - heldTime(negative): integrate a per-second rate with it
+	double axis(int negative, int positive) const;
+
+	double cursorX() const;
+	double cursorY() const;
+	double scrollY() const;					// summed over the last update
+	const std::vector<unsigned int>& text() const;	// codepoints typed during the last update
+	// The window was resized or needs repainting during the last update
+	bool windowDamaged() const;
+
+	// True when no key is held and the last update saw no events, i.e. nothing
+	// will change until the next event arrives
+	bool idle() const;
+
+	// Sleeps in glfwWaitEventsTimeout until an event arrives or 'timeout' seconds pass.
+	// Returns true if events were queued.
+	bool waitEvents(double timeout);
+
+private:
+	static const int keyCount = GLFW_KEY_LAST + 1;
+
+	InputEventRing ring;
+	std::vector<unsigned char> keyDown, keyPressed, keyReleased;
+	std::vector<double> downSince;	// press time of held keys
+	std::vector<double> held;
+	unsigned char buttonDown[GLFW_MOUSE_BUTTON_LAST + 1];
+	double lastUpdate;
+	double cursor[2];
+	double scroll;
+	std::vector<unsigned int> chars;
+	size_t lastEventCount;
+	bool damaged;
+	GLFWframebuffersizefun previousFramebufferSize;
+
+	static Input* fromWindow(GLFWwindow* window);
+	static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+	static void charCallback(GLFWwindow* window, unsigned int codepoint);
+	static void cursorCallback(GLFWwindow* window, double x, double y);
+	static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+	static void scrollCallback(GLFWwindow* window, double x, double y);
+	static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
+	static void refreshCallback(GLFWwindow* window);
+};
+
+#endif
@@ -0,0 +1,305 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+struct Job
+{
+	std::function<void()> work;
+	JobCounter* counter;
+};
+
+// Chase-Lev deque (with the C11 memory orders from Le et al., "Correct and Efficient
+// Work-Stealing for Weak Memory Models"). The owner pushes and pops at the bottom,
+// thieves take from the top; only the last element needs a CAS. Fixed capacity:
+// push() fails when full and the caller falls back to the shared queue.
+class WorkStealingDeque
+{
+public:
+	WorkStealingDeque() : top(0), bottom(0), buffer(new std::atomic<Job*>[capacity]) {}
+
+	bool push(Job* job) {
+		long long b = bottom.load(std::memory_order_relaxed);
+		long long t = top.load(std::memory_order_acquire);
+		if (b - t >= capacity)
+			return false;
+		buffer[b & (capacity - 1)].store(job, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	Job* pop() {
+		long long b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		long long t = top.load(std::memory_order_relaxed);
+		if (t > b) {
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		Job* job = buffer[b & (capacity - 1)].load(std::memory_order_relaxed);
+		if (t == b) {
+			// last element: race the thieves for it
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				job = nullptr;
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	Job* steal() {
+		long long t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		long long b = bottom.load(std::memory_order_acquire);
+		if (t >= b)
+			return nullptr;
+		Job* job = buffer[t & (capacity - 1)].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+		return job;
+	}
+
+private:
+	static const long long capacity = 4096;
+
+	// owner and thieves write different ends; keep them on separate cache lines
+	// (padding rather than alignas, heap allocations aren't over-aligned before C++17)
+	std::atomic<long long> top;
+	char padding[64];
+	std::atomic<long long> bottom;
+	std::unique_ptr<std::atomic<Job*>[]> buffer;
+};
+
+// failed find attempts before an idle worker goes to sleep
+static const int idleSpins = 64;
+
+// The system and deque index of the calling thread
+static thread_local JobSystem* currentSystem = nullptr;
+static thread_local int currentIndex = -1;
+
+static unsigned nextRandom() {
+	static thread_local unsigned state = 0x9E3779B9u;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+JobSystem::JobSystem(int threads)
+	: injectedCount(0), epoch(0), sleeping(0), stopping(false) {
+	if (threads <= 0)
+		threads = (int)std::max(1u, std::thread::hardware_concurrency());
+	for (int i = 0; i < threads; i++)
+		queues.emplace_back(new WorkStealingDeque());
+
+	previousSystem = currentSystem;
+	previousIndex = currentIndex;
+	currentSystem = this;
+	currentIndex = 0;
+
+	for (int i = 1; i < threads; i++)
+		workers.emplace_back(&JobSystem::workerLoop, this, i);
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		stopping = true;
+	}
+	wakeup.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+
+	currentSystem = previousSystem;
+	currentIndex = previousIndex;
+}
+
+void JobSystem::run(std::function<void()> work, JobCounter* counter, JobCounter* dependency) {
+	Job* job = new Job{ std::move(work), counter };
+	if (counter)
+		counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+	if (dependency) {
+		std::lock_guard<std::mutex> lock(dependency->mutex);
+		if (dependency->pending.load(std::memory_order_acquire) > 0) {
+			dependency->waiting.push_back(job);
+			return;
+		}
+	}
+	push(job);
+}
+
+void JobSystem::runOnMainThread(std::function<void()> work, JobCounter* counter) {
+	Job* job = new Job{ std::move(work), counter };
+	if (counter)
+		counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> lock(mainMutex);
+	mainQueue.push_back(job);
+}
+
+void JobSystem::wait(JobCounter& counter) {
+	int index = currentSystem == this ? currentIndex : -1;
+	while (counter.pending.load(std::memory_order_acquire) > 0) {
+		if (index == 0 && runMainThreadJob())
+			continue;
+		Job* job = index >= 0 ? findJob(index) : nullptr;
+		if (job)
+			execute(job);
+		else
+			std::this_thread::yield();
+	}
+	// the last finisher may still hold the counter's mutex; let it leave before the caller can destroy it
+	std::lock_guard<std::mutex> lock(counter.mutex);
+}
+
+void JobSystem::pumpMainThread() {
+	// with no workers nothing else runs the deques, so do it here first; the main-thread
+	// jobs those post are then picked up below in the same call
+	if (workers.empty() && currentSystem == this && currentIndex == 0) {
+		while (Job* job = findJob(0))
+			execute(job);
+	}
+
+	std::deque<Job*> jobs;
+	{
+		std::lock_guard<std::mutex> lock(mainMutex);
+		jobs.swap(mainQueue);
+	}
+	for (Job* job : jobs)
+		execute(job);
+}
+
+void JobSystem::parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+	if (count == 0)
+		return;
+	grain = std::max(grain, (size_t)1);
+	// a few chunks per thread so stealing can even out uneven chunks
+	size_t chunks = std::min((count + grain - 1) / grain, (size_t)threadCount() * 4);
+	size_t chunkSize = (count + chunks - 1) / chunks;
+
+	JobCounter counter;
+	for (size_t first = chunkSize; first < count; first += chunkSize) {
+		size_t last = std::min(count, first + chunkSize);
+		run([&body, first, last] { body(first, last); }, &counter);
+	}
+	body(0, std::min(count, chunkSize));
+	wait(counter);
+}
+
+int JobSystem::threadCount() const {
+	return (int)queues.size();
+}
+
+void JobSystem::workerLoop(int index) {
+	currentSystem = this;
+	currentIndex = index;
+
+	int spins = 0;
+	while (!stopping.load(std::memory_order_relaxed)) {
+		unsigned seen = epoch.load();
+		Job* job = findJob(index);
+		if (job) {
+			execute(job);
+			spins = 0;
+			continue;
+		}
+		if (++spins < idleSpins) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		// any push after 'seen' was read changes the epoch, so no wakeup is lost
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		sleeping++;
+		wakeup.wait(lock, [this, seen] { return epoch.load() != seen || stopping.load(); });
+		sleeping--;
+		spins = 0;
+	}
+}
+
+void JobSystem::push(Job* job) {
+	if (currentSystem != this || !queues[currentIndex]->push(job)) {
+		std::lock_guard<std::mutex> lock(injectedMutex);
+		injected.push_back(job);
+		injectedCount++;
+	}
+	wake();
+}
+
+void JobSystem::wake() {
+	epoch.fetch_add(1);
+	if (sleeping.load() > 0) {
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		wakeup.notify_one();
+	}
+}
+
+Job* JobSystem::findJob(int index) {
+	Job* job = queues[index]->pop();
+	if (job)
+		return job;
+
+	if (injectedCount.load(std::memory_order_relaxed) > 0) {
+		std::lock_guard<std::mutex> lock(injectedMutex);
+		if (!injected.empty()) {
+			job = injected.front();
+			injected.pop_front();
+			injectedCount--;
+			return job;
+		}
+	}
+
+	// start at a random victim so thieves don't all hit the same deque
+	int count = (int)queues.size();
+	int start = (int)(nextRandom() % (unsigned)count);
+	for (int i = 0; i < count; i++) {
+		int victim = (start + i) % count;
+		if (victim == index)
+			continue;
+		job = queues[victim]->steal();
+		if (job)
+			return job;
+	}
+	return nullptr;
+}
+
+bool JobSystem::runMainThreadJob() {
+	Job* job;
+	{
+		std::lock_guard<std::mutex> lock(mainMutex);
+		if (mainQueue.empty())
+			return false;
+		job = mainQueue.front();
+		mainQueue.pop_front();
+	}
+	execute(job);
+	return true;
+}
+
+void JobSystem::execute(Job* job) {
+	job->work();
+	JobCounter* counter = job->counter;
+	delete job;
+	if (counter)
+		finish(counter);
+}
+
+void JobSystem::finish(JobCounter* counter) {
+	// not the last job: a plain decrement, the counter can't complete under us
+	int value = counter->pending.load(std::memory_order_relaxed);
+	while (value > 1) {
+		if (counter->pending.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+			return;
+	}
+
+	// possibly the last one: take the dependents in the same critical section that
+	// completes the counter, so run() can't add one that is never released
+	std::vector<Job*> released;
+	{
+		std::lock_guard<std::mutex> lock(counter->mutex);
+		if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			released.swap(counter->waiting);
+	}
+	for (Job* job : released)
+		push(job);
+}
@@ -0,0 +1,104 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct Job;
+class WorkStealingDeque;
+
+// Counts unfinished jobs. run() increments it, a finished job decrements it.
+// Jobs may also wait for a counter to reach zero before they are scheduled.
+class JobCounter
+{
+public:
+	JobCounter() : pending(0) {}
+	JobCounter(const JobCounter&) = delete;
+	JobCounter& operator=(const JobCounter&) = delete;
+
+	bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class JobSystem;
+
+	std::atomic<int> pending;
+	std::mutex mutex;			// guards 'waiting' and the final decrement
+	std::vector<Job*> waiting;	// jobs scheduled once 'pending' reaches zero
+};
+
+// Work-stealing task scheduler.
+// Every thread (the creating thread is thread 0, the rest are workers) owns a
+// Chase-Lev deque: it pushes and pops its own jobs at the bottom without locks
+// while idle threads steal the oldest jobs from the top. GL work must stay on the
+// thread that owns the context, so it goes through a separate main-thread queue
+// that only thread 0 drains (in wait() or pumpMainThread()).
+class JobSystem
+{
+public:
+	// 'threads' includes the creating thread; 0 picks one per hardware thread
+	JobSystem(int threads = 0);
+	~JobSystem();
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	// Schedules 'work'. 'counter' (optional) is incremented now and decremented when
+	// the job finished; with 'dependency' set the job only starts once that counter
+	// reaches zero.
+	void run(std::function<void()> work, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+	// Queues 'work' for the creating thread, e.g. GL uploads of data decoded in a job
+	void runOnMainThread(std::function<void()> work, JobCounter* counter = nullptr);
+
+	// Runs other jobs until 'counter' reaches zero. On the main thread this also runs
+	// main-thread jobs; a worker waiting for one depends on the main thread waiting or pumping.
+	void wait(JobCounter& counter);
+
+	// Runs the queued main-thread jobs; call once per frame. With a single thread (no
+	// workers) it first runs every scheduled job, as nothing else would.
+	void pumpMainThread();
+
+	// Splits [0, count) into chunks of at least 'grain' items, runs body(first, last)
+	// on them and returns once all finished
+	void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+	int threadCount() const;
+
+private:
+	std::vector<std::unique_ptr<WorkStealingDeque>> queues;	// one per thread, 0 = main
+	std::vector<std::thread> workers;
+
+	// jobs pushed by threads that have no deque (or a full one)
+	std::mutex injectedMutex;
+	std::deque<Job*> injected;
+	std::atomic<size_t> injectedCount;
+
+	std::mutex mainMutex;
+	std::deque<Job*> mainQueue;
+
+	// idle workers sleep until 'epoch' changes; pushers only notify when someone sleeps
+	std::mutex sleepMutex;
+	std::condition_variable wakeup;
+	std::atomic<unsigned> epoch;
+	std::atomic<int> sleeping;
+	std::atomic<bool> stopping;
+
+	JobSystem* previousSystem;
+	int previousIndex;
+
+	void workerLoop(int index);
+	void push(Job* job);
+	void wake();
+	Job* findJob(int index);
+	bool runMainThreadJob();
+	void execute(Job* job);
+	void finish(JobCounter* counter);
+};
+
+#endif
@@ -1,18 +1,78 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <iostream>
+#include <string>
+#include <sstream>
+#include <iomanip>
 #include <algorithm> // Required for std::min, max
+#include <cstdlib>
 #include "Shader.h"
 #include "stb_image.h"
+#include "Benchmark.h"
+#include "MipGenerator.h"
+#include "TextureUpload.h"
+#include "RenderQueue.h"
+#include "JobSystem.h"
+#include "FramePacer.h"
+#include "Input.h"
+#include "RedrawTracker.h"
+#include "MeshImport.h"
+#include "VertexFormat.h"
+#include "GLTrace.h"
+#include "FrameCapture.h"
+#include "RenderTargetPool.h"
+#include "FrameGraph.h"
+#include "DynamicResolution.h"
+#include "GLCapabilities.h"
 
 const unsigned int WIDTH = 800;
 const unsigned int HEIGHT = 600;
 
+// offscreen targets for passes that don't draw to the window; resizes reach it through the callback
+RenderTargetPool* renderTargets = nullptr;
+
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
-void processInput(GLFWwindow* window);
-void setTextureInterp(GLFWwindow* window, float& interp);
+void processInput(GLFWwindow* window, const Input& input);
+void setTextureInterp(const Input& input, float& interp);
+void loadTextureJob(JobSystem& jobs, const char* path, bool flip, GLint filter, GLint wrap, GLuint& texture, JobCounter& done,
+    RedrawTracker& redraw);
+
+int main(int argc, char** argv) {
+    // "NoobOpenGL --disable buffer_storage,dsa [...]" takes the fallback paths as if the driver lacked
+    // those features, then carries on with the remaining arguments
+    if (argc > 2 && std::string(argv[1]) == "--disable") {
+        if (!forceFallbacks(argv[2]))
+            return -1;
+        argc -= 2;
+        argv += 2;
+    }
+    // "NoobOpenGL --bench <name>" runs a benchmark instead of the demo
+    if (argc > 2 && std::string(argv[1]) == "--bench") {
+        return runBenchmark(argv[2]) ? 0 : -1;
+    }
+    // "NoobOpenGL --import model.obj model.mesh [--split] [--compress]" converts and optimises a mesh
+    if (argc > 3 && std::string(argv[1]) == "--import") {
+        MeshLayout layout = MeshLayout::Interleaved;
+        MeshEncoding encoding = MeshEncoding::Full;
+        for (int i = 4; i < argc; i++) {
+            if (std::string(argv[i]) == "--split")
+                layout = MeshLayout::Split;
+            else if (std::string(argv[i]) == "--compress")
+                encoding = MeshEncoding::Compressed;
+        }
+        return importMesh(argv[2], argv[3], layout, encoding) ? 0 : -1;
+    }
+    // "NoobOpenGL --replay capture.gltrace [loops]" re-issues a recorded GL trace in a hidden window
+    if (argc > 2 && std::string(argv[1]) == "--replay") {
+        return replayTrace(argv[2], argc > 3 ? std::atoi(argv[3]) : 5) ? 0 : -1;
+    }
+    // "NoobOpenGL --trace-stats before.gltrace [after.gltrace]" lists GL call counts, diffed when given two
+    if (argc > 2 && std::string(argv[1]) == "--trace-stats") {
+        return printTraceStats(argv[2], argc > 3 ? argv[3] : nullptr) ? 0 : -1;
+    }
+    // "NoobOpenGL --trace capture.gltrace" runs the demo while recording every GL call
+    const char* tracePath = argc > 2 && std::string(argv[1]) == "--trace" ? argv[2] : nullptr;
 
-int main() {
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
@@ -26,11 +86,22 @@ int main() {
     }
     glfwMakeContextCurrent(window);
 
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+    // entry points resolve on first call; see "--bench glload" for what that saves
+    if (!gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress)) {
         std::cout << "Failed to initialize GLAD\n";
         return -1;
     }
-
+    logCapabilities();
+    if (tracePath)
+        startTrace(tracePath);
+
+    RenderTargetPool renderTargetPool;
+    FrameGraph frameGraph(renderTargetPool);
+    frameGraph.setTiming(true);
+    int initialWidth, initialHeight;
+    glfwGetFramebufferSize(window, &initialWidth, &initialHeight);
+    renderTargetPool.setFramebufferSize(initialWidth, initialHeight);
+    renderTargets = &renderTargetPool;
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
     /* *************TRIANGLE CODE*************
@@ -77,6 +148,15 @@ int main() {
         1, 2, 3  // second triangle
     };
 
+    // stored compressed: snorm16 positions (the shader undoes the quantisation with
+    // positionScale/positionBias), 8-bit colors and half float texture coords, 16 bytes per vertex instead of 32
+    VertexFormat quadFormat;
+    quadFormat.addQuantized(0, 3, VertexEncoding::Snorm16)
+        .add(1, 3, VertexEncoding::Unorm8)
+        .add(2, 2, VertexEncoding::Half);
+    const VertexSource quadSources[] = { { vertices, 8 }, { vertices + 3, 8 }, { vertices + 6, 8 } };
+    std::vector<unsigned char> quadVertices = quadFormat.pack(quadSources, 4);
+
     unsigned int VBO, VAO, EBO;
     glGenBuffers(1, &VBO);
     glGenVertexArrays(1, &VAO);
@@ -85,116 +165,159 @@ int main() {
     glBindVertexArray(VAO);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, quadVertices.size(), quadVertices.data(), GL_STATIC_DRAW);
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
-    // position
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // color
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    // texture
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // create texture IDs
-    GLuint textures[2];
-    glGenTextures(2, textures);
-
-    // set first texture
-    glActiveTexture(GL_TEXTURE0); // sets which texture unit the subsequent bindTexture will affect
-    glBindTexture(GL_TEXTURE_2D, textures[0]); // all upcoming GL_TEXTURE_2D operations now have effect on this texture
-
-    // set the texture wrapping parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);	// set texture wrapping to GL_REPEAT (default wrapping method)
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-    // set texture filtering parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-
-    // load image, create texture and generate mipmaps
-    int width, height, nrChannels;
-    unsigned char* data = stbi_load("container.jpg", &width, &height, &nrChannels, 0);
-    if (data) {
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-    }
-    else
-    {
-        std::cout << "Failed to load texture" << std::endl;
-    }
-    stbi_image_free(data);
-
-    // set second texture
-    glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, textures[1]);
-
-    // set the texture wrapping parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);	// set texture wrapping to GL_REPEAT (default wrapping method)
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-    // set texture filtering parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);    
-
-    stbi_set_flip_vertically_on_load(true);
-    data = stbi_load("taylor.jpg", &width, &height, &nrChannels, 0);
-    if (data)
-    {
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-    }
-    else
-    {
-        std::cout << "Failed to load texture" << std::endl;
-    }
-    stbi_image_free(data);
+    // position, color, texture
+    quadFormat.apply();
+
+    // texture IDs, 0 until their job has uploaded them; the first one clamps with linear filtering,
+    // the second repeats with nearest filtering
+    GLuint textures[2] = { 0, 0 };
+
+    // only frames whose content changed are drawn, the loop sleeps in between
+    RedrawTracker redraw;
+
+    // decode both images and build their mip chains as jobs while the loop already runs;
+    // uploads come back to this thread and trigger a redraw
+    JobSystem jobs;
+    JobCounter texturesLoaded;
+    loadTextureJob(jobs, "container.jpg", false, GL_LINEAR, GL_CLAMP_TO_EDGE, textures[0], texturesLoaded, redraw);
+    loadTextureJob(jobs, "taylor.jpg", true, GL_NEAREST, GL_REPEAT, textures[1], texturesLoaded, redraw);
 
     // tell openGL, for each sampler, which texture unit it belongs to
     shader.use();
     shader.setInt("texture1", 0); // use our first texture unit for sampler 1
     shader.setInt("texture2", 1); // use our second texture unit for sampler 2
+    quadFormat.setDequantUniforms(shader.ID, 0, "positionScale", "positionBias");
     float texture_interp = 0.5f; // uniform interpolation value of the textures
+    GLint interpLocation = glGetUniformLocation(shader.ID, "interp"); // looked up once, packets only carry locations
+
+    RenderQueue renderQueue;
+
+    // adaptive vsync at the display rate; frame time statistics go to the title bar
+    FramePacer pacer;
+    double titleTime = glfwGetTime();
+
+    Input input(window);
+
+    // F12 saves a screenshot, F10 starts/stops recording capture.y4m; both read back asynchronously
+    FrameCapture capture;
+    int screenshotCount = 0;
+
+    // F9 cycles native, half and dynamic resolution (holding 60 Hz of GPU time), F8 switches the upscale filter
+    DynamicResolution resolution(1000.0 / 60.0);
+    int resolutionMode = 0;
 
     while (!glfwWindowShouldClose(window)) {
-        processInput(window);
-        setTextureInterp(window, texture_interp);
-
-        /* *************TRIANGLE CODE *************
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        shader.use();
-        glBindVertexArray(VAO);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-        **************END TRIANGLE CODE *************/
-
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        // bind Texture
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, textures[0]);
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, textures[1]);
-
-        // render
-        shader.use();
-        shader.setFloat("interp", texture_interp);
-        glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        input.update();
+        processInput(window, input);
+        float previousInterp = texture_interp;
+        setTextureInterp(input, texture_interp);
+        if (texture_interp != previousInterp || input.windowDamaged())
+            redraw.markDirty();
+        if (input.pressed(GLFW_KEY_F12))
+            capture.screenshot("screenshot_" + std::to_string(screenshotCount++) + ".png");
+        if (input.pressed(GLFW_KEY_F10)) {
+            if (capture.recording())
+                capture.stopRecording();
+            else
+                capture.startRecording("capture.y4m", CaptureFormat::Y4m, 60);
+        }
+        if (input.pressed(GLFW_KEY_F9)) {
+            resolutionMode = (resolutionMode + 1) % 3;
+            resolution.setFixedScale(resolutionMode == 1 ? 0.5f : 0.0f);
+            redraw.markDirty();
+        }
+        if (input.pressed(GLFW_KEY_F8)) {
+            resolution.setFilter(resolution.filter() == UpscaleFilter::Bilinear ? UpscaleFilter::EdgeAware : UpscaleFilter::Bilinear);
+            redraw.markDirty();
+        }
+        // captures only happen on drawn frames, and readbacks in flight land a few frames later
+        if (capture.recording() || capture.busy())
+            redraw.markDirty();
+        jobs.pumpMainThread();
+
+        if (redraw.beginFrame()) {
+            /* *************TRIANGLE CODE *************
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            shader.use();
+            glBindVertexArray(VAO);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            **************END TRIANGLE CODE *************/
+
+            int framebufferWidth, framebufferHeight;
+            glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+
+            // passes declare what they read and write; the window is the graph's output and
+            // the graph inserts its clear
+            renderTargetPool.beginFrame();
+            frameGraph.reset();
+            FrameResource windowTarget = frameGraph.importTarget("window", 0, framebufferWidth, framebufferHeight);
+            // native resolution draws straight into the window, the other modes through an upscale
+            bool native = resolutionMode == 0;
+            FrameResource sceneTarget = native ? windowTarget : resolution.createSceneTarget(frameGraph, GL_RGBA8);
+            frameGraph.setClearColor(sceneTarget, 0.2f, 0.3f, 0.3f, 1.0f);
+            sceneTarget = frameGraph.addPass("quad", [&](const FrameGraph&) {
+                // record the quad, then sort and issue everything recorded this frame
+                CommandBuffer& commands = renderQueue.buffer(0);
+                DrawPacket& quad = commands.draw(opaqueSortKey(0, shader.ID, textures[0], 0.0f), shader.ID, VAO, GL_TRIANGLES, 6);
+                quad.textures[0] = textures[0];
+                quad.textures[1] = textures[1];
+                commands.setFloat(interpLocation, texture_interp);
+                renderQueue.execute();
+            }).write(sceneTarget);
+            if (!native)
+                resolution.addUpscalePass(frameGraph, sceneTarget, windowTarget);
+            frameGraph.execute();
+            renderTargetPool.endFrame();
+            if (!native)
+                resolution.update(frameGraph.gpuFrameMs());
+
+            capture.endFrame(framebufferWidth, framebufferHeight);
+
+            if (redraw.idleSinceLastFrame())
+                pacer.resume();
+            pacer.present(window);
+            endTraceFrame();
+        }
+
+        if (glfwGetTime() - titleTime >= 1.0) {
+            FrameStats frames = pacer.stats();
+            std::ostringstream title;
+            title << std::fixed << std::setprecision(2) << "Noob OpenGL - " << frames.meanMs << " ms, sd "
+                << frames.stdDevMs << " ms, p99 " << frames.p99Ms << " ms, " << frames.lateFrames << " late";
+            const RedrawStats& redrawn = redraw.stats();
+            title << ", " << redrawn.skippedFrames << " skipped, busy "
+                << 100.0 * redrawn.busySeconds / std::max(1e-9, redrawn.busySeconds + redrawn.waitSeconds) << "%";
+            title << ", GPU " << frameGraph.gpuFrameMs() << " ms";
+            if (resolutionMode != 0)
+                title << ", scale " << resolution.scale();
+            glfwSetWindowTitle(window, title.str().c_str());
+            titleTime = glfwGetTime();
+        }
+
+        // held keys are integrated over time, so keep waking at about the display rate while one is down
+        redraw.waitEvents(input.idle() ? 0.0 : 1.0 / 60.0);
     }
+    jobs.wait(texturesLoaded);
+    capture.release();
 
+    glDeleteTextures(2, textures);
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
+    renderTargets = nullptr;
+    frameGraph.release();
+    resolution.release();
+    renderQueue.release();
+    pacer.release();
+    renderTargetPool.clear();
+    stopTrace();
 
     glfwTerminate();
     return 0;
@@ -202,18 +325,45 @@ int main() {
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
     glViewport(0, 0, width, height);
+    // targets sized from the framebuffer are recreated when next acquired
+    if (renderTargets)
+        renderTargets->setFramebufferSize(width, height);
 }
 
-void processInput(GLFWwindow* window) {
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+void processInput(GLFWwindow* window, const Input& input) {
+    if (input.pressed(GLFW_KEY_ESCAPE))
         glfwSetWindowShouldClose(window, true);
 }
 
-void setTextureInterp(GLFWwindow* window, float& interp) {
-    if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS) {
-        interp = std::min(1.0f, interp + 0.1f);
-    }
-    else if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS) {
-        interp = std::max(0.0f, interp - 0.1f);
-    }
+void setTextureInterp(const Input& input, float& interp) {
+    // full blend range in one second of holding UP or DOWN, whatever the frame rate
+    const float interpPerSecond = 1.0f;
+    interp += (float)input.axis(GLFW_KEY_DOWN, GLFW_KEY_UP) * interpPerSecond;
+    interp = std::min(1.0f, std::max(0.0f, interp));
+}
+
+void loadTextureJob(JobSystem& jobs, const char* path, bool flip, GLint filter, GLint wrap, GLuint& texture, JobCounter& done,
+    RedrawTracker& redraw) {
+    jobs.run([&jobs, path, flip, filter, wrap, &texture, &done, &redraw] {
+        // the global flip flag would race between loader jobs
+        stbi_set_flip_vertically_on_load_thread(flip);
+        int width, height, nrChannels;
+        unsigned char* data = loadImageForUpload(path, &width, &height, &nrChannels);
+        if (!data) {
+            std::cout << "Failed to load texture" << std::endl;
+            return;
+        }
+        // mip levels are filtered on the CPU in linear light and uploaded explicitly;
+        // one filter thread, the job system already spreads the images over the cores
+        std::vector<MipLevel> levels = generateMipChain(data, width, height, nrChannels, MipFilter::Box, true, 1);
+        stbi_image_free(data);
+
+        // the texture is created on the selected texture path with storage for the whole chain
+        jobs.runOnMainThread([levels = std::move(levels), filter, wrap, &texture, nrChannels, &redraw] {
+            texture = uploadMipChain(levels, nrChannels, filter, wrap);
+            redraw.markDirty();
+        }, &done);
+        // wakes the loop so it pumps the upload
+        redraw.markDirty();
+    }, &done);
 }
\ No newline at end of file
@@ -0,0 +1,262 @@
+#include "Mesh.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+static uint64_t alignSection(uint64_t offset) {
+	return (offset + 15) & ~(uint64_t)15;
+}
+
+struct SourceAttribute
+{
+	MeshSemantic semantic;
+	int components;
+	const float* data;
+	VertexEncoding encoding;
+};
+
+bool writeMeshFile(const char* path, const MeshData& mesh, MeshLayout layout, MeshEncoding encoding) {
+	size_t vertexCount = mesh.vertexCount();
+	bool compressed = encoding == MeshEncoding::Compressed;
+	std::vector<SourceAttribute> sources;
+	sources.push_back({ MeshSemantic::Position, 3, mesh.positions.data(), compressed ? VertexEncoding::Snorm16 : VertexEncoding::Float });
+	if (mesh.normals.size() == vertexCount * 3)
+		sources.push_back({ MeshSemantic::Normal, 3, mesh.normals.data(), compressed ? VertexEncoding::Snorm10 : VertexEncoding::Float });
+	if (mesh.texcoords.size() == vertexCount * 2)
+		sources.push_back({ MeshSemantic::TexCoord, 2, mesh.texcoords.data(), compressed ? VertexEncoding::Half : VertexEncoding::Float });
+
+	MeshFileHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = meshFileMagic;
+	header.version = meshFileVersion;
+	header.vertexCount = (uint32_t)vertexCount;
+	header.indexCount = (uint32_t)mesh.indices.size();
+	header.indexSize = vertexCount <= 65536 ? 2 : 4;
+	header.attributeCount = (uint32_t)sources.size();
+	header.streamCount = layout == MeshLayout::Interleaved ? 1 : (uint32_t)sources.size();
+	header.flags = compressed ? meshFlagQuantizedPositions : 0;
+
+	for (int k = 0; k < 3; k++) {
+		header.boundsMin[k] = FLT_MAX;
+		header.boundsMax[k] = -FLT_MAX;
+	}
+	for (size_t v = 0; v < vertexCount; v++) {
+		for (int k = 0; k < 3; k++) {
+			header.boundsMin[k] = std::min(header.boundsMin[k], mesh.positions[v * 3 + k]);
+			header.boundsMax[k] = std::max(header.boundsMax[k], mesh.positions[v * 3 + k]);
+		}
+	}
+
+	// one format per stream; quantized positions use the header bounds so the loader can rebuild the dequantisation
+	std::vector<VertexFormat> formats(header.streamCount);
+	std::vector<std::vector<VertexSource>> streamSources(header.streamCount);
+	for (size_t a = 0; a < sources.size(); a++) {
+		uint32_t stream = layout == MeshLayout::Interleaved ? 0 : (uint32_t)a;
+		VertexFormat& format = formats[stream];
+		GLuint location = (GLuint)sources[a].semantic;
+		if (compressed && sources[a].semantic == MeshSemantic::Position) {
+			format.addQuantized(location, sources[a].components, sources[a].encoding);
+			format.setRange(location, header.boundsMin, header.boundsMax);
+		}
+		else {
+			format.add(location, sources[a].components, sources[a].encoding);
+		}
+		streamSources[stream].push_back({ sources[a].data, (size_t)sources[a].components });
+
+		const VertexAttribute& attribute = format.attribute(format.attributeCount() - 1);
+		MeshAttributeDesc& desc = header.attributes[a];
+		desc.semantic = (uint8_t)sources[a].semantic;
+		desc.stream = (uint8_t)stream;
+		desc.components = (uint8_t)(attribute.encoding == VertexEncoding::Snorm10 ? 4 : attribute.components);
+		desc.normalized = vertexEncodingNormalized(attribute.encoding) ? 1 : 0;
+		desc.type = vertexEncodingType(attribute.encoding);
+		desc.offset = attribute.offset;
+	}
+
+	uint64_t cursor = alignSection(sizeof(MeshFileHeader));
+	for (uint32_t s = 0; s < header.streamCount; s++) {
+		header.streams[s].stride = (uint32_t)formats[s].stride();
+		header.streams[s].offset = cursor;
+		cursor = alignSection(cursor + (uint64_t)header.streams[s].stride * vertexCount);
+	}
+	header.indexOffset = cursor;
+	header.fileSize = cursor + (uint64_t)header.indexSize * mesh.indices.size();
+
+	std::vector<unsigned char> bytes((size_t)header.fileSize, 0);
+	memcpy(bytes.data(), &header, sizeof(header));
+	for (uint32_t s = 0; s < header.streamCount && vertexCount; s++)
+		formats[s].pack(streamSources[s].data(), vertexCount, &bytes[(size_t)header.streams[s].offset]);
+	unsigned char* indexData = &bytes[(size_t)header.indexOffset];
+	if (header.indexSize == 2) {
+		for (size_t i = 0; i < mesh.indices.size(); i++) {
+			uint16_t index = (uint16_t)mesh.indices[i];
+			memcpy(indexData + i * 2, &index, 2);
+		}
+	}
+	else {
+		memcpy(indexData, mesh.indices.data(), mesh.indices.size() * 4);
+	}
+
+	std::ofstream out(path, std::ios::binary);
+	out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	if (!out) {
+		std::cout << "ERROR::MESH::FILE_NOT_SUCCESSFULLY_WRITTEN: " << path << std::endl;
+		return false;
+	}
+	return true;
+}
+
+// ---------------- MeshFile ----------------
+
+bool MeshFile::open(const char* path) {
+	if (!file.open(path)) {
+		std::cout << "ERROR::MESH::FILE_NOT_SUCCESSFULLY_READ: " << path << std::endl;
+		return false;
+	}
+
+	// everything the loader indexes with must lie inside the mapping
+	bool valid = file.size() >= sizeof(MeshFileHeader);
+	if (valid) {
+		const MeshFileHeader& h = header();
+		valid = h.magic == meshFileMagic && h.version == meshFileVersion && h.fileSize <= file.size()
+			&& (h.indexSize == 2 || h.indexSize == 4)
+			&& h.attributeCount <= maxMeshAttributes && h.streamCount <= maxMeshStreams
+			&& h.indexOffset + (uint64_t)h.indexSize * h.indexCount <= h.fileSize;
+		for (uint32_t s = 0; valid && s < h.streamCount; s++)
+			valid = h.streams[s].offset + (uint64_t)h.streams[s].stride * h.vertexCount <= h.fileSize;
+		for (uint32_t a = 0; valid && a < h.attributeCount; a++)
+			valid = h.attributes[a].stream < h.streamCount;
+	}
+	if (!valid) {
+		std::cout << "ERROR::MESH::INVALID_FILE: " << path << std::endl;
+		file.close();
+		return false;
+	}
+	return true;
+}
+
+void MeshFile::close() {
+	file.close();
+}
+
+const MeshFileHeader& MeshFile::header() const {
+	return *reinterpret_cast<const MeshFileHeader*>(file.data());
+}
+
+const unsigned char* MeshFile::stream(int index) const {
+	return file.data() + header().streams[index].offset;
+}
+
+const void* MeshFile::indices() const {
+	return file.data() + header().indexOffset;
+}
+
+size_t MeshFile::streamSize(int index) const {
+	return (size_t)header().streams[index].stride * header().vertexCount;
+}
+
+// ---------------- Mesh ----------------
+
+Mesh::Mesh()
+	: vertexArray(0), type(GL_UNSIGNED_INT), count(0), vertices(0) {
+	std::fill(bounds, bounds + 6, 0.0f);
+	std::fill(dequant, dequant + 3, 1.0f);
+	std::fill(dequant + 3, dequant + 6, 0.0f);
+}
+
+Mesh::~Mesh() {
+	release();
+}
+
+bool Mesh::load(const char* path) {
+	MeshFile file;
+	if (!file.open(path))
+		return false;
+	release();
+
+	const MeshFileHeader& header = file.header();
+	glGenVertexArrays(1, &vertexArray);
+	glBindVertexArray(vertexArray);
+
+	buffers.resize(header.streamCount + 1);
+	glGenBuffers((GLsizei)buffers.size(), buffers.data());
+	for (uint32_t s = 0; s < header.streamCount; s++) {
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[s]);
+		glBufferData(GL_ARRAY_BUFFER, file.streamSize(s), file.stream(s), GL_STATIC_DRAW);
+		for (uint32_t a = 0; a < header.attributeCount; a++) {
+			const MeshAttributeDesc& desc = header.attributes[a];
+			if (desc.stream != s)
+				continue;
+			glVertexAttribPointer(desc.semantic, desc.components, desc.type, desc.normalized ? GL_TRUE : GL_FALSE,
+				header.streams[s].stride, (void*)(size_t)desc.offset);
+			glEnableVertexAttribArray(desc.semantic);
+		}
+	}
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers.back());
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, (size_t)header.indexSize * header.indexCount, file.indices(), GL_STATIC_DRAW);
+	glBindVertexArray(0);
+
+	type = header.indexSize == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	count = (GLsizei)header.indexCount;
+	vertices = header.vertexCount;
+	std::copy(header.boundsMin, header.boundsMin + 3, bounds);
+	std::copy(header.boundsMax, header.boundsMax + 3, bounds + 3);
+	if (header.flags & meshFlagQuantizedPositions) {
+		quantizationRange(VertexEncoding::Snorm16, header.boundsMin, header.boundsMax, 3, dequant, dequant + 3);
+	}
+	else {
+		std::fill(dequant, dequant + 3, 1.0f);
+		std::fill(dequant + 3, dequant + 6, 0.0f);
+	}
+	return true;
+}
+
+void Mesh::release() {
+	if (vertexArray)
+		glDeleteVertexArrays(1, &vertexArray);
+	if (!buffers.empty())
+		glDeleteBuffers((GLsizei)buffers.size(), buffers.data());
+	vertexArray = 0;
+	buffers.clear();
+	count = 0;
+	vertices = 0;
+}
+
+void Mesh::draw() const {
+	glBindVertexArray(vertexArray);
+	glDrawElements(GL_TRIANGLES, count, type, 0);
+}
+
+GLuint Mesh::vao() const {
+	return vertexArray;
+}
+
+GLenum Mesh::indexType() const {
+	return type;
+}
+
+GLsizei Mesh::indexCount() const {
+	return count;
+}
+
+size_t Mesh::vertexCount() const {
+	return vertices;
+}
+
+const float* Mesh::boundsMin() const {
+	return bounds;
+}
+
+const float* Mesh::boundsMax() const {
+	return bounds + 3;
+}
+
+const float* Mesh::positionScale() const {
+	return dequant;
+}
+
+const float* Mesh::positionBias() const {
+	return dequant + 3;
+}
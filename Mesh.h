@@ -0,0 +1,149 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "MappedFile.h"
+#include "VertexFormat.h"
+
+// Binary mesh file (.mesh), little-endian, laid out to be used straight from a mapping:
+//   MeshFileHeader | vertex stream 0 | ... | index data
+// Every section starts at a 16-byte aligned offset. A mesh is stored either with all
+// attributes interleaved in one stream or with one stream per attribute.
+
+static const uint32_t meshFileMagic = 0x48534D4E;	// "NMSH"
+static const uint32_t meshFileVersion = 1;
+static const int maxMeshAttributes = 8;
+static const int maxMeshStreams = 8;
+
+// MeshFileHeader::flags
+static const uint32_t meshFlagQuantizedPositions = 1;	// snorm16 positions relative to the bounds
+
+// Attribute kinds; the value is also the vertex attribute location, matching the
+// demo shaders (0 position, 1 color, 2 texture coordinates)
+enum class MeshSemantic : uint8_t
+{
+	Position = 0,
+	Color = 1,
+	TexCoord = 2,
+	Normal = 3,
+	Tangent = 4
+};
+
+struct MeshAttributeDesc
+{
+	uint8_t semantic;		// MeshSemantic
+	uint8_t stream;
+	uint8_t components;		// as passed to glVertexAttribPointer (4 for GL_INT_2_10_10_10_REV)
+	uint8_t normalized;
+	uint32_t type;			// GL component type, e.g. GL_FLOAT or GL_HALF_FLOAT
+	uint32_t offset;		// byte offset within a vertex of the stream
+};
+
+struct MeshStreamDesc
+{
+	uint64_t offset;		// from the start of the file
+	uint32_t stride;
+	uint32_t reserved;
+};
+
+struct MeshFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t vertexCount;
+	uint32_t indexCount;
+	uint32_t indexSize;		// 2 or 4 bytes
+	uint32_t attributeCount;
+	uint32_t streamCount;
+	uint32_t flags;
+	float boundsMin[3];
+	float boundsMax[3];
+	MeshAttributeDesc attributes[maxMeshAttributes];
+	MeshStreamDesc streams[maxMeshStreams];
+	uint64_t indexOffset;
+	uint64_t fileSize;
+};
+
+// Editable mesh used by importers and the optimizer; attributes are optional except positions
+struct MeshData
+{
+	std::vector<float> positions;	// xyz
+	std::vector<float> normals;		// xyz
+	std::vector<float> texcoords;	// uv
+	std::vector<uint32_t> indices;
+
+	size_t vertexCount() const { return positions.size() / 3; }
+};
+
+enum class MeshLayout
+{
+	Interleaved,	// one stream, best when every pass reads every attribute
+	Split			// a stream per attribute, e.g. position-only depth passes fetch less
+};
+
+enum class MeshEncoding
+{
+	Full,		// float attributes, 32 bytes per vertex with normals and texture coordinates
+	Compressed	// snorm16 positions quantized to the bounds, 10:10:10:2 normals, half texture
+				// coordinates: 16 bytes per vertex
+};
+
+// Writes 'mesh' as a .mesh file; indices are stored as 16-bit when they fit
+bool writeMeshFile(const char* path, const MeshData& mesh, MeshLayout layout, MeshEncoding encoding = MeshEncoding::Full);
+
+// Read-only view of a mapped .mesh file; pointers stay valid while the view is open
+class MeshFile
+{
+public:
+	bool open(const char* path);
+	void close();
+
+	const MeshFileHeader& header() const;
+	const unsigned char* stream(int index) const;
+	const void* indices() const;
+	size_t streamSize(int index) const;
+
+private:
+	MappedFile file;
+};
+
+// GPU copy of a .mesh file: one VBO per stream, an EBO and a VAO with the attributes set up
+class Mesh
+{
+public:
+	Mesh();
+	~Mesh();
+	Mesh(const Mesh&) = delete;
+	Mesh& operator=(const Mesh&) = delete;
+
+	// Maps the file and uploads the streams straight from the mapping
+	bool load(const char* path);
+	void release();
+
+	void draw() const;
+
+	GLuint vao() const;
+	GLenum indexType() const;
+	GLsizei indexCount() const;
+	size_t vertexCount() const;
+	const float* boundsMin() const;
+	const float* boundsMax() const;
+	// Position = attribute * positionScale + positionBias in the vertex shader; identity
+	// unless the file has quantized positions
+	const float* positionScale() const;
+	const float* positionBias() const;
+
+private:
+	GLuint vertexArray;
+	std::vector<GLuint> buffers;	// streams, then the index buffer
+	GLenum type;
+	GLsizei count;
+	size_t vertices;
+	float bounds[6];
+	float dequant[6];	// scale, bias
+};
+
+#endif
@@ -0,0 +1,338 @@
+#include "MeshImport.h"
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+
+// OBJ face corner: 0-based position / texcoord / normal indices, -1 if absent
+struct ObjCorner
+{
+	int position, texcoord, normal;
+
+	bool operator==(const ObjCorner& other) const {
+		return position == other.position && texcoord == other.texcoord && normal == other.normal;
+	}
+};
+
+struct ObjCornerHash
+{
+	size_t operator()(const ObjCorner& c) const {
+		return ((size_t)c.position * 73856093u) ^ ((size_t)(c.texcoord + 1) * 19349663u) ^ ((size_t)(c.normal + 1) * 83492791u);
+	}
+};
+
+static double millisecondsSince(std::chrono::high_resolution_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+static const char* skipSpaces(const char* p) {
+	while (*p == ' ' || *p == '\t')
+		p++;
+	return p;
+}
+
+static const char* parseFloats(const char* p, float* out, int count) {
+	for (int i = 0; i < count; i++) {
+		char* end;
+		out[i] = std::strtof(p, &end);
+		p = end;
+	}
+	return p;
+}
+
+// OBJ indices are 1-based, negative ones count back from the last element
+static int resolveIndex(long index, size_t count) {
+	if (index > 0)
+		return (int)index - 1;
+	if (index < 0)
+		return (int)count + (int)index;
+	return -1;
+}
+
+bool loadObj(const char* path, MeshData& mesh) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		std::cout << "ERROR::OBJ::FILE_NOT_SUCCESSFULLY_READ: " << path << std::endl;
+		return false;
+	}
+	std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	std::vector<float> positions, texcoords, normals;
+	std::vector<ObjCorner> corners;
+	std::vector<ObjCorner> face;
+	const char* p = text.c_str();
+	while (*p) {
+		p = skipSpaces(p);
+		if (p[0] == 'v' && p[1] == ' ') {
+			float v[3];
+			p = parseFloats(p + 2, v, 3);
+			positions.insert(positions.end(), v, v + 3);
+		}
+		else if (p[0] == 'v' && p[1] == 't' && p[2] == ' ') {
+			float v[2];
+			p = parseFloats(p + 3, v, 2);
+			texcoords.insert(texcoords.end(), v, v + 2);
+		}
+		else if (p[0] == 'v' && p[1] == 'n' && p[2] == ' ') {
+			float v[3];
+			p = parseFloats(p + 3, v, 3);
+			normals.insert(normals.end(), v, v + 3);
+		}
+		else if (p[0] == 'f' && p[1] == ' ') {
+			face.clear();
+			p = skipSpaces(p + 2);
+			while (*p && *p != '\n' && *p != '\r') {
+				char* end;
+				ObjCorner corner = { resolveIndex(std::strtol(p, &end, 10), positions.size() / 3), -1, -1 };
+				p = end;
+				if (*p == '/') {
+					p++;
+					if (*p != '/') {
+						corner.texcoord = resolveIndex(std::strtol(p, &end, 10), texcoords.size() / 2);
+						p = end;
+					}
+					if (*p == '/') {
+						corner.normal = resolveIndex(std::strtol(p + 1, &end, 10), normals.size() / 3);
+						p = end;
+					}
+				}
+				if (corner.position < 0 || corner.position >= (int)(positions.size() / 3)) {
+					std::cout << "ERROR::OBJ::INVALID_FACE: " << path << std::endl;
+					return false;
+				}
+				face.push_back(corner);
+				p = skipSpaces(p);
+			}
+			for (size_t i = 2; i < face.size(); i++) {
+				corners.push_back(face[0]);
+				corners.push_back(face[i - 1]);
+				corners.push_back(face[i]);
+			}
+		}
+		// anything else (comments, groups, materials) is skipped
+		while (*p && *p != '\n')
+			p++;
+		if (*p)
+			p++;
+	}
+
+	bool hasTexcoords = false, hasNormals = false;
+	for (const ObjCorner& corner : corners) {
+		hasTexcoords |= corner.texcoord >= 0 && corner.texcoord < (int)(texcoords.size() / 2);
+		hasNormals |= corner.normal >= 0 && corner.normal < (int)(normals.size() / 3);
+	}
+
+	mesh = MeshData();
+	std::unordered_map<ObjCorner, uint32_t, ObjCornerHash> vertexOf;
+	vertexOf.reserve(corners.size());
+	mesh.indices.reserve(corners.size());
+	for (const ObjCorner& corner : corners) {
+		auto inserted = vertexOf.insert(std::make_pair(corner, (uint32_t)mesh.vertexCount()));
+		if (inserted.second) {
+			mesh.positions.insert(mesh.positions.end(), &positions[corner.position * 3], &positions[corner.position * 3] + 3);
+			if (hasTexcoords) {
+				bool valid = corner.texcoord >= 0 && corner.texcoord < (int)(texcoords.size() / 2);
+				mesh.texcoords.push_back(valid ? texcoords[corner.texcoord * 2] : 0.0f);
+				mesh.texcoords.push_back(valid ? texcoords[corner.texcoord * 2 + 1] : 0.0f);
+			}
+			if (hasNormals) {
+				bool valid = corner.normal >= 0 && corner.normal < (int)(normals.size() / 3);
+				for (int k = 0; k < 3; k++)
+					mesh.normals.push_back(valid ? normals[corner.normal * 3 + k] : 0.0f);
+			}
+		}
+		mesh.indices.push_back(inserted.first->second);
+	}
+	return true;
+}
+
+void optimizeMesh(MeshData& mesh) {
+	optimizeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertexCount());
+	optimizeOverdraw(mesh.indices.data(), mesh.indices.size(), mesh.positions.data(), mesh.vertexCount());
+
+	size_t vertexCount;
+	std::vector<uint32_t> remap = optimizeVertexFetch(mesh.indices.data(), mesh.indices.size(), mesh.vertexCount(), vertexCount);
+	remapVertexStream(mesh.positions, 3, remap, vertexCount);
+	remapVertexStream(mesh.normals, 3, remap, vertexCount);
+	remapVertexStream(mesh.texcoords, 2, remap, vertexCount);
+}
+
+void printVertexCacheReport(const char* label, const MeshData& mesh) {
+	VertexCacheStats small = analyzeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertexCount(), 16);
+	VertexCacheStats large = analyzeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertexCount(), 32);
+	std::cout << std::fixed << std::setprecision(3) << std::left << std::setw(12) << label << std::right
+		<< "ACMR " << small.acmr << " / " << large.acmr
+		<< "   ATVR " << small.atvr << " / " << large.atvr << "   (FIFO 16 / 32)\n";
+}
+
+bool importMesh(const char* source, const char* destination, MeshLayout layout, MeshEncoding encoding) {
+	auto start = std::chrono::high_resolution_clock::now();
+	MeshData mesh;
+	if (!loadObj(source, mesh))
+		return false;
+	double loadMs = millisecondsSince(start);
+	std::cout << source << ": " << mesh.indices.size() / 3 << " triangles, " << mesh.vertexCount() << " vertices"
+		<< std::fixed << std::setprecision(1) << " (parsed in " << loadMs << " ms)\n";
+	printVertexCacheReport("input", mesh);
+
+	start = std::chrono::high_resolution_clock::now();
+	optimizeMesh(mesh);
+	double optimizeMs = millisecondsSince(start);
+	printVertexCacheReport("optimized", mesh);
+	std::cout << std::fixed << std::setprecision(1) << "optimized in " << optimizeMs << " ms\n";
+
+	if (!writeMeshFile(destination, mesh, layout, encoding))
+		return false;
+	std::cout << "wrote " << destination << (layout == MeshLayout::Split ? " (split streams" : " (interleaved")
+		<< (encoding == MeshEncoding::Compressed ? ", compressed)\n" : ")\n");
+	return true;
+}
+
+// ---------------- benchmark ----------------
+
+// UV sphere with normals and texture coordinates, triangles in random order. The radius
+// has bumps so parts of the surface hide others, which gives the overdraw pass work;
+// the normals stay those of the smooth sphere.
+static MeshData makeShuffledSphere(int rings, int segments) {
+	MeshData mesh;
+	const float pi = 3.14159265f;
+	for (int r = 0; r <= rings; r++) {
+		float theta = pi * r / rings;
+		for (int s = 0; s <= segments; s++) {
+			float phi = 2.0f * pi * s / segments;
+			float n[3] = { std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi) };
+			float radius = 1.0f + 0.2f * std::sin(8.0f * theta) * std::sin(8.0f * phi);
+			float p[3] = { n[0] * radius, n[1] * radius, n[2] * radius };
+			mesh.positions.insert(mesh.positions.end(), p, p + 3);
+			mesh.normals.insert(mesh.normals.end(), n, n + 3);
+			mesh.texcoords.push_back((float)s / segments);
+			mesh.texcoords.push_back((float)r / rings);
+		}
+	}
+	std::vector<uint32_t> triangles;
+	for (int r = 0; r < rings; r++) {
+		for (int s = 0; s < segments; s++) {
+			uint32_t a = r * (segments + 1) + s, b = a + segments + 1;
+			uint32_t quad[6] = { a, b, a + 1, a + 1, b, b + 1 };
+			triangles.insert(triangles.end(), quad, quad + 6);
+		}
+	}
+
+	std::vector<size_t> order(triangles.size() / 3);
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = i;
+	std::mt19937 random(1234);
+	std::shuffle(order.begin(), order.end(), random);
+	for (size_t t : order)
+		mesh.indices.insert(mesh.indices.end(), &triangles[t * 3], &triangles[t * 3] + 3);
+	return mesh;
+}
+
+static bool writeObj(const char* path, const MeshData& mesh) {
+	std::ostringstream text;
+	text << std::setprecision(7);
+	for (size_t v = 0; v < mesh.vertexCount(); v++)
+		text << "v " << mesh.positions[v * 3] << " " << mesh.positions[v * 3 + 1] << " " << mesh.positions[v * 3 + 2] << "\n";
+	for (size_t v = 0; v < mesh.vertexCount(); v++)
+		text << "vt " << mesh.texcoords[v * 2] << " " << mesh.texcoords[v * 2 + 1] << "\n";
+	for (size_t v = 0; v < mesh.vertexCount(); v++)
+		text << "vn " << mesh.normals[v * 3] << " " << mesh.normals[v * 3 + 1] << " " << mesh.normals[v * 3 + 2] << "\n";
+	for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+		text << "f";
+		for (int k = 0; k < 3; k++) {
+			uint32_t v = mesh.indices[i + k] + 1;
+			text << " " << v << "/" << v << "/" << v;
+		}
+		text << "\n";
+	}
+	std::ofstream file(path, std::ios::binary);
+	file << text.str();
+	return (bool)file;
+}
+
+void runMeshBenchmark() {
+	const char* objPath = "mesh_benchmark.obj";
+	const char* meshPath = "mesh_benchmark.mesh";
+
+	MeshData mesh = makeShuffledSphere(360, 720);
+	std::cout << "bumpy sphere: " << mesh.indices.size() / 3 << " triangles, " << mesh.vertexCount() << " vertices, shuffled\n";
+	printVertexCacheReport("input", mesh);
+
+	MeshData optimized = mesh;
+	auto start = std::chrono::high_resolution_clock::now();
+	optimizeVertexCache(optimized.indices.data(), optimized.indices.size(), optimized.vertexCount());
+	double cacheMs = millisecondsSince(start);
+	printVertexCacheReport("cache", optimized);
+
+	OverdrawStats before = analyzeOverdraw(optimized.indices.data(), optimized.indices.size(), optimized.positions.data(),
+		optimized.vertexCount());
+	std::vector<uint32_t> cacheOrder = optimized.indices;
+	start = std::chrono::high_resolution_clock::now();
+	optimizeOverdraw(optimized.indices.data(), optimized.indices.size(), optimized.positions.data(), optimized.vertexCount());
+	double overdrawMs = millisecondsSince(start);
+	printVertexCacheReport("overdraw", optimized);
+	OverdrawStats after = analyzeOverdraw(optimized.indices.data(), optimized.indices.size(), optimized.positions.data(),
+		optimized.vertexCount());
+	size_t moved = 0;
+	for (size_t i = 0; i < cacheOrder.size(); i++)
+		moved += cacheOrder[i] != optimized.indices[i];
+	std::cout << std::fixed << std::setprecision(3) << "shaded per covered pixel over 14 views " << before.overdraw
+		<< " -> " << after.overdraw << ", " << moved << " of " << cacheOrder.size() << " indices moved\n";
+
+	start = std::chrono::high_resolution_clock::now();
+	size_t vertexCount;
+	std::vector<uint32_t> remap = optimizeVertexFetch(optimized.indices.data(), optimized.indices.size(), optimized.vertexCount(), vertexCount);
+	remapVertexStream(optimized.positions, 3, remap, vertexCount);
+	remapVertexStream(optimized.normals, 3, remap, vertexCount);
+	remapVertexStream(optimized.texcoords, 2, remap, vertexCount);
+	double fetchMs = millisecondsSince(start);
+
+	std::cout << std::fixed << std::setprecision(1) << "vertex cache " << cacheMs << " ms, overdraw " << overdrawMs
+		<< " ms, vertex fetch " << fetchMs << " ms\n";
+
+	if (!writeObj(objPath, optimized) || !writeMeshFile(meshPath, optimized, MeshLayout::Interleaved))
+		return;
+
+	start = std::chrono::high_resolution_clock::now();
+	MeshData parsed;
+	loadObj(objPath, parsed);
+	double objMs = millisecondsSince(start);
+
+	// reading the whole .mesh into memory, as a loader without mapping would
+	start = std::chrono::high_resolution_clock::now();
+	std::vector<char> bytes;
+	{
+		std::ifstream file(meshPath, std::ios::binary);
+		bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	double readMs = millisecondsSince(start);
+
+	// mapped: open, validate, then touch every page the upload would read
+	start = std::chrono::high_resolution_clock::now();
+	MeshFile mapped;
+	unsigned int checksum = 0;
+	if (mapped.open(meshPath)) {
+		const unsigned char* data = mapped.stream(0);
+		size_t size = (size_t)(mapped.header().fileSize - mapped.header().streams[0].offset);
+		for (size_t i = 0; i < size; i += 4096)
+			checksum += data[i];
+	}
+	double mappedMs = millisecondsSince(start);
+	mapped.close();
+
+	double megabytes = bytes.size() / (1024.0 * 1024.0);
+	std::cout << std::fixed << std::setprecision(1)
+		<< "load  obj " << objMs << " ms   mesh read " << readMs << " ms   mesh mapped " << mappedMs << " ms"
+		<< "   (" << megabytes << " MB, checksum " << checksum << ")\n";
+
+	std::remove(objPath);
+	std::remove(meshPath);
+}
@@ -0,0 +1,24 @@
+#ifndef MESH_IMPORT_H
+#define MESH_IMPORT_H
+
+#include "Mesh.h"
+
+// Reads a Wavefront OBJ (v/vt/vn/f, polygons are fan-triangulated) into 'mesh',
+// merging corners that share position, texture coordinate and normal
+bool loadObj(const char* path, MeshData& mesh);
+
+// Vertex cache order, then overdraw order, then vertex fetch order
+void optimizeMesh(MeshData& mesh);
+
+// Prints ACMR/ATVR of the mesh's index order for 16 and 32 entry FIFO caches
+void printVertexCacheReport(const char* label, const MeshData& mesh);
+
+// Import tool ("NoobOpenGL --import model.obj model.mesh [--split] [--compress]"):
+// loads, optimises and writes a .mesh, reporting cache efficiency before and after
+bool importMesh(const char* source, const char* destination, MeshLayout layout, MeshEncoding encoding);
+
+// Optimisation speed and quality on a large generated mesh, and load times of
+// .mesh (read and mapped) against OBJ
+void runMeshBenchmark();
+
+#endif
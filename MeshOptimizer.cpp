@@ -0,0 +1,409 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+// cache size the scores are tuned for; real hardware caches are 16-32 entries
+static const int scoreCacheSize = 32;
+// valence scores saturate beyond this many live triangles
+static const int maxScoredValence = 32;
+// FIFO size used to find cluster boundaries for the overdraw pass, as analyzeVertexCache's default
+static const int clusterCacheSize = 32;
+// square viewport analyzeOverdraw rasterizes each view into
+static const int overdrawResolution = 256;
+
+static float cacheScores[scoreCacheSize];
+static float valenceScores[maxScoredValence + 1];
+
+static bool buildScoreTables() {
+	for (int i = 0; i < scoreCacheSize; i++) {
+		// the last triangle's vertices get a fixed score so the next triangle doesn't just reuse them
+		if (i < 3)
+			cacheScores[i] = 0.75f;
+		else
+			cacheScores[i] = std::pow(1.0f - (float)(i - 3) / (scoreCacheSize - 3), 1.5f);
+	}
+	valenceScores[0] = 0.0f;
+	for (int v = 1; v <= maxScoredValence; v++)
+		valenceScores[v] = 2.0f / std::sqrt((float)v);
+	return true;
+}
+
+static float vertexScore(int cachePosition, uint32_t liveTriangles) {
+	if (liveTriangles == 0)
+		return -1.0f;
+	float score = cachePosition >= 0 ? cacheScores[cachePosition] : 0.0f;
+	return score + valenceScores[std::min(liveTriangles, (uint32_t)maxScoredValence)];
+}
+
+VertexCacheStats analyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, int cacheSize) {
+	// FIFO: a vertex is cached while fewer than cacheSize misses happened since it was loaded
+	std::vector<size_t> loadedAt(vertexCount, 0);
+	std::vector<unsigned char> referenced(vertexCount, 0);
+	size_t misses = 0, unique = 0;
+	for (size_t i = 0; i < indexCount; i++) {
+		uint32_t v = indices[i];
+		if (!referenced[v]) {
+			referenced[v] = 1;
+			unique++;
+		}
+		if (loadedAt[v] == 0 || misses + 1 - loadedAt[v] > (size_t)cacheSize) {
+			misses++;
+			loadedAt[v] = misses;
+		}
+	}
+
+	VertexCacheStats stats;
+	stats.misses = misses;
+	stats.acmr = indexCount ? (double)misses / (indexCount / 3) : 0.0;
+	stats.atvr = unique ? (double)misses / unique : 0.0;
+	return stats;
+}
+
+// Rasterizes the triangles seen from 'direction' into an orthographic depth buffer in index order
+static void rasterizeView(const uint32_t* indices, size_t indexCount, const float* positions, size_t vertexCount,
+	const float center[3], float radius, const float direction[3], std::vector<float>& depth, OverdrawStats& stats) {
+	// screen axes perpendicular to the view direction
+	float up[3] = { 0.0f, 1.0f, 0.0f };
+	if (std::fabs(direction[1]) > 0.9f) {
+		up[1] = 0.0f;
+		up[2] = 1.0f;
+	}
+	float right[3] = { direction[1] * up[2] - direction[2] * up[1], direction[2] * up[0] - direction[0] * up[2],
+		direction[0] * up[1] - direction[1] * up[0] };
+	float rightLength = std::sqrt(right[0] * right[0] + right[1] * right[1] + right[2] * right[2]);
+	for (int k = 0; k < 3; k++)
+		right[k] /= rightLength;
+	float screenUp[3] = { right[1] * direction[2] - right[2] * direction[1], right[2] * direction[0] - right[0] * direction[2],
+		right[0] * direction[1] - right[1] * direction[0] };
+
+	// x, y in pixels and depth along the view direction per vertex
+	std::vector<float> projected(vertexCount * 3);
+	float scale = overdrawResolution * 0.5f / radius;
+	for (size_t v = 0; v < vertexCount; v++) {
+		const float* p = &positions[v * 3];
+		float d[3] = { p[0] - center[0], p[1] - center[1], p[2] - center[2] };
+		projected[v * 3] = (d[0] * right[0] + d[1] * right[1] + d[2] * right[2]) * scale + overdrawResolution * 0.5f;
+		projected[v * 3 + 1] = (d[0] * screenUp[0] + d[1] * screenUp[1] + d[2] * screenUp[2]) * scale + overdrawResolution * 0.5f;
+		projected[v * 3 + 2] = d[0] * direction[0] + d[1] * direction[1] + d[2] * direction[2];
+	}
+
+	std::fill(depth.begin(), depth.end(), FLT_MAX);
+	for (size_t i = 0; i + 2 < indexCount; i += 3) {
+		const float* a = &projected[indices[i] * 3];
+		const float* b = &projected[indices[i + 1] * 3];
+		const float* c = &projected[indices[i + 2] * 3];
+		// looking along +direction with screen axes (right, up), front faces wind counter-clockwise
+		float area = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+		if (area <= 0.0f)
+			continue;
+		int minX = std::max(0, (int)std::ceil(std::min(a[0], std::min(b[0], c[0])) - 0.5f));
+		int maxX = std::min(overdrawResolution - 1, (int)std::floor(std::max(a[0], std::max(b[0], c[0])) - 0.5f));
+		int minY = std::max(0, (int)std::ceil(std::min(a[1], std::min(b[1], c[1])) - 0.5f));
+		int maxY = std::min(overdrawResolution - 1, (int)std::floor(std::max(a[1], std::max(b[1], c[1])) - 0.5f));
+		for (int y = minY; y <= maxY; y++) {
+			for (int x = minX; x <= maxX; x++) {
+				float px = x + 0.5f, py = y + 0.5f;
+				float w0 = (c[0] - b[0]) * (py - b[1]) - (c[1] - b[1]) * (px - b[0]);
+				float w1 = (a[0] - c[0]) * (py - c[1]) - (a[1] - c[1]) * (px - c[0]);
+				float w2 = (b[0] - a[0]) * (py - a[1]) - (b[1] - a[1]) * (px - a[0]);
+				if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f)
+					continue;
+				float z = (w0 * a[2] + w1 * b[2] + w2 * c[2]) / area;
+				float& stored = depth[(size_t)y * overdrawResolution + x];
+				if (z < stored) {
+					if (stored == FLT_MAX)
+						stats.covered++;
+					stored = z;
+					stats.shaded++;
+				}
+			}
+		}
+	}
+}
+
+OverdrawStats analyzeOverdraw(const uint32_t* indices, size_t indexCount, const float* positions, size_t vertexCount) {
+	OverdrawStats stats = { 0, 0, 0.0 };
+	if (indexCount < 3 || vertexCount == 0)
+		return stats;
+
+	// bounding sphere around the box center, so every view frames the whole mesh
+	float lo[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, hi[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for (size_t v = 0; v < vertexCount; v++) {
+		for (int k = 0; k < 3; k++) {
+			lo[k] = std::min(lo[k], positions[v * 3 + k]);
+			hi[k] = std::max(hi[k], positions[v * 3 + k]);
+		}
+	}
+	float center[3] = { (lo[0] + hi[0]) * 0.5f, (lo[1] + hi[1]) * 0.5f, (lo[2] + hi[2]) * 0.5f };
+	float radius = 0.0f;
+	for (size_t v = 0; v < vertexCount; v++) {
+		float d[3] = { positions[v * 3] - center[0], positions[v * 3 + 1] - center[1], positions[v * 3 + 2] - center[2] };
+		radius = std::max(radius, std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]));
+	}
+	if (radius <= 0.0f)
+		return stats;
+
+	std::vector<float> depth((size_t)overdrawResolution * overdrawResolution);
+	const float diagonal = 0.57735027f;
+	for (int axis = 0; axis < 3; axis++) {
+		for (float sign = -1.0f; sign <= 1.0f; sign += 2.0f) {
+			float direction[3] = { 0.0f, 0.0f, 0.0f };
+			direction[axis] = sign;
+			rasterizeView(indices, indexCount, positions, vertexCount, center, radius, direction, depth, stats);
+		}
+	}
+	for (int corner = 0; corner < 8; corner++) {
+		float direction[3] = { corner & 1 ? diagonal : -diagonal, corner & 2 ? diagonal : -diagonal, corner & 4 ? diagonal : -diagonal };
+		rasterizeView(indices, indexCount, positions, vertexCount, center, radius, direction, depth, stats);
+	}
+	stats.overdraw = stats.covered ? (double)stats.shaded / stats.covered : 0.0;
+	return stats;
+}
+
+void optimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount) {
+	static const bool tablesBuilt = buildScoreTables();
+	(void)tablesBuilt;
+
+	size_t triangleCount = indexCount / 3;
+	if (triangleCount == 0)
+		return;
+
+	// vertex -> triangle adjacency; the first live[v] entries of a vertex's range are its unemitted triangles
+	std::vector<uint32_t> live(vertexCount, 0);
+	for (size_t i = 0; i < triangleCount * 3; i++)
+		live[indices[i]]++;
+	std::vector<uint32_t> offsets(vertexCount + 1, 0);
+	for (size_t v = 0; v < vertexCount; v++)
+		offsets[v + 1] = offsets[v] + live[v];
+	std::vector<uint32_t> adjacency(triangleCount * 3);
+	{
+		std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+			adjacency[fill[indices[i]]++] = (uint32_t)(i / 3);
+	}
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> scores(vertexCount);
+	for (size_t v = 0; v < vertexCount; v++)
+		scores[v] = vertexScore(-1, live[v]);
+	std::vector<float> triangleScores(triangleCount);
+	for (size_t t = 0; t < triangleCount; t++)
+		triangleScores[t] = scores[indices[t * 3]] + scores[indices[t * 3 + 1]] + scores[indices[t * 3 + 2]];
+	std::vector<unsigned char> emitted(triangleCount, 0);
+
+	std::vector<uint32_t> output(triangleCount * 3);
+	uint32_t cache[scoreCacheSize + 3];
+	int cacheCount = 0;
+	size_t cursor = 0;
+
+	int64_t best = std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin();
+	for (size_t n = 0; n < triangleCount; n++) {
+		// nothing adjacent to the cache is left: continue with the next unemitted triangle
+		if (best < 0) {
+			while (emitted[cursor])
+				cursor++;
+			best = (int64_t)cursor;
+		}
+
+		size_t triangle = (size_t)best;
+		const uint32_t* corners = &indices[triangle * 3];
+		output[n * 3] = corners[0];
+		output[n * 3 + 1] = corners[1];
+		output[n * 3 + 2] = corners[2];
+		emitted[triangle] = 1;
+
+		for (int k = 0; k < 3; k++) {
+			uint32_t v = corners[k];
+			uint32_t* list = &adjacency[offsets[v]];
+			uint32_t* end = list + live[v];
+			uint32_t* found = std::find(list, end, (uint32_t)triangle);
+			if (found != end) {
+				*found = *(end - 1);
+				live[v]--;
+			}
+		}
+
+		// the triangle's vertices move to the front, the rest shifts back
+		uint32_t newCache[scoreCacheSize + 3];
+		int newCount = 0;
+		for (int k = 0; k < 3; k++) {
+			if (std::find(newCache, newCache + newCount, corners[k]) == newCache + newCount)
+				newCache[newCount++] = corners[k];
+		}
+		for (int i = 0; i < cacheCount; i++) {
+			uint32_t v = cache[i];
+			if (v != corners[0] && v != corners[1] && v != corners[2])
+				newCache[newCount++] = v;
+		}
+
+		// update scores of everything that moved, including vertices that fell out
+		for (int i = 0; i < newCount; i++) {
+			uint32_t v = newCache[i];
+			int position = i < scoreCacheSize ? i : -1;
+			cachePosition[v] = position;
+			float score = vertexScore(position, live[v]);
+			float delta = score - scores[v];
+			scores[v] = score;
+			for (uint32_t a = offsets[v]; a < offsets[v] + live[v]; a++)
+				triangleScores[adjacency[a]] += delta;
+		}
+		cacheCount = std::min(newCount, scoreCacheSize);
+		for (int i = 0; i < cacheCount; i++)
+			cache[i] = newCache[i];
+
+		best = -1;
+		float bestScore = -1.0f;
+		for (int i = 0; i < cacheCount; i++) {
+			uint32_t v = cache[i];
+			for (uint32_t a = offsets[v]; a < offsets[v] + live[v]; a++) {
+				uint32_t t = adjacency[a];
+				if (triangleScores[t] > bestScore) {
+					bestScore = triangleScores[t];
+					best = t;
+				}
+			}
+		}
+	}
+
+	std::copy(output.begin(), output.end(), indices);
+}
+
+struct Cluster
+{
+	size_t first, last;		// triangle range in the input order
+	float sortKey;
+};
+
+// Concatenates the clusters in front-to-back-of-mesh order
+static void sortClusters(const uint32_t* indices, const float* positions, std::vector<Cluster>& clusters,
+	const float meshCenter[3], std::vector<uint32_t>& out) {
+	for (Cluster& cluster : clusters) {
+		float center[3] = { 0.0f, 0.0f, 0.0f }, normal[3] = { 0.0f, 0.0f, 0.0f };
+		float totalArea = 0.0f;
+		for (size_t t = cluster.first; t < cluster.last; t++) {
+			const float* a = &positions[indices[t * 3] * 3];
+			const float* b = &positions[indices[t * 3 + 1] * 3];
+			const float* c = &positions[indices[t * 3 + 2] * 3];
+			float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			float e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+			float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			float area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			for (int k = 0; k < 3; k++) {
+				center[k] += (a[k] + b[k] + c[k]) / 3.0f * area;
+				normal[k] += n[k];
+			}
+			totalArea += area;
+		}
+		float normalLength = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		if (totalArea <= 0.0f || normalLength <= 0.0f) {
+			cluster.sortKey = 0.0f;
+			continue;
+		}
+		// how far the cluster faces away from the mesh center: those occlude the rest from most views
+		cluster.sortKey = 0.0f;
+		for (int k = 0; k < 3; k++)
+			cluster.sortKey += (center[k] / totalArea - meshCenter[k]) * normal[k] / normalLength;
+	}
+
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+	out.clear();
+	for (const Cluster& cluster : clusters)
+		out.insert(out.end(), indices + cluster.first * 3, indices + cluster.last * 3);
+}
+
+void optimizeOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t vertexCount, float threshold) {
+	size_t triangleCount = indexCount / 3;
+	if (triangleCount == 0)
+		return;
+
+	// area-weighted mesh center
+	float meshCenter[3] = { 0.0f, 0.0f, 0.0f };
+	{
+		double sum[3] = { 0.0, 0.0, 0.0 }, totalArea = 0.0;
+		for (size_t t = 0; t < triangleCount; t++) {
+			const float* a = &positions[indices[t * 3] * 3];
+			const float* b = &positions[indices[t * 3 + 1] * 3];
+			const float* c = &positions[indices[t * 3 + 2] * 3];
+			double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			double e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+			double n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			for (int k = 0; k < 3; k++)
+				sum[k] += (a[k] + b[k] + c[k]) / 3.0 * area;
+			totalArea += area;
+		}
+		if (totalArea > 0.0) {
+			for (int k = 0; k < 3; k++)
+				meshCenter[k] = (float)(sum[k] / totalArea);
+		}
+	}
+
+	// soft boundaries (Sander et al.): each cluster simulates the cache from cold and closes
+	// as soon as its own ACMR is down to the limit, so it has paid for its cold start and
+	// can be moved without dragging the whole list above the limit
+	double limit = analyzeVertexCache(indices, indexCount, vertexCount, clusterCacheSize).acmr * threshold;
+	std::vector<size_t> starts(1, 0);
+	{
+		std::vector<size_t> loadedAt(vertexCount, 0);
+		size_t misses = 0, clusterMisses = 0;
+		for (size_t t = 0; t < triangleCount; t++) {
+			for (int k = 0; k < 3; k++) {
+				uint32_t v = indices[t * 3 + k];
+				// vertices loaded before the cluster started count as missing
+				if (loadedAt[v] <= misses - clusterMisses || misses + 1 - loadedAt[v] > (size_t)clusterCacheSize) {
+					misses++;
+					clusterMisses++;
+					loadedAt[v] = misses;
+				}
+			}
+			if (clusterMisses <= limit * (t + 1 - starts.back()) && t + 1 < triangleCount) {
+				starts.push_back(t + 1);
+				clusterMisses = 0;
+			}
+		}
+	}
+
+	std::vector<uint32_t> reordered;
+	std::vector<Cluster> clusters;
+	while (starts.size() > 1) {
+		clusters.clear();
+		for (size_t i = 0; i < starts.size(); i++)
+			clusters.push_back({ starts[i], i + 1 < starts.size() ? starts[i + 1] : triangleCount, 0.0f });
+		sortClusters(indices, positions, clusters, meshCenter, reordered);
+		if (analyzeVertexCache(reordered.data(), reordered.size(), vertexCount, clusterCacheSize).acmr <= limit) {
+			std::copy(reordered.begin(), reordered.end(), indices);
+			return;
+		}
+		// too many seams: halve the cluster count and try again
+		std::vector<size_t> merged;
+		for (size_t i = 0; i < starts.size(); i += 2)
+			merged.push_back(starts[i]);
+		starts.swap(merged);
+	}
+}
+
+std::vector<uint32_t> optimizeVertexFetch(uint32_t* indices, size_t indexCount, size_t vertexCount, size_t& newVertexCount) {
+	std::vector<uint32_t> remap(vertexCount, ~0u);
+	uint32_t next = 0;
+	for (size_t i = 0; i < indexCount; i++) {
+		uint32_t& v = indices[i];
+		if (remap[v] == ~0u)
+			remap[v] = next++;
+		v = remap[v];
+	}
+	newVertexCount = next;
+	return remap;
+}
+
+void remapVertexStream(std::vector<float>& values, int components, const std::vector<uint32_t>& remap, size_t newVertexCount) {
+	if (values.empty())
+		return;
+	std::vector<float> remapped(newVertexCount * components);
+	for (size_t v = 0; v < remap.size(); v++) {
+		if (remap[v] != ~0u)
+			std::copy(&values[v * components], &values[v * components] + components, &remapped[remap[v] * components]);
+	}
+	values.swap(remapped);
+}
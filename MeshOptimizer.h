@@ -0,0 +1,52 @@
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Post-transform vertex cache efficiency of a triangle list, simulated with a FIFO cache
+struct VertexCacheStats
+{
+	size_t misses;		// vertices transformed
+	double acmr;		// average cache miss ratio: misses per triangle (0.5 is ideal for large grids, 3 is worst)
+	double atvr;		// average transformed vertex ratio: misses per referenced vertex (1 is ideal)
+};
+
+VertexCacheStats analyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount, int cacheSize = 32);
+
+// Pixel shading cost of a triangle list, independent of any one camera: the mesh is
+// rasterized orthographically from 14 directions around it (axes and diagonals) with
+// back-face culling (counter-clockwise front faces) and a depth test, in index order
+struct OverdrawStats
+{
+	size_t covered;		// pixels showing the mesh, summed over the views
+	size_t shaded;		// fragments that passed the depth test
+	double overdraw;	// shaded per covered pixel (1 is ideal)
+};
+
+OverdrawStats analyzeOverdraw(const uint32_t* indices, size_t indexCount, const float* positions, size_t vertexCount);
+
+// Reorders triangles for post-transform cache locality (Tom Forsyth's linear-speed
+// vertex cache optimisation). Scores favour vertices recently used and vertices with
+// few remaining triangles, so strips are finished instead of leaving islands.
+void optimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount);
+
+// Reorders clusters of an already cache-optimised list so outward-facing parts are
+// drawn first and hide what is behind them (after Sander et al., "Fast Triangle
+// Reordering for Vertex Locality and Reduced Overdraw"). A cluster ends once its own ACMR,
+// counted from a cold cache, is within the limit; 'threshold' sets that limit and bounds the
+// ACMR increase of the whole list (1.05 = 5%). Measure the result with analyzeOverdraw.
+void optimizeOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t vertexCount,
+	float threshold = 1.05f);
+
+// Vertex order matching first use in the index buffer, so vertex fetch walks memory
+// linearly. Rewrites 'indices' and returns remap[old] = new (~0u for unused vertices);
+// apply it to every attribute with remapVertexStream. 'newVertexCount' receives the
+// number of referenced vertices.
+std::vector<uint32_t> optimizeVertexFetch(uint32_t* indices, size_t indexCount, size_t vertexCount, size_t& newVertexCount);
+
+// Moves 'components' floats per vertex to their remapped position, dropping unused vertices
+void remapVertexStream(std::vector<float>& values, int components, const std::vector<uint32_t>& remap, size_t newVertexCount);
+
+#endif
@@ -0,0 +1,245 @@
+#include "MipGenerator.h"
+#include "GLCapabilities.h"
+#include "TextureUpload.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MIP_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MIP_NEON
+#endif
+
+// Images are filtered as interleaved linear RGBA floats, one texel per SIMD register
+struct FloatImage
+{
+	int width, height;
+	std::vector<float> texels;
+};
+
+struct FilterKernel
+{
+	int firstTap;	// offset of the first tap from 2 * destination index
+	std::vector<float> weights;
+};
+
+static float srgbToLinearTable[256];
+static unsigned char linearToSrgbTable[4096];
+
+static void buildTables() {
+	for (int i = 0; i < 256; i++) {
+		float c = i / 255.0f;
+		srgbToLinearTable[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+	}
+	for (int i = 0; i < 4096; i++) {
+		float l = i / 4095.0f;
+		float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+		linearToSrgbTable[i] = (unsigned char)(c * 255.0f + 0.5f);
+	}
+}
+
+static bool isAlphaChannel(int channel, int channels) {
+	return (channels == 2 && channel == 1) || (channels == 4 && channel == 3);
+}
+
+static FilterKernel makeKernel(MipFilter filter) {
+	FilterKernel kernel;
+	if (filter == MipFilter::Box) {
+		kernel.firstTap = 0;
+		kernel.weights = { 0.5f, 0.5f };
+		return kernel;
+	}
+
+	// zeroth order modified Bessel function, for the Kaiser window
+	auto bessel0 = [](double x) {
+		double sum = 1.0, term = 1.0;
+		for (int k = 1; k < 20; k++) {
+			term *= (x / (2.0 * k)) * (x / (2.0 * k));
+			sum += term;
+		}
+		return sum;
+	};
+	const double pi = 3.14159265358979323846;
+	const double alpha = 4.0;
+	const double radius = 3.0;
+
+	kernel.firstTap = -2;
+	float total = 0.0f;
+	for (int tap = -2; tap <= 3; tap++) {
+		// distance from the destination texel center, measured in source texels
+		double d = tap - 0.5;
+		double x = d / 2.0;
+		double sinc = std::sin(pi * x) / (pi * x);
+		double r = d / radius;
+		double window = bessel0(alpha * std::sqrt(std::max(0.0, 1.0 - r * r))) / bessel0(alpha);
+		kernel.weights.push_back((float)(sinc * window));
+		total += kernel.weights.back();
+	}
+	for (float& w : kernel.weights)
+		w /= total;
+	return kernel;
+}
+
+static void parallelRows(int rows, int threads, const std::function<void(int, int)>& work) {
+	threads = std::max(1, std::min(threads, rows));
+	int rowsPerThread = (rows + threads - 1) / threads;
+	std::vector<std::thread> workers;
+	for (int t = 1; t < threads; t++) {
+		int first = t * rowsPerThread;
+		int last = std::min(rows, first + rowsPerThread);
+		if (first < last)
+			workers.emplace_back(work, first, last);
+	}
+	work(0, std::min(rows, rowsPerThread));
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+// dst[i] = sum of weights[k] * src[2i + firstTap + k], clamped at the edges
+static void filterLine(const float* src, int srcCount, size_t srcStride, float* dst, int dstCount, size_t dstStride, const FilterKernel& kernel) {
+	int taps = (int)kernel.weights.size();
+	for (int i = 0; i < dstCount; i++) {
+#if defined(MIP_SSE2)
+		__m128 sum = _mm_setzero_ps();
+		for (int k = 0; k < taps; k++) {
+			int s = std::min(std::max(2 * i + kernel.firstTap + k, 0), srcCount - 1);
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel.weights[k]), _mm_loadu_ps(src + s * srcStride)));
+		}
+		_mm_storeu_ps(dst + i * dstStride, sum);
+#elif defined(MIP_NEON)
+		float32x4_t sum = vdupq_n_f32(0.0f);
+		for (int k = 0; k < taps; k++) {
+			int s = std::min(std::max(2 * i + kernel.firstTap + k, 0), srcCount - 1);
+			sum = vmlaq_n_f32(sum, vld1q_f32(src + s * srcStride), kernel.weights[k]);
+		}
+		vst1q_f32(dst + i * dstStride, sum);
+#else
+		float sum[4] = { 0, 0, 0, 0 };
+		for (int k = 0; k < taps; k++) {
+			int s = std::min(std::max(2 * i + kernel.firstTap + k, 0), srcCount - 1);
+			for (int c = 0; c < 4; c++)
+				sum[c] += kernel.weights[k] * src[s * srcStride + c];
+		}
+		for (int c = 0; c < 4; c++)
+			dst[i * dstStride + c] = sum[c];
+#endif
+	}
+}
+
+static FloatImage downsample(const FloatImage& src, const FilterKernel& kernel, int threads) {
+	FloatImage dst;
+	dst.width = std::max(1, src.width / 2);
+	dst.height = std::max(1, src.height / 2);
+	dst.texels.resize((size_t)dst.width * dst.height * 4);
+
+	// a dimension that is already 1 is copied through instead of filtered
+	FloatImage horizontal;
+	horizontal.width = dst.width;
+	horizontal.height = src.height;
+	horizontal.texels.resize((size_t)horizontal.width * horizontal.height * 4);
+
+	parallelRows(src.height, threads, [&](int first, int last) {
+		for (int y = first; y < last; y++) {
+			const float* in = &src.texels[(size_t)y * src.width * 4];
+			float* out = &horizontal.texels[(size_t)y * horizontal.width * 4];
+			if (src.width == 1)
+				std::copy(in, in + 4, out);
+			else
+				filterLine(in, src.width, 4, out, dst.width, 4, kernel);
+		}
+	});
+
+	size_t rowStride = (size_t)dst.width * 4;
+	parallelRows(dst.width, threads, [&](int first, int last) {
+		for (int x = first; x < last; x++) {
+			const float* in = &horizontal.texels[(size_t)x * 4];
+			float* out = &dst.texels[(size_t)x * 4];
+			if (src.height == 1)
+				std::copy(in, in + 4, out);
+			else
+				filterLine(in, src.height, rowStride, out, dst.height, rowStride, kernel);
+		}
+	});
+	return dst;
+}
+
+static MipLevel encodeLevel(const FloatImage& image, int channels, bool srgb) {
+	MipLevel level;
+	level.width = image.width;
+	level.height = image.height;
+	level.data.resize((size_t)image.width * image.height * channels);
+	for (size_t i = 0; i < (size_t)image.width * image.height; i++) {
+		for (int c = 0; c < channels; c++) {
+			float v = std::min(std::max(image.texels[i * 4 + c], 0.0f), 1.0f);
+			if (srgb && !isAlphaChannel(c, channels))
+				level.data[i * channels + c] = linearToSrgbTable[(int)(v * 4095.0f + 0.5f)];
+			else
+				level.data[i * channels + c] = (unsigned char)(v * 255.0f + 0.5f);
+		}
+	}
+	return level;
+}
+
+std::vector<MipLevel> generateMipChain(const unsigned char* data, int width, int height, int channels,
+	MipFilter filter, bool srgb, int threads) {
+	std::vector<MipLevel> levels;
+	if (data == NULL || width <= 0 || height <= 0 || channels < 1 || channels > 4)
+		return levels;
+	// function-local static so concurrent loader threads build the tables once
+	static const bool tablesBuilt = (buildTables(), true);
+	(void)tablesBuilt;
+	if (threads <= 0)
+		threads = (int)std::max(1u, std::thread::hardware_concurrency());
+
+	MipLevel base;
+	base.width = width;
+	base.height = height;
+	base.data.assign(data, data + (size_t)width * height * channels);
+	levels.push_back(base);
+
+	FloatImage current;
+	current.width = width;
+	current.height = height;
+	current.texels.assign((size_t)width * height * 4, 0.0f);
+	for (size_t i = 0; i < (size_t)width * height; i++) {
+		for (int c = 0; c < channels; c++) {
+			unsigned char v = data[i * channels + c];
+			current.texels[i * 4 + c] = (srgb && !isAlphaChannel(c, channels)) ? srgbToLinearTable[v] : v / 255.0f;
+		}
+	}
+
+	// each level filters the previous float level, so quantization error doesn't accumulate
+	FilterKernel kernel = makeKernel(filter);
+	while (current.width > 1 || current.height > 1) {
+		current = downsample(current, kernel, threads);
+		levels.push_back(encodeLevel(current, channels, srgb));
+	}
+	return levels;
+}
+
+GLuint uploadMipChain(const std::vector<MipLevel>& levels, int channels, GLint filter, GLint wrap) {
+	if (levels.empty() || channels < 1 || channels > 4)
+		return 0;
+
+	// storage for the whole chain up front, then each level is a sub image upload
+	UploadFormat fmt = chooseUploadFormat(channels);
+	GLuint texture = allocateTexture2D(fmt.internalFormat, levels[0].width, levels[0].height, (int)levels.size(),
+		fmt.format, fmt.type, filter, wrap);
+	bool directStateAccess = glCapabilities().texturePath == TexturePath::DirectStateAccess;
+	GLint previous = 0;
+	if (!directStateAccess) {
+		glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+		glBindTexture(GL_TEXTURE_2D, texture);
+	}
+	applyChannelSwizzle(directStateAccess ? texture : 0, channels);
+	for (size_t i = 0; i < levels.size(); i++)
+		uploadTextureSubLevel(directStateAccess ? texture : 0, (GLint)i, levels[i].width, levels[i].height, channels,
+			levels[i].data.data());
+	if (!directStateAccess)
+		glBindTexture(GL_TEXTURE_2D, previous);
+	return texture;
+}
@@ -0,0 +1,33 @@
+#ifndef MIP_GENERATOR_H
+#define MIP_GENERATOR_H
+
+#include <glad/glad.h>
+#include <vector>
+
+enum class MipFilter
+{
+	Box,	// 2x2 average
+	Kaiser	// 6-tap Kaiser-windowed sinc, sharper with less aliasing
+};
+
+struct MipLevel
+{
+	int width, height;
+	std::vector<unsigned char> data;
+};
+
+// Builds the full mip chain (level 0 included) for an 8-bit image with 1 to 4 channels.
+// With 'srgb' set, color channels are decoded to linear light before filtering and
+// re-encoded afterwards; alpha is always filtered as-is.
+// Rows of each level are split over 'threads' workers; 0 picks one per hardware thread.
+std::vector<MipLevel> generateMipChain(const unsigned char* data, int width, int height, int channels,
+	MipFilter filter = MipFilter::Box, bool srgb = true, int threads = 0);
+
+// Creates a texture holding every level through allocateTexture2D's selected path and
+// uploads the levels, replacing glGenerateMipmap. 'filter' is used for minification and
+// magnification. Grey and grey+alpha chains get chooseUploadFormat's swizzle so they sample
+// like RGB(A). Returns 0 on invalid input; leaves the GL_TEXTURE_2D binding as it was.
+GLuint uploadMipChain(const std::vector<MipLevel>& levels, int channels, GLint filter = GL_LINEAR,
+	GLint wrap = GL_CLAMP_TO_EDGE);
+
+#endif
@@ -0,0 +1,59 @@
+#include "RedrawTracker.h"
+
+static double seconds(std::chrono::steady_clock::duration d) {
+	return std::chrono::duration<double>(d).count();
+}
+
+RedrawTracker::RedrawTracker(bool onDemand)
+	// the first frame always has to be drawn
+	: dirty(true), onDemand(onDemand), idledSinceDraw(false), resumed(false), busySince(Clock::now()) {
+	counters = { 0, 0, 0.0, 0.0 };
+}
+
+void RedrawTracker::setOnDemand(bool enabled) {
+	onDemand = enabled;
+	markDirty();
+}
+
+void RedrawTracker::markDirty() {
+	// only the clean -> dirty transition needs to wake the loop
+	if (!dirty.exchange(true))
+		glfwPostEmptyEvent();
+}
+
+bool RedrawTracker::beginFrame() {
+	if (dirty.exchange(false) || !onDemand) {
+		counters.drawnFrames++;
+		resumed = idledSinceDraw;
+		idledSinceDraw = false;
+		return true;
+	}
+	counters.skippedFrames++;
+	idledSinceDraw = true;
+	return false;
+}
+
+bool RedrawTracker::idleSinceLastFrame() const {
+	return resumed;
+}
+
+void RedrawTracker::waitEvents(double timeout) {
+	if (dirty.load() || !onDemand) {
+		glfwPollEvents();
+		return;
+	}
+
+	idledSinceDraw = true;
+	Clock::time_point start = Clock::now();
+	counters.busySeconds += seconds(start - busySince);
+	if (timeout > 0.0)
+		glfwWaitEventsTimeout(timeout);
+	else
+		glfwWaitEvents();
+	busySince = Clock::now();
+	counters.waitSeconds += seconds(busySince - start);
+}
+
+const RedrawStats& RedrawTracker::stats() const {
+	return counters;
+}
@@ -0,0 +1,56 @@
+#ifndef REDRAW_TRACKER_H
+#define REDRAW_TRACKER_H
+
+#include <GLFW/glfw3.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+struct RedrawStats
+{
+	size_t drawnFrames;
+	size_t skippedFrames;	// loop iterations that woke up but had nothing to draw
+	double busySeconds;		// time spent outside glfwWaitEvents
+	double waitSeconds;		// time spent blocked in glfwWaitEvents
+};
+
+// On-demand redraw: anything that changes what is on screen (uniform changes,
+// input, resizes, finished texture uploads) marks the frame dirty, and the loop
+// only draws dirty frames. Between them it blocks in glfwWaitEvents instead of
+// redrawing identical content. Continuous mode restores the draw-every-iteration loop.
+class RedrawTracker
+{
+public:
+	RedrawTracker(bool onDemand = true);
+
+	void setOnDemand(bool enabled);
+
+	// Safe from any thread; wakes a loop blocked in waitEvents()
+	void markDirty();
+
+	// Call once per loop iteration. True if the frame has to be drawn; clears the flag.
+	bool beginFrame();
+
+	// True if the loop skipped or blocked before the frame beginFrame() just allowed, i.e.
+	// frame timing should restart instead of counting the idle gap as one long frame
+	bool idleSinceLastFrame() const;
+
+	// Pumps window events. Polls while a redraw is pending (or in continuous mode),
+	// otherwise blocks until an event arrives; 'timeout' > 0 bounds the block, e.g.
+	// while held keys still need to be integrated.
+	void waitEvents(double timeout = 0.0);
+
+	const RedrawStats& stats() const;
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	std::atomic<bool> dirty;
+	bool onDemand;
+	bool idledSinceDraw;
+	bool resumed;
+	RedrawStats counters;
+	Clock::time_point busySince;
+};
+
+#endif
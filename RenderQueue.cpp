@@ -0,0 +1,301 @@
+#include "RenderQueue.h"
+#include "GLCapabilities.h"
+#include "StreamBuffer.h"
+#include <algorithm>
+#include <cstring>
+
+// A few frames of indirect commands; at 20 bytes a command that is ~50k merged draws
+static const size_t indirectBufferSize = 1 << 20;
+
+static uint64_t quantizeDepth(float depth) {
+	float d = std::min(std::max(depth, 0.0f), 1.0f);
+	return (uint64_t)(d * 0xFFFFFF);
+}
+
+uint64_t opaqueSortKey(unsigned int layer, unsigned int program, unsigned int material, float depth) {
+	return ((uint64_t)(layer & 0xF) << 60)
+		| ((uint64_t)(program & 0xFFF) << 47)
+		| ((uint64_t)(material & 0xFFF) << 35)
+		| (quantizeDepth(depth) << 11);
+}
+
+uint64_t translucentSortKey(unsigned int layer, float depth, unsigned int program) {
+	return ((uint64_t)(layer & 0xF) << 60)
+		| ((uint64_t)1 << 59)
+		| ((0xFFFFFF - quantizeDepth(depth)) << 35)
+		| ((uint64_t)(program & 0xFFF) << 23);
+}
+
+// ---------------- CommandBuffer ----------------
+
+DrawPacket& CommandBuffer::draw(uint64_t key, GLuint program, GLuint vao, GLenum mode, GLsizei count,
+	GLenum indexType, size_t first, GLsizei instanceCount) {
+	DrawPacket packet;
+	packet.key = key;
+	packet.program = program;
+	packet.vao = vao;
+	for (int i = 0; i < maxPacketTextures; i++)
+		packet.textures[i] = 0;
+	packet.mode = mode;
+	packet.count = count;
+	packet.indexType = indexType;
+	packet.first = first;
+	packet.instanceCount = instanceCount;
+	packet.firstUniform = (uint32_t)uniforms.size();
+	packet.uniformCount = 0;
+	packets.push_back(packet);
+	return packets.back();
+}
+
+void CommandBuffer::setInt(GLint location, int value) {
+	float bits;
+	memcpy(&bits, &value, sizeof(bits));
+	addUniform(location, UniformInt, &bits, 1);
+}
+
+void CommandBuffer::setFloat(GLint location, float value) {
+	addUniform(location, UniformFloat, &value, 1);
+}
+
+void CommandBuffer::setVec4(GLint location, const vec4& value) {
+	addUniform(location, UniformVec4, &value.x, 4);
+}
+
+void CommandBuffer::setMat4(GLint location, const mat4& value) {
+	addUniform(location, UniformMat4, value.data(), 16);
+}
+
+void CommandBuffer::clear() {
+	packets.clear();
+	uniforms.clear();
+	data.clear();
+}
+
+size_t CommandBuffer::packetCount() const {
+	return packets.size();
+}
+
+void CommandBuffer::addUniform(GLint location, UniformType type, const float* values, int count) {
+	if (packets.empty() || location < 0)
+		return;
+	uniforms.push_back({ location, type, (uint32_t)data.size() });
+	data.insert(data.end(), values, values + count);
+	packets.back().uniformCount++;
+}
+
+// ---------------- RenderQueue ----------------
+
+RenderQueue::RenderQueue(int recordingThreads)
+	: buffers(std::max(recordingThreads, 1)) {
+	lastStats = { 0, 0, 0, 0, 0 };
+}
+
+RenderQueue::~RenderQueue() {
+}
+
+CommandBuffer& RenderQueue::buffer(int index) {
+	return buffers[index];
+}
+
+int RenderQueue::bufferCount() const {
+	return (int)buffers.size();
+}
+
+void RenderQueue::execute() {
+	items.clear();
+	for (size_t b = 0; b < buffers.size(); b++) {
+		const std::vector<DrawPacket>& packets = buffers[b].packets;
+		for (size_t p = 0; p < packets.size(); p++)
+			items.push_back({ packets[p].key, (uint32_t)b, (uint32_t)p });
+	}
+	radixSort();
+
+	RenderQueueStats stats = { 0, 0, 0, 0, 0 };
+	bool indirect = glCapabilities().drawPath == DrawPath::MultiDrawIndirect;
+	// unknown GL state on entry, so the first packet binds everything
+	GLuint program = ~0u, vao = ~0u;
+	GLuint textures[maxPacketTextures];
+	for (int i = 0; i < maxPacketTextures; i++)
+		textures[i] = ~0u;
+	int activeUnit = -1;
+
+	for (size_t i = 0; i < items.size();) {
+		const SortItem& item = items[i];
+		const CommandBuffer& cb = buffers[item.buffer];
+		const DrawPacket& packet = cb.packets[item.packet];
+
+		if (packet.program != program) {
+			glUseProgram(packet.program);
+			program = packet.program;
+			stats.programChanges++;
+		}
+		if (packet.vao != vao) {
+			glBindVertexArray(packet.vao);
+			vao = packet.vao;
+			stats.vaoChanges++;
+		}
+		for (int unit = 0; unit < maxPacketTextures; unit++) {
+			if (packet.textures[unit] == 0 || packet.textures[unit] == textures[unit])
+				continue;
+			if (unit != activeUnit) {
+				glActiveTexture(GL_TEXTURE0 + unit);
+				activeUnit = unit;
+			}
+			glBindTexture(GL_TEXTURE_2D, packet.textures[unit]);
+			textures[unit] = packet.textures[unit];
+			stats.textureChanges++;
+		}
+
+		for (uint32_t u = packet.firstUniform; u < packet.firstUniform + packet.uniformCount; u++) {
+			const CommandBuffer::UniformValue& uniform = cb.uniforms[u];
+			const float* values = &cb.data[uniform.offset];
+			switch (uniform.type) {
+			case CommandBuffer::UniformInt: {
+				int value;
+				memcpy(&value, values, sizeof(value));
+				glUniform1i(uniform.location, value);
+				break;
+			}
+			case CommandBuffer::UniformFloat: glUniform1f(uniform.location, values[0]); break;
+			case CommandBuffer::UniformVec4: glUniform4fv(uniform.location, 1, values); break;
+			case CommandBuffer::UniformMat4: glUniformMatrix4fv(uniform.location, 1, GL_FALSE, values); break;
+			}
+		}
+
+		if (indirect) {
+			size_t end = mergeableRun(i);
+			if (end - i > 1 && drawIndirect(i, end)) {
+				stats.draws += end - i;
+				stats.drawCalls++;
+				i = end;
+				continue;
+			}
+		}
+
+		if (packet.indexType == 0) {
+			if (packet.instanceCount > 1)
+				glDrawArraysInstanced(packet.mode, (GLint)packet.first, packet.count, packet.instanceCount);
+			else
+				glDrawArrays(packet.mode, (GLint)packet.first, packet.count);
+		}
+		else {
+			if (packet.instanceCount > 1)
+				glDrawElementsInstanced(packet.mode, packet.count, packet.indexType, (void*)packet.first, packet.instanceCount);
+			else
+				glDrawElements(packet.mode, packet.count, packet.indexType, (void*)packet.first);
+		}
+		stats.draws++;
+		stats.drawCalls++;
+		i++;
+	}
+
+	if (indirectBuffer) {
+		indirectBuffer->endFrame();
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+	for (CommandBuffer& cb : buffers)
+		cb.clear();
+	lastStats = stats;
+}
+
+const RenderQueueStats& RenderQueue::stats() const {
+	return lastStats;
+}
+
+void RenderQueue::release() {
+	indirectBuffer.reset();
+}
+
+static size_t indexSize(GLenum indexType) {
+	switch (indexType) {
+	case GL_UNSIGNED_BYTE: return 1;
+	case GL_UNSIGNED_SHORT: return 2;
+	default: return 4;
+	}
+}
+
+size_t RenderQueue::mergeableRun(size_t begin) const {
+	const DrawPacket& head = buffers[items[begin].buffer].packets[items[begin].packet];
+	// indirect commands address indices by element, not by byte
+	size_t alignment = head.indexType == 0 ? 1 : indexSize(head.indexType);
+	if (head.first % alignment != 0)
+		return begin + 1;
+
+	// split runs too long for the indirect buffer rather than falling back
+	size_t limit = std::min(items.size(), begin + indirectBufferSize / (5 * sizeof(GLuint)));
+	size_t end = begin + 1;
+	for (; end < limit; end++) {
+		const DrawPacket& packet = buffers[items[end].buffer].packets[items[end].packet];
+		if (packet.uniformCount != 0 || packet.program != head.program || packet.vao != head.vao ||
+			packet.mode != head.mode || packet.indexType != head.indexType || packet.first % alignment != 0 ||
+			memcmp(packet.textures, head.textures, sizeof(head.textures)) != 0)
+			break;
+	}
+	return end;
+}
+
+bool RenderQueue::drawIndirect(size_t begin, size_t end) {
+	const DrawPacket& head = buffers[items[begin].buffer].packets[items[begin].packet];
+	indirectCommands.clear();
+	for (size_t i = begin; i < end; i++) {
+		const DrawPacket& packet = buffers[items[i].buffer].packets[items[i].packet];
+		// DrawElementsIndirectCommand {count, instanceCount, firstIndex, baseVertex, baseInstance}
+		// or DrawArraysIndirectCommand {count, instanceCount, first, baseInstance}
+		indirectCommands.push_back((GLuint)packet.count);
+		indirectCommands.push_back((GLuint)packet.instanceCount);
+		if (head.indexType == 0) {
+			indirectCommands.push_back((GLuint)packet.first);
+		}
+		else {
+			indirectCommands.push_back((GLuint)(packet.first / indexSize(head.indexType)));
+			indirectCommands.push_back(0);
+		}
+		indirectCommands.push_back(0);
+	}
+
+	if (!indirectBuffer)
+		indirectBuffer.reset(new StreamBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBufferSize));
+	size_t bytes = indirectCommands.size() * sizeof(GLuint);
+	if (bytes > indirectBufferSize)
+		return false;
+	size_t offset = indirectBuffer->push(indirectCommands.data(), bytes, sizeof(GLuint));
+	GLsizei drawCount = (GLsizei)(end - begin);
+	if (head.indexType == 0)
+		glMultiDrawArraysIndirect(head.mode, (void*)offset, drawCount, 0);
+	else
+		glMultiDrawElementsIndirect(head.mode, head.indexType, (void*)offset, drawCount, 0);
+	return true;
+}
+
+void RenderQueue::radixSort() {
+	// LSD radix sort on 8-bit digits; stable, so equal keys keep their recording order
+	size_t count = items.size();
+	if (count < 2)
+		return;
+	scratch.resize(count);
+
+	size_t histograms[8][256];
+	memset(histograms, 0, sizeof(histograms));
+	for (const SortItem& item : items) {
+		for (int pass = 0; pass < 8; pass++)
+			histograms[pass][(item.key >> (pass * 8)) & 0xFF]++;
+	}
+
+	for (int pass = 0; pass < 8; pass++) {
+		size_t* histogram = histograms[pass];
+		int shift = pass * 8;
+		// a digit shared by every key doesn't reorder anything
+		if (histogram[(items[0].key >> shift) & 0xFF] == count)
+			continue;
+
+		size_t offset = 0;
+		for (int digit = 0; digit < 256; digit++) {
+			size_t n = histogram[digit];
+			histogram[digit] = offset;
+			offset += n;
+		}
+		for (const SortItem& item : items)
+			scratch[histogram[(item.key >> shift) & 0xFF]++] = item;
+		items.swap(scratch);
+	}
+}
@@ -0,0 +1,138 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "VecMath.h"
+
+// 64-bit draw sort keys. Higher bits sort first:
+//   opaque:      [63..60 layer][59 = 0][58..47 program][46..35 material][34..11 depth, front to back]
+//   translucent: [63..60 layer][59 = 1][58..35 depth, back to front][34..23 program]
+// Opaque draws group by state to minimise changes; translucent draws keep blending order.
+// 'depth' is normalized view depth in [0, 1].
+uint64_t opaqueSortKey(unsigned int layer, unsigned int program, unsigned int material, float depth);
+uint64_t translucentSortKey(unsigned int layer, float depth, unsigned int program);
+
+static const int maxPacketTextures = 4;
+
+// One draw and the state it needs. Uniforms live in the recording CommandBuffer.
+struct DrawPacket
+{
+	uint64_t key;
+	GLuint program;
+	GLuint vao;
+	GLuint textures[maxPacketTextures];	// GL_TEXTURE_2D on units 0..n-1, 0 = unused
+	GLenum mode;
+	GLsizei count;
+	GLenum indexType;			// 0 for non-indexed draws
+	size_t first;				// first vertex, or byte offset into the index buffer
+	GLsizei instanceCount;
+	uint32_t firstUniform;
+	uint32_t uniformCount;
+};
+
+// Linear per-thread recording buffer. Only one thread may record into a buffer,
+// and recording must not call GL: uniform locations have to be looked up on the
+// GL thread beforehand (e.g. right after the program is linked).
+class CommandBuffer
+{
+public:
+	// Starts a new packet; returns it so the caller can fill in textures etc.
+	DrawPacket& draw(uint64_t key, GLuint program, GLuint vao, GLenum mode, GLsizei count,
+		GLenum indexType = GL_UNSIGNED_INT, size_t first = 0, GLsizei instanceCount = 1);
+
+	// Uniform values attached to the most recent packet
+	void setInt(GLint location, int value);
+	void setFloat(GLint location, float value);
+	void setVec4(GLint location, const vec4& value);
+	void setMat4(GLint location, const mat4& value);
+
+	void clear();
+	size_t packetCount() const;
+
+private:
+	friend class RenderQueue;
+
+	enum UniformType
+	{
+		UniformInt,
+		UniformFloat,
+		UniformVec4,
+		UniformMat4
+	};
+
+	struct UniformValue
+	{
+		GLint location;
+		UniformType type;
+		uint32_t offset;	// into 'data', in floats
+	};
+
+	std::vector<DrawPacket> packets;
+	std::vector<UniformValue> uniforms;
+	std::vector<float> data;
+
+	void addUniform(GLint location, UniformType type, const float* values, int count);
+};
+
+struct RenderQueueStats
+{
+	size_t draws;			// packets
+	size_t drawCalls;		// glDraw* and glMultiDraw*Indirect calls issued for them
+	size_t programChanges;
+	size_t vaoChanges;
+	size_t textureChanges;
+};
+
+class StreamBuffer;
+
+// Collects packets from several CommandBuffers (one per recording thread), radix
+// sorts them by key and executes them on the GL thread, skipping redundant binds.
+// With DrawPath::MultiDrawIndirect, consecutive packets that share all state and set no
+// uniforms of their own are issued as one glMultiDraw*Indirect call.
+class RenderQueue
+{
+public:
+	RenderQueue(int recordingThreads = 1);
+	// Needs the context still current if any indirect draws were issued, unless release()
+	// was called
+	~RenderQueue();
+
+	// Buffer owned by recording thread 'index'
+	CommandBuffer& buffer(int index);
+	int bufferCount() const;
+
+	// Sorts and issues every recorded packet, then clears the buffers. GL thread only.
+	void execute();
+
+	const RenderQueueStats& stats() const;
+	// Deletes the indirect command buffer, e.g. before the context goes away; the next
+	// merged draw creates it again
+	void release();
+
+private:
+	struct SortItem
+	{
+		uint64_t key;
+		uint32_t buffer;
+		uint32_t packet;
+	};
+
+	std::vector<CommandBuffer> buffers;
+	std::vector<SortItem> items;
+	std::vector<SortItem> scratch;
+	std::vector<GLuint> indirectCommands;
+	std::unique_ptr<StreamBuffer> indirectBuffer;	// created on first use
+	RenderQueueStats lastStats;
+
+	void radixSort();
+	// End of the run of packets from items[begin] that one indirect call can issue
+	size_t mergeableRun(size_t begin) const;
+	// Issues items[begin, end) as one call; false if the commands didn't fit the buffer
+	bool drawIndirect(size_t begin, size_t end);
+};
+
+#endif
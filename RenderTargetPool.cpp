@@ -0,0 +1,461 @@
+#include "RenderTargetPool.h"
+#include "GLCapabilities.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+struct TargetFormat
+{
+	GLenum internalFormat;
+	GLenum format, type;	// what glTexImage2D is given for the null upload
+	int pixelSize;
+};
+
+static const TargetFormat targetFormats[] = {
+	{ GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1 },
+	{ GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2 },
+	{ GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 3 },
+	{ GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4 },
+	{ GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE, 4 },
+	{ GL_RGB10_A2, GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, 4 },
+	{ GL_R11F_G11F_B10F, GL_RGB, GL_FLOAT, 4 },
+	{ GL_R16F, GL_RED, GL_HALF_FLOAT, 2 },
+	{ GL_RG16F, GL_RG, GL_HALF_FLOAT, 4 },
+	{ GL_RGB16F, GL_RGB, GL_HALF_FLOAT, 6 },
+	{ GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 8 },
+	{ GL_R32F, GL_RED, GL_FLOAT, 4 },
+	{ GL_RG32F, GL_RG, GL_FLOAT, 8 },
+	{ GL_RGBA32F, GL_RGBA, GL_FLOAT, 16 },
+	{ GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, 2 },
+	{ GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, 4 },
+	{ GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT, 4 },
+	{ GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, 4 },
+	{ GL_DEPTH32F_STENCIL8, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 8 },
+};
+
+static const TargetFormat* findFormat(GLenum internalFormat) {
+	for (const TargetFormat& format : targetFormats) {
+		if (format.internalFormat == internalFormat)
+			return &format;
+	}
+	return nullptr;
+}
+
+static bool isDepthFormat(GLenum format) {
+	const TargetFormat* info = findFormat(format);
+	return info && (info->format == GL_DEPTH_COMPONENT || info->format == GL_DEPTH_STENCIL);
+}
+
+static int resolveSize(float scale, int framebufferSize) {
+	return std::max(1, (int)std::lround(scale * framebufferSize));
+}
+
+int renderTargetPixelSize(GLenum format) {
+	const TargetFormat* info = findFormat(format);
+	return info ? info->pixelSize : 0;
+}
+
+RenderTargetDesc RenderTargetDesc::fixed(int width, int height, GLenum colorFormat, GLenum depthFormat) {
+	RenderTargetDesc desc;
+	desc.width = width;
+	desc.height = height;
+	desc.scale = 0.0f;
+	desc.colorFormat = colorFormat;
+	desc.depthFormat = depthFormat;
+	return desc;
+}
+
+RenderTargetDesc RenderTargetDesc::relative(float scale, GLenum colorFormat, GLenum depthFormat) {
+	RenderTargetDesc desc;
+	desc.width = desc.height = 0;
+	desc.scale = scale;
+	desc.colorFormat = colorFormat;
+	desc.depthFormat = depthFormat;
+	return desc;
+}
+
+RenderTarget::RenderTarget()
+	: framebuffer(0), colorTexture(0), depthTexture(0), width(0), height(0), colorSlot(-1), depthSlot(-1) {
+}
+
+bool RenderTarget::valid() const {
+	return framebuffer != 0;
+}
+
+void RenderTarget::bind() const {
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glViewport(0, 0, width, height);
+}
+
+RenderTargetPool::RenderTargetPool(int framesToKeep)
+	: framesToKeep(std::max(framesToKeep, 1)), width(1), height(1), frame(0), frameNaiveBytes(0),
+	totals(), resized(false) {
+}
+
+RenderTargetPool::~RenderTargetPool() {
+	clear();
+}
+
+void RenderTargetPool::setFramebufferSize(int newWidth, int newHeight) {
+	newWidth = std::max(newWidth, 1);
+	newHeight = std::max(newHeight, 1);
+	if (newWidth == width && newHeight == height)
+		return;
+	width = newWidth;
+	height = newHeight;
+	resized = true;
+}
+
+int RenderTargetPool::framebufferWidth() const {
+	return width;
+}
+
+int RenderTargetPool::framebufferHeight() const {
+	return height;
+}
+
+void RenderTargetPool::beginFrame() {
+	frameNaiveBytes = 0;
+	totals.acquires = 0;
+	if (!resized)
+		return;
+	// textures sized for the old framebuffer will not be asked for again; dropping them now
+	// rather than after 'framesToKeep' frames keeps a window drag from piling up every size
+	for (size_t i = 0; i < textures.size(); i++) {
+		PooledTexture& texture = textures[i];
+		if (texture.texture && texture.relative && !texture.inUse) {
+			deleteFramebuffersUsing(texture.texture);
+			glDeleteTextures(1, &texture.texture);
+			texture.texture = 0;
+			totals.texturesEvicted++;
+		}
+	}
+	resized = false;
+}
+
+RenderTarget RenderTargetPool::acquire(const RenderTargetDesc& desc) {
+	RenderTarget target;
+	bool relative = desc.scale > 0.0f;
+	target.width = relative ? resolveSize(desc.scale, width) : desc.width;
+	target.height = relative ? resolveSize(desc.scale, height) : desc.height;
+	if (target.width <= 0 || target.height <= 0 || (!desc.colorFormat && !desc.depthFormat)) {
+		std::cout << "ERROR::RENDER_TARGET_POOL::INVALID_DESCRIPTION " << target.width << "x" << target.height << std::endl;
+		return RenderTarget();
+	}
+	if ((desc.colorFormat && (!findFormat(desc.colorFormat) || isDepthFormat(desc.colorFormat))) ||
+		(desc.depthFormat && !isDepthFormat(desc.depthFormat))) {
+		std::cout << "ERROR::RENDER_TARGET_POOL::UNSUPPORTED_FORMAT 0x" << std::hex << desc.colorFormat << " 0x"
+			<< desc.depthFormat << std::dec << std::endl;
+		return RenderTarget();
+	}
+
+	if (desc.colorFormat) {
+		target.colorSlot = acquireTexture(target.width, target.height, desc.colorFormat, relative);
+		target.colorTexture = textures[target.colorSlot].texture;
+	}
+	if (desc.depthFormat) {
+		target.depthSlot = acquireTexture(target.width, target.height, desc.depthFormat, relative);
+		target.depthTexture = textures[target.depthSlot].texture;
+	}
+	target.framebuffer = framebufferFor(target.colorTexture, target.depthTexture, desc.depthFormat);
+	if (!target.framebuffer) {
+		release(target);
+		return RenderTarget();
+	}
+	totals.acquires++;
+	return target;
+}
+
+void RenderTargetPool::release(RenderTarget& target) {
+	releaseSlot(target.colorSlot);
+	releaseSlot(target.depthSlot);
+	target = RenderTarget();
+}
+
+void RenderTargetPool::endFrame() {
+	for (PooledTexture& texture : textures)
+		texture.inUse = false;
+	totals.naiveBytes = frameNaiveBytes;
+	totals.peakNaiveBytes = std::max(totals.peakNaiveBytes, frameNaiveBytes);
+
+	for (PooledTexture& texture : textures) {
+		if (texture.texture && frame - texture.lastUsed >= (uint64_t)framesToKeep) {
+			deleteFramebuffersUsing(texture.texture);
+			glDeleteTextures(1, &texture.texture);
+			texture.texture = 0;
+			totals.texturesEvicted++;
+		}
+	}
+	// attachment pairs that stopped occurring, e.g. a color texture now shared with another depth
+	for (size_t i = 0; i < framebuffers.size();) {
+		if (frame - framebuffers[i].lastUsed >= (uint64_t)framesToKeep) {
+			glDeleteFramebuffers(1, &framebuffers[i].framebuffer);
+			framebuffers[i] = framebuffers.back();
+			framebuffers.pop_back();
+		}
+		else {
+			i++;
+		}
+	}
+	frame++;
+}
+
+void RenderTargetPool::clear() {
+	for (CachedFramebuffer& cached : framebuffers)
+		glDeleteFramebuffers(1, &cached.framebuffer);
+	framebuffers.clear();
+	for (PooledTexture& texture : textures) {
+		if (texture.texture)
+			glDeleteTextures(1, &texture.texture);
+	}
+	textures.clear();
+}
+
+RenderTargetPoolStats RenderTargetPool::stats() const {
+	RenderTargetPoolStats result = totals;
+	result.textures = 0;
+	result.pooledBytes = 0;
+	for (const PooledTexture& texture : textures) {
+		if (texture.texture) {
+			result.textures++;
+			result.pooledBytes += texture.bytes;
+		}
+	}
+	result.framebuffers = framebuffers.size();
+	return result;
+}
+
+int RenderTargetPool::acquireTexture(int textureWidth, int textureHeight, GLenum format, bool relative) {
+	const TargetFormat* info = findFormat(format);
+	size_t bytes = (size_t)textureWidth * textureHeight * info->pixelSize;
+	frameNaiveBytes += bytes;
+
+	int freeSlot = -1;
+	for (size_t i = 0; i < textures.size(); i++) {
+		PooledTexture& texture = textures[i];
+		if (!texture.texture) {
+			if (freeSlot < 0)
+				freeSlot = (int)i;
+			continue;
+		}
+		if (!texture.inUse && texture.format == format && texture.width == textureWidth &&
+			texture.height == textureHeight) {
+			texture.inUse = true;
+			texture.lastUsed = frame;
+			texture.relative = texture.relative || relative;
+			return (int)i;
+		}
+	}
+
+	PooledTexture texture;
+	texture.width = textureWidth;
+	texture.height = textureHeight;
+	texture.format = format;
+	texture.bytes = bytes;
+	texture.inUse = true;
+	texture.relative = relative;
+	texture.lastUsed = frame;
+
+	// pooled textures are never resized in place, so immutable storage is fine
+	GLint filter = isDepthFormat(format) ? GL_NEAREST : GL_LINEAR;
+	texture.texture = allocateTexture2D(format, textureWidth, textureHeight, 1, info->format, info->type, filter,
+		GL_CLAMP_TO_EDGE);
+	totals.texturesCreated++;
+
+	int slot = freeSlot;
+	if (slot >= 0) {
+		textures[slot] = texture;
+	}
+	else {
+		slot = (int)textures.size();
+		textures.push_back(texture);
+	}
+	totals.peakPooledBytes = std::max(totals.peakPooledBytes, stats().pooledBytes);
+	return slot;
+}
+
+GLuint RenderTargetPool::framebufferFor(GLuint color, GLuint depth, GLenum depthFormat) {
+	for (CachedFramebuffer& cached : framebuffers) {
+		if (cached.color == color && cached.depth == depth) {
+			cached.lastUsed = frame;
+			return cached.framebuffer;
+		}
+	}
+
+	GLint previousDraw, previousRead;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousDraw);
+	glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousRead);
+
+	CachedFramebuffer cached;
+	cached.color = color;
+	cached.depth = depth;
+	cached.lastUsed = frame;
+	glGenFramebuffers(1, &cached.framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, cached.framebuffer);
+	if (color) {
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+	}
+	else {
+		glDrawBuffer(GL_NONE);
+		glReadBuffer(GL_NONE);
+	}
+	if (depth) {
+		const TargetFormat* info = findFormat(depthFormat);
+		GLenum attachment = info->format == GL_DEPTH_STENCIL ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+		glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, depth, 0);
+	}
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousDraw);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, previousRead);
+
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		std::cout << "ERROR::RENDER_TARGET_POOL::FRAMEBUFFER_INCOMPLETE 0x" << std::hex << status << std::dec << std::endl;
+		glDeleteFramebuffers(1, &cached.framebuffer);
+		return 0;
+	}
+	framebuffers.push_back(cached);
+	return cached.framebuffer;
+}
+
+void RenderTargetPool::releaseSlot(int slot) {
+	if (slot >= 0 && slot < (int)textures.size())
+		textures[slot].inUse = false;
+}
+
+void RenderTargetPool::deleteFramebuffersUsing(GLuint texture) {
+	for (size_t i = 0; i < framebuffers.size();) {
+		if (framebuffers[i].color == texture || framebuffers[i].depth == texture) {
+			glDeleteFramebuffers(1, &framebuffers[i].framebuffer);
+			framebuffers[i] = framebuffers.back();
+			framebuffers.pop_back();
+		}
+		else {
+			i++;
+		}
+	}
+}
+
+typedef std::chrono::steady_clock PoolClock;
+
+static void clearTarget(const RenderTarget& target, bool draw) {
+	if (!draw)
+		return;
+	target.bind();
+	glClear(GL_COLOR_BUFFER_BIT | (target.depthTexture ? GL_DEPTH_BUFFER_BIT : 0));
+}
+
+// A deferred-style frame: scene, half res SSAO with a separable blur, lighting, a three level
+// bloom, composite, depth of field, tonemap, FXAA and UI. Each pass releases its inputs once
+// done with them, as a real chain would; clearing stands in for drawing.
+static void renderPostChain(RenderTargetPool& pool, bool draw) {
+	RenderTarget scene = pool.acquire(RenderTargetDesc::relative(1.0f, GL_RGBA16F, GL_DEPTH24_STENCIL8));
+	clearTarget(scene, draw);
+
+	RenderTarget occlusion = pool.acquire(RenderTargetDesc::relative(0.5f, GL_R8));
+	clearTarget(occlusion, draw);
+	RenderTarget blurred = pool.acquire(RenderTargetDesc::relative(0.5f, GL_R8));
+	clearTarget(blurred, draw);
+	pool.release(occlusion);
+	occlusion = pool.acquire(RenderTargetDesc::relative(0.5f, GL_R8));
+	clearTarget(occlusion, draw);
+	pool.release(blurred);
+
+	RenderTarget lit = pool.acquire(RenderTargetDesc::relative(1.0f, GL_RGBA16F));
+	clearTarget(lit, draw);
+	pool.release(occlusion);
+	pool.release(scene);
+
+	RenderTarget bright = pool.acquire(RenderTargetDesc::relative(0.5f, GL_RGBA16F));
+	clearTarget(bright, draw);
+	RenderTarget levels[3];
+	float scale = 0.25f;
+	for (RenderTarget& level : levels) {
+		RenderTarget down = pool.acquire(RenderTargetDesc::relative(scale, GL_RGBA16F));
+		clearTarget(down, draw);
+		pool.release(bright);
+		RenderTarget horizontal = pool.acquire(RenderTargetDesc::relative(scale, GL_RGBA16F));
+		clearTarget(horizontal, draw);
+		pool.release(down);
+		level = pool.acquire(RenderTargetDesc::relative(scale, GL_RGBA16F));
+		clearTarget(level, draw);
+		pool.release(horizontal);
+		scale *= 0.5f;
+	}
+
+	RenderTarget composite = pool.acquire(RenderTargetDesc::relative(1.0f, GL_RGBA16F));
+	clearTarget(composite, draw);
+	pool.release(lit);
+	for (RenderTarget& level : levels)
+		pool.release(level);
+	RenderTarget focused = pool.acquire(RenderTargetDesc::relative(1.0f, GL_RGBA16F));
+	clearTarget(focused, draw);
+	pool.release(composite);
+
+	RenderTarget tonemapped = pool.acquire(RenderTargetDesc::relative(1.0f, GL_RGBA8));
+	clearTarget(tonemapped, draw);
+	pool.release(focused);
+	RenderTarget antialiased = pool.acquire(RenderTargetDesc::relative(1.0f, GL_RGBA8));
+	clearTarget(antialiased, draw);
+	pool.release(tonemapped);
+	RenderTarget ui = pool.acquire(RenderTargetDesc::relative(1.0f, GL_RGBA8));
+	clearTarget(ui, draw);
+	pool.release(antialiased);
+	pool.release(ui);
+}
+
+static double megabytes(size_t bytes) {
+	return bytes / (1024.0 * 1024.0);
+}
+
+void runRenderTargetPoolBenchmark() {
+	const int framesPerSize = 100;
+	RenderTargetPool pool;
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << "post chain, " << framesPerSize << " frames per size; pool us/frame excludes drawing\n";
+	std::cout << "size        targets  textures  naive MB  pooled MB  created  evicted  pool us/frame\n";
+
+	const int sizes[][2] = { { 1920, 1080 }, { 1280, 720 }, { 2560, 1440 } };
+	for (const int* size : sizes) {
+		pool.setFramebufferSize(size[0], size[1]);
+		for (int frame = 0; frame < framesPerSize; frame++) {
+			pool.beginFrame();
+			renderPostChain(pool, true);
+			pool.endFrame();
+		}
+		glFinish();
+		RenderTargetPoolStats stats = pool.stats();
+
+		PoolClock::time_point start = PoolClock::now();
+		for (int frame = 0; frame < framesPerSize; frame++) {
+			pool.beginFrame();
+			renderPostChain(pool, false);
+			pool.endFrame();
+		}
+		double poolUs = std::chrono::duration<double, std::micro>(PoolClock::now() - start).count() / framesPerSize;
+
+		std::cout << std::setw(4) << size[0] << "x" << std::left << std::setw(4) << size[1] << std::right
+			<< std::setw(11) << stats.acquires << std::setw(10) << stats.textures << std::setw(10)
+			<< megabytes(stats.naiveBytes) << std::setw(11) << megabytes(stats.pooledBytes) << std::setw(9)
+			<< stats.texturesCreated << std::setw(9) << stats.texturesEvicted << std::setw(15) << poolUs << "\n";
+	}
+
+	// a window drag: a new size every frame
+	for (int frame = 0; frame < 30; frame++) {
+		pool.setFramebufferSize(1280 + frame * 16, 720 + frame * 9);
+		pool.beginFrame();
+		renderPostChain(pool, true);
+		pool.endFrame();
+	}
+	RenderTargetPoolStats stats = pool.stats();
+	std::cout << "after 30 frames of resizing: " << stats.textures << " textures, " << megabytes(stats.pooledBytes)
+		<< " MB held; peak " << megabytes(stats.peakPooledBytes) << " MB pooled against "
+		<< megabytes(stats.peakNaiveBytes) << " MB naive\n";
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	pool.clear();
+}
@@ -0,0 +1,123 @@
+#ifndef RENDER_TARGET_POOL_H
+#define RENDER_TARGET_POOL_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// What a pass renders into: a color and/or depth attachment of a given size and format
+struct RenderTargetDesc
+{
+	int width, height;		// pixels, used when 'scale' is 0
+	float scale;			// fraction of the framebuffer size, resolved at acquire time
+	GLenum colorFormat;		// sized internal format (GL_RGBA8, GL_RGBA16F, ...), 0 for none
+	GLenum depthFormat;		// GL_DEPTH_COMPONENT24, GL_DEPTH24_STENCIL8, ..., 0 for none
+
+	static RenderTargetDesc fixed(int width, int height, GLenum colorFormat, GLenum depthFormat = 0);
+	static RenderTargetDesc relative(float scale, GLenum colorFormat, GLenum depthFormat = 0);
+};
+
+// An acquired target: both attachments are textures so later passes can sample them
+struct RenderTarget
+{
+	GLuint framebuffer;
+	GLuint colorTexture;	// 0 without a color attachment
+	GLuint depthTexture;	// 0 without a depth attachment
+	int width, height;
+	int colorSlot, depthSlot;	// pool bookkeeping, -1 for none
+
+	RenderTarget();
+	bool valid() const;
+	// Binds the framebuffer and sets the viewport to the whole target
+	void bind() const;
+};
+
+struct RenderTargetPoolStats
+{
+	size_t acquires;		// targets handed out during the last frame
+	size_t textures;		// textures the pool holds
+	size_t framebuffers;	// cached framebuffer objects
+	size_t pooledBytes;		// memory held by the pool's textures
+	size_t naiveBytes;		// memory the last frame's targets take with one texture each
+	size_t peakPooledBytes;
+	size_t peakNaiveBytes;
+	size_t texturesCreated;	// since construction, resizes included
+	size_t texturesEvicted;
+};
+
+// Hands out offscreen render targets for the duration of a frame.
+// Attachments are pooled per (size, format): a texture released earlier in the frame is
+// handed to the next pass that asks for the same kind, so targets whose lifetimes do not
+// overlap share memory (GL 3.3 has no way to alias textures of different formats). Every
+// target is released at endFrame(); textures nobody asked for in 'framesToKeep' frames are
+// deleted, which is also how targets sized relative to an old framebuffer size go away
+// after a resize. Framebuffer objects are cached per attachment pair.
+class RenderTargetPool
+{
+public:
+	RenderTargetPool(int framesToKeep = 2);
+	~RenderTargetPool();
+	RenderTargetPool(const RenderTargetPool&) = delete;
+	RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+	// Size relative targets resolve against; nothing is reallocated until they are acquired
+	void setFramebufferSize(int width, int height);
+	int framebufferWidth() const;
+	int framebufferHeight() const;
+
+	void beginFrame();
+	// Needs the context current. Returns an invalid target if the combination is not renderable.
+	RenderTarget acquire(const RenderTargetDesc& desc);
+	// Makes the target's attachments available to later acquires in this frame
+	void release(RenderTarget& target);
+	// Releases what is still held and evicts textures unused for 'framesToKeep' frames
+	void endFrame();
+
+	// Deletes every texture and framebuffer
+	void clear();
+
+	RenderTargetPoolStats stats() const;
+
+private:
+	struct PooledTexture
+	{
+		GLuint texture;
+		int width, height;
+		GLenum format;
+		size_t bytes;
+		bool inUse;
+		bool relative;		// sized from the framebuffer, stale after a resize
+		uint64_t lastUsed;	// frame number
+	};
+
+	struct CachedFramebuffer
+	{
+		GLuint framebuffer;
+		GLuint color, depth;
+		uint64_t lastUsed;
+	};
+
+	std::vector<PooledTexture> textures;	// texture 0 marks a free slot
+	std::vector<CachedFramebuffer> framebuffers;
+	int framesToKeep;
+	int width, height;
+	uint64_t frame;
+	size_t frameNaiveBytes;
+	RenderTargetPoolStats totals;
+	bool resized;
+
+	int acquireTexture(int width, int height, GLenum format, bool relative);
+	GLuint framebufferFor(GLuint color, GLuint depth, GLenum depthFormat);
+	void releaseSlot(int slot);
+	void deleteFramebuffersUsing(GLuint texture);
+};
+
+// Bytes per pixel of a sized internal format, 0 if unknown
+int renderTargetPixelSize(GLenum format);
+
+// Memory of a bloom-style post chain through the pool against one texture per target,
+// with a resize half way
+void runRenderTargetPoolBenchmark();
+
+#endif
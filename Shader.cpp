@@ -31,10 +31,17 @@ Shader::Shader(const char* vertexPath, const char* fragmentPath) {
 		std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ" << std::endl;
 	}
 
-	const char* vShaderCode = vertexCode.c_str();
-	const char* fShaderCode = fragmentCode.c_str();
-
 	// 2. compile shaders
+	compile(vertexCode.c_str(), fragmentCode.c_str());
+}
+
+Shader Shader::fromSource(const std::string& vertexCode, const std::string& fragmentCode) {
+	Shader shader;
+	shader.compile(vertexCode.c_str(), fragmentCode.c_str());
+	return shader;
+}
+
+void Shader::compile(const char* vShaderCode, const char* fShaderCode) {
 	unsigned int vertexShader, fragmentShader;
 	int success;
 	char infoLog[512];
@@ -92,3 +99,6 @@ void Shader::setInt(const std::string& name, int value) const {
 void Shader::setFloat(const std::string& name, float value) const {
 	glUniform1f(glGetUniformLocation(this->ID, name.c_str()), value);
 }
+void Shader::setMat4(const std::string& name, const mat4& value) const {
+	glUniformMatrix4fv(glGetUniformLocation(this->ID, name.c_str()), 1, GL_FALSE, value.data());
+}
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include "VecMath.h"
 
 class Shader
 {
@@ -17,6 +18,9 @@ public:
 	// and links them into a shader program
 	Shader(const char* vertexPath, const char* fragmentPath);
 
+	// Same as above, but takes GLSL source code instead of file paths
+	static Shader fromSource(const std::string& vertexCode, const std::string& fragmentCode);
+
 	// Execute this shader program as current program in rendering state
 	void use();
 
@@ -24,6 +28,13 @@ public:
 	void setBool(const std::string& name, bool value) const;
 	void setInt(const std::string& name, int value) const;
 	void setFloat(const std::string& name, float value) const;
+	void setMat4(const std::string& name, const mat4& value) const;
+
+private:
+	Shader() : ID(0) {}
+
+	// Compiles both stages and links them into this->ID
+	void compile(const char* vShaderCode, const char* fShaderCode);
 };
 
 #endif
\ No newline at end of file
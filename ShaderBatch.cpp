@@ -0,0 +1,275 @@
+#include "ShaderBatch.h"
+#include "Shader.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+typedef std::chrono::steady_clock BatchClock;
+
+// KHR_parallel_shader_compile or its ARB twin, loaded by glad when the context advertises it
+static bool parallelCompile() {
+	return (GLAD_GL_KHR_parallel_shader_compile && glad_glMaxShaderCompilerThreadsKHR) ||
+		(GLAD_GL_ARB_parallel_shader_compile && glad_glMaxShaderCompilerThreadsARB);
+}
+
+static std::string shaderLog(GLuint shader) {
+	GLint length = 0;
+	glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+	std::string log(length > 0 ? length : 1, '\0');
+	glGetShaderInfoLog(shader, (GLsizei)log.size(), NULL, &log[0]);
+	return log.c_str();
+}
+
+static std::string programLog(GLuint program) {
+	GLint length = 0;
+	glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+	std::string log(length > 0 ? length : 1, '\0');
+	glGetProgramInfoLog(program, (GLsizei)log.size(), NULL, &log[0]);
+	return log.c_str();
+}
+
+ShaderBatch::ShaderBatch() : firstUnsubmitted(0), firstUnfinished(0) {
+}
+
+ShaderBatch::~ShaderBatch() {
+	for (Entry& entry : entries) {
+		if (entry.vertexShader)
+			glDeleteShader(entry.vertexShader);
+		if (entry.fragmentShader)
+			glDeleteShader(entry.fragmentShader);
+		if (entry.program)
+			glDeleteProgram(entry.program);
+	}
+}
+
+size_t ShaderBatch::add(const std::string& vertexCode, const std::string& fragmentCode, const std::string& name) {
+	Entry entry;
+	entry.name = name;
+	entry.vertexCode = vertexCode;
+	entry.fragmentCode = fragmentCode;
+	entry.vertexShader = entry.fragmentShader = entry.program = 0;
+	entry.submitted = entry.done = entry.finished = entry.linked = false;
+	entries.push_back(entry);
+	return entries.size() - 1;
+}
+
+size_t ShaderBatch::size() const {
+	return entries.size();
+}
+
+void ShaderBatch::submit() {
+	// every compile first, so compiles of later programs aren't queued behind links
+	for (size_t i = firstUnsubmitted; i < entries.size(); i++) {
+		Entry& entry = entries[i];
+		const char* vertexCode = entry.vertexCode.c_str();
+		const char* fragmentCode = entry.fragmentCode.c_str();
+		entry.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+		glShaderSource(entry.vertexShader, 1, &vertexCode, NULL);
+		glCompileShader(entry.vertexShader);
+		entry.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+		glShaderSource(entry.fragmentShader, 1, &fragmentCode, NULL);
+		glCompileShader(entry.fragmentShader);
+	}
+	for (size_t i = firstUnsubmitted; i < entries.size(); i++) {
+		Entry& entry = entries[i];
+		entry.program = glCreateProgram();
+		glAttachShader(entry.program, entry.vertexShader);
+		glAttachShader(entry.program, entry.fragmentShader);
+		glLinkProgram(entry.program);
+		entry.submitted = true;
+		// the sources aren't needed any more
+		std::string().swap(entry.vertexCode);
+		std::string().swap(entry.fragmentCode);
+	}
+	firstUnsubmitted = entries.size();
+}
+
+bool ShaderBatch::ready() {
+	if (!parallelCompile())
+		return true;
+	bool allDone = true;
+	for (size_t i = firstUnfinished; i < entries.size(); i++) {
+		Entry& entry = entries[i];
+		if (!entry.submitted)
+			return false;
+		if (!entry.done) {
+			GLint status = GL_FALSE;
+			glGetProgramiv(entry.program, GL_COMPLETION_STATUS_KHR, &status);
+			entry.done = status == GL_TRUE;
+			allDone = allDone && entry.done;
+		}
+	}
+	return allDone;
+}
+
+void ShaderBatch::finish() {
+	submit();
+	for (size_t i = firstUnfinished; i < entries.size(); i++) {
+		Entry& entry = entries[i];
+		GLint success = GL_FALSE;
+		glGetProgramiv(entry.program, GL_LINK_STATUS, &success);
+		entry.linked = success == GL_TRUE;
+		if (!entry.linked) {
+			// the stages' logs say more than "linking with uncompiled shader"
+			std::cout << "ERROR::SHADER_BATCH::PROGRAM_FAILED " << (entry.name.empty() ? std::to_string(i) : entry.name) << "\n";
+			glGetShaderiv(entry.vertexShader, GL_COMPILE_STATUS, &success);
+			if (!success)
+				std::cout << "ERROR::VERTEX::SHADER::COMPILATION_FAILED\n" << shaderLog(entry.vertexShader) << "\n";
+			glGetShaderiv(entry.fragmentShader, GL_COMPILE_STATUS, &success);
+			if (!success)
+				std::cout << "ERROR::FRAGMENT::SHADER::COMPILATION_FAILED\n" << shaderLog(entry.fragmentShader) << "\n";
+			std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << programLog(entry.program) << std::endl;
+			glDeleteProgram(entry.program);
+			entry.program = 0;
+		}
+		else {
+			glDetachShader(entry.program, entry.vertexShader);
+			glDetachShader(entry.program, entry.fragmentShader);
+		}
+		glDeleteShader(entry.vertexShader);
+		glDeleteShader(entry.fragmentShader);
+		entry.vertexShader = entry.fragmentShader = 0;
+		entry.done = entry.finished = true;
+	}
+	firstUnfinished = entries.size();
+}
+
+GLuint ShaderBatch::program(size_t index) const {
+	return entries[index].finished ? entries[index].program : 0;
+}
+
+bool ShaderBatch::succeeded(size_t index) const {
+	return entries[index].finished && entries[index].linked;
+}
+
+size_t ShaderBatch::failed() const {
+	size_t count = 0;
+	for (const Entry& entry : entries) {
+		if (entry.finished && !entry.linked)
+			count++;
+	}
+	return count;
+}
+
+GLuint ShaderBatch::release(size_t index) {
+	GLuint program = this->program(index);
+	if (entries[index].finished)
+		entries[index].program = 0;
+	return program;
+}
+
+bool ShaderBatch::parallelCompileSupported() {
+	return parallelCompile();
+}
+
+void ShaderBatch::setMaxCompilerThreads(GLuint count) {
+	if (GLAD_GL_KHR_parallel_shader_compile && glad_glMaxShaderCompilerThreadsKHR)
+		glMaxShaderCompilerThreadsKHR(count);
+	else if (GLAD_GL_ARB_parallel_shader_compile && glad_glMaxShaderCompilerThreadsARB)
+		glMaxShaderCompilerThreadsARB(count);
+}
+
+// ---------------- benchmark ----------------
+
+static const int batchBenchmarkPrograms = 64;
+
+static std::string batchBenchmarkVertex(int salt) {
+	return "#version 330 core\n"
+		"#define VARIANT " + std::to_string(salt) + "\n"
+		"layout (location = 0) in vec3 aPos;\n"
+		"layout (location = 1) in vec2 aTexCoord;\n"
+		"uniform mat4 viewProjection;\n"
+		"out vec2 texCoord;\n"
+		"void main() {\n"
+		"	texCoord = aTexCoord * float(VARIANT % 7 + 1);\n"
+		"	gl_Position = viewProjection * vec4(aPos, 1.0);\n"
+		"}\n";
+}
+
+// a different chain of terms per program, long enough to cost something to optimise
+static std::string batchBenchmarkFragment(int salt, int index) {
+	std::string code = "#version 330 core\n"
+		"#define VARIANT " + std::to_string(salt) + "\n"
+		"in vec2 texCoord;\n"
+		"uniform sampler2D source;\n"
+		"uniform float time;\n"
+		"out vec4 FragColor;\n"
+		"void main() {\n"
+		"	vec3 color = vec3(0.0);\n"
+		"	vec2 p = texCoord;\n";
+	for (int term = 0; term < 24; term++) {
+		int k = (salt + index * 31 + term * 7) % 13 + 1;
+		code += "	p = vec2(p.y, fract(p.x * " + std::to_string(k) + ".0 + time));\n";
+		code += "	color += texture(source, p).rgb * " + std::to_string(1.0f / (term + k)) + " + sin(p.xyx * " +
+			std::to_string(k) + ".0) * 0.01;\n";
+	}
+	code += "	FragColor = vec4(color, 1.0);\n}\n";
+	return code;
+}
+
+void runShaderBatchBenchmark() {
+	// a value unique to each run, so the driver's own shader cache can't answer instead
+	int salt = (int)(BatchClock::now().time_since_epoch().count() & 0x3FFFFFF);
+	bool parallel = ShaderBatch::parallelCompileSupported();
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << batchBenchmarkPrograms << " programs, parallel shader compile "
+		<< (parallel ? "supported" : "not supported") << "\n";
+
+	// one by one: every step's status is read before the next is issued
+	{
+		std::vector<unsigned int> programs;
+		BatchClock::time_point start = BatchClock::now();
+		for (int i = 0; i < batchBenchmarkPrograms; i++)
+			programs.push_back(Shader::fromSource(batchBenchmarkVertex(salt), batchBenchmarkFragment(salt, i)).ID);
+		double totalMs = std::chrono::duration<double, std::milli>(BatchClock::now() - start).count();
+		std::cout << "Shader, one at a time       " << std::setw(9) << totalMs << " ms\n";
+		for (unsigned int program : programs)
+			glDeleteProgram(program);
+	}
+
+	struct Run
+	{
+		const char* name;
+		GLuint threads;
+		bool poll;
+	};
+	const Run runs[] = {
+		{ "batch, no compiler threads  ", 0, false },
+		{ "batch, driver's threads     ", 0xFFFFFFFFu, false },
+		{ "batch, polled               ", 0xFFFFFFFFu, true },
+	};
+	for (int r = 0; r < 3; r++) {
+		const Run& run = runs[r];
+		if (run.threads != 0 && !parallel)
+			continue;
+		ShaderBatch::setMaxCompilerThreads(run.threads);
+		int runSalt = salt + 1000 * (r + 1);
+		ShaderBatch batch;
+		for (int i = 0; i < batchBenchmarkPrograms; i++)
+			batch.add(batchBenchmarkVertex(runSalt), batchBenchmarkFragment(runSalt, i), "program " + std::to_string(i));
+
+		BatchClock::time_point start = BatchClock::now();
+		batch.submit();
+		double submitMs = std::chrono::duration<double, std::milli>(BatchClock::now() - start).count();
+		size_t polls = 0;
+		if (run.poll) {
+			// stands in for loading meshes and textures while the compiler threads work
+			while (!batch.ready()) {
+				polls++;
+				std::this_thread::sleep_for(std::chrono::microseconds(500));
+			}
+		}
+		double readyMs = std::chrono::duration<double, std::milli>(BatchClock::now() - start).count();
+		batch.finish();
+		double totalMs = std::chrono::duration<double, std::milli>(BatchClock::now() - start).count();
+		std::cout << run.name << std::setw(9) << totalMs << " ms (submit " << submitMs << " ms";
+		if (run.poll)
+			std::cout << ", ready after " << readyMs << " ms and " << polls << " polls, GL thread free "
+				<< (readyMs - submitMs) / totalMs * 100.0 << "%";
+		std::cout << ", " << batch.failed() << " failed)\n";
+	}
+	ShaderBatch::setMaxCompilerThreads(0xFFFFFFFFu);	// the KHR default
+}
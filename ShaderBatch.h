@@ -0,0 +1,74 @@
+#ifndef SHADER_BATCH_H
+#define SHADER_BATCH_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Compiles many programs at once without stalling on each.
+// Shader's constructor queries GL_COMPILE_STATUS right after every glCompileShader and
+// GL_LINK_STATUS right after glLinkProgram, so the driver has to finish each step before
+// the next one is issued. A batch issues every compile and link first and only then asks
+// for the results, which lets a driver with a compiler thread pool work on all of them
+// together. With KHR_parallel_shader_compile (or the ARB version) the batch can also be
+// polled through GL_COMPLETION_STATUS_KHR, which never blocks, so the GL thread can do other
+// startup work until ready() returns true.
+class ShaderBatch
+{
+public:
+	ShaderBatch();
+	// Deletes the programs not taken with release(); needs the context still current
+	~ShaderBatch();
+	ShaderBatch(const ShaderBatch&) = delete;
+	ShaderBatch& operator=(const ShaderBatch&) = delete;
+
+	// Queues a program; 'name' labels its errors. Returns its index.
+	size_t add(const std::string& vertexCode, const std::string& fragmentCode, const std::string& name = "");
+	size_t size() const;
+
+	// Issues every glCompileShader and glLinkProgram queued since the last submit()
+	void submit();
+	// Whether every submitted program finished compiling and linking. Always true without
+	// the extension: there is no way to ask without waiting.
+	bool ready();
+	// Submits if needed, then reads each status (blocking on any still compiling), prints
+	// the errors and deletes the shader objects
+	void finish();
+
+	// The linked program, 0 if it failed; valid after finish()
+	GLuint program(size_t index) const;
+	bool succeeded(size_t index) const;
+	size_t failed() const;
+	// Hands the program over to the caller, who deletes it
+	GLuint release(size_t index);
+
+	// KHR_parallel_shader_compile or ARB_parallel_shader_compile on the current context
+	static bool parallelCompileSupported();
+	// Caps the driver's compiler threads; 0xFFFFFFFF lets it choose, 0 compiles on the GL
+	// thread. Does nothing without the extension.
+	static void setMaxCompilerThreads(GLuint count);
+
+private:
+	struct Entry
+	{
+		std::string name;
+		std::string vertexCode, fragmentCode;
+		GLuint vertexShader, fragmentShader;
+		GLuint program;
+		bool submitted;
+		bool done;		// GL_COMPLETION_STATUS_KHR came back true
+		bool finished;	// status read
+		bool linked;
+	};
+
+	std::vector<Entry> entries;
+	size_t firstUnsubmitted;
+	size_t firstUnfinished;
+};
+
+// Startup cost of 64 programs built one by one through Shader against one batch, with and
+// without polling for completion
+void runShaderBatchBenchmark();
+
+#endif
@@ -0,0 +1,596 @@
+#include "ShaderLibrary.h"
+#include "JobSystem.h"
+#include "ShaderBatch.h"
+#include "Shader.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+typedef std::chrono::steady_clock ShaderClock;
+
+// nested includes beyond this are taken to be a cycle
+static const int maxIncludeDepth = 32;
+
+// FNV-1a
+static uint64_t hashBytes(const std::string& text, uint64_t hash = 14695981039346656037ull) {
+	for (unsigned char c : text) {
+		hash ^= c;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+static uint64_t combineHashes(uint64_t a, uint64_t b) {
+	return a ^ (b + 0x9E3779B97F4A7C15ull + (a << 6) + (a >> 2));
+}
+
+static std::string trimLeft(const std::string& line) {
+	size_t first = line.find_first_not_of(" \t");
+	return first == std::string::npos ? std::string() : line.substr(first);
+}
+
+// "#  include" is as valid as "#include"
+static bool isDirective(const std::string& trimmed, const char* name, std::string& rest) {
+	if (trimmed.empty() || trimmed[0] != '#')
+		return false;
+	std::string directive = trimLeft(trimmed.substr(1));
+	size_t length = std::char_traits<char>::length(name);
+	if (directive.compare(0, length, name) != 0 ||
+		(directive.size() > length && directive[length] != ' ' && directive[length] != '\t' && directive[length] != '"'))
+		return false;
+	rest = trimLeft(directive.substr(length));
+	return true;
+}
+
+ShaderDefines& ShaderDefines::set(const std::string& name, const std::string& value) {
+	auto at = std::lower_bound(entries.begin(), entries.end(), name,
+		[](const std::pair<std::string, std::string>& entry, const std::string& key) { return entry.first < key; });
+	if (at != entries.end() && at->first == name)
+		at->second = value;
+	else
+		entries.insert(at, std::make_pair(name, value));
+	return *this;
+}
+
+ShaderDefines& ShaderDefines::set(const std::string& name, int value) {
+	return set(name, std::to_string(value));
+}
+
+bool ShaderDefines::empty() const {
+	return entries.empty();
+}
+
+std::string ShaderDefines::text() const {
+	std::string text;
+	for (const auto& entry : entries)
+		text += "#define " + entry.first + " " + entry.second + "\n";
+	return text;
+}
+
+std::string ShaderDefines::describe() const {
+	std::string text;
+	for (const auto& entry : entries) {
+		if (!text.empty())
+			text += " ";
+		text += entry.first + "=" + entry.second;
+	}
+	return text;
+}
+
+uint64_t ShaderDefines::hash() const {
+	uint64_t hash = hashBytes("");
+	for (const auto& entry : entries) {
+		hash = hashBytes(entry.first, hash);
+		hash = hashBytes("=", hash);
+		hash = hashBytes(entry.second, hash);
+		hash = hashBytes("\n", hash);
+	}
+	return hash;
+}
+
+bool ShaderDefines::operator==(const ShaderDefines& other) const {
+	return entries == other.entries;
+}
+
+ShaderLibrary::ShaderLibrary() : hits(0), misses(0), preprocessSeconds(0.0), compileSeconds(0.0) {
+}
+
+ShaderLibrary::~ShaderLibrary() {
+	clear();
+}
+
+void ShaderLibrary::addIncludeDirectory(const std::string& directory) {
+	includeDirectories.push_back(directory);
+}
+
+void ShaderLibrary::addSource(const std::string& name, const std::string& code) {
+	memoryFiles[name] = code;
+}
+
+GLuint ShaderLibrary::program(const std::string& vertexPath, const std::string& fragmentPath, const ShaderDefines& defines) {
+	ShaderVariantDesc desc;
+	desc.vertexPath = vertexPath;
+	desc.fragmentPath = fragmentPath;
+	desc.defines = defines;
+	size_t before = variantList.size();
+	size_t index = findOrBuild(desc);
+	if (variantList.size() > before)
+		misses++;
+	else
+		hits++;
+	variantList[index].info.uses++;
+	return variantList[index].info.program;
+}
+
+void ShaderLibrary::precompile(const std::vector<ShaderVariantDesc>& variants, JobSystem* jobs) {
+	if (jobs) {
+		// read and preprocess every file not loaded yet on the job threads
+		std::vector<std::string> paths;
+		{
+			std::lock_guard<std::mutex> lock(sourceMutex);
+			for (const ShaderVariantDesc& desc : variants) {
+				for (const std::string* path : { &desc.vertexPath, &desc.fragmentPath }) {
+					if (!sources.count(*path) && std::find(paths.begin(), paths.end(), *path) == paths.end())
+						paths.push_back(*path);
+				}
+			}
+		}
+		ShaderClock::time_point start = ShaderClock::now();
+		std::vector<ShaderSource> loaded(paths.size());
+		jobs->parallelFor(paths.size(), 1, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; i++)
+				loaded[i] = load(paths[i]);
+		});
+		std::lock_guard<std::mutex> lock(sourceMutex);
+		for (size_t i = 0; i < paths.size(); i++)
+			sources[paths[i]] = loaded[i];
+		preprocessSeconds += std::chrono::duration<double>(ShaderClock::now() - start).count();
+	}
+
+	// every compile and link issued before any status is read, see ShaderBatch
+	ShaderBatch batch;
+	std::vector<size_t> batched;
+	for (const ShaderVariantDesc& desc : variants) {
+		bool added = false;
+		size_t index = findOrAdd(desc, true, added);
+		const ShaderSource& vertex = source(desc.vertexPath);
+		const ShaderSource& fragment = source(desc.fragmentPath);
+		if (!added || !vertex.ok || !fragment.ok)
+			continue;
+		std::string defines = desc.defines.text();
+		batch.add(vertex.version + defines + vertex.body, fragment.version + defines + fragment.body,
+			desc.vertexPath + " + " + desc.fragmentPath + " [" + variantList[index].info.defines + "]");
+		batched.push_back(index);
+	}
+	ShaderClock::time_point start = ShaderClock::now();
+	batch.finish();
+	double seconds = std::chrono::duration<double>(ShaderClock::now() - start).count();
+	compileSeconds += seconds;
+	for (size_t i = 0; i < batched.size(); i++) {
+		Variant& variant = variantList[batched[i]];
+		variant.info.compileMs = 1000.0 * seconds / batched.size();
+		variant.info.program = batch.release(i);
+		if (!variant.info.program)
+			reportFailure(variant);
+	}
+}
+
+std::vector<ShaderDefines> ShaderLibrary::permutations(const std::vector<std::string>& features, const ShaderDefines& base) {
+	std::vector<ShaderDefines> result;
+	size_t count = (size_t)1 << features.size();
+	result.reserve(count);
+	for (size_t mask = 0; mask < count; mask++) {
+		ShaderDefines defines = base;
+		for (size_t i = 0; i < features.size(); i++) {
+			if (mask & ((size_t)1 << i))
+				defines.set(features[i]);
+		}
+		result.push_back(defines);
+	}
+	return result;
+}
+
+bool ShaderLibrary::preprocess(const std::string& path, const ShaderDefines& defines, std::string& output) {
+	const ShaderSource& loaded = source(path);
+	output = loaded.version + defines.text() + loaded.body;
+	return loaded.ok;
+}
+
+void ShaderLibrary::clear() {
+	for (Variant& variant : variantList) {
+		if (variant.info.program)
+			glDeleteProgram(variant.info.program);
+	}
+	variantList.clear();
+	variantsByKey.clear();
+	std::lock_guard<std::mutex> lock(sourceMutex);
+	sources.clear();
+}
+
+ShaderLibraryStats ShaderLibrary::stats() const {
+	ShaderLibraryStats stats;
+	stats.variants = variantList.size();
+	stats.failed = 0;
+	stats.unusedPrecompiled = 0;
+	for (const Variant& variant : variantList) {
+		if (!variant.info.program)
+			stats.failed++;
+		if (variant.info.precompiled && variant.info.uses == 0)
+			stats.unusedPrecompiled++;
+	}
+	stats.hits = hits;
+	stats.misses = misses;
+	stats.preprocessMs = 1000.0 * preprocessSeconds;
+	stats.compileMs = 1000.0 * compileSeconds;
+	return stats;
+}
+
+std::vector<ShaderVariantInfo> ShaderLibrary::variants() const {
+	std::vector<ShaderVariantInfo> result;
+	for (const Variant& variant : variantList)
+		result.push_back(variant.info);
+	return result;
+}
+
+const ShaderLibrary::ShaderSource& ShaderLibrary::source(const std::string& path) {
+	{
+		std::lock_guard<std::mutex> lock(sourceMutex);
+		auto found = sources.find(path);
+		if (found != sources.end())
+			return found->second;
+	}
+	ShaderClock::time_point start = ShaderClock::now();
+	ShaderSource loaded = load(path);
+	preprocessSeconds += std::chrono::duration<double>(ShaderClock::now() - start).count();
+	std::lock_guard<std::mutex> lock(sourceMutex);
+	return sources[path] = loaded;
+}
+
+ShaderLibrary::ShaderSource ShaderLibrary::load(const std::string& path) const {
+	ShaderSource loaded;
+	std::vector<std::string> once;
+	loaded.ok = expand(path, 0, loaded.files, once, loaded.version, loaded.body);
+	loaded.hash = hashBytes(loaded.body, hashBytes(loaded.version));
+	return loaded;
+}
+
+bool ShaderLibrary::readFile(const std::string& path, std::string& text) const {
+	auto memory = memoryFiles.find(path);
+	if (memory != memoryFiles.end()) {
+		text = memory->second;
+		return true;
+	}
+	std::ifstream file(path);
+	if (!file)
+		return false;
+	std::stringstream stream;
+	stream << file.rdbuf();
+	text = stream.str();
+	return true;
+}
+
+bool ShaderLibrary::expand(const std::string& path, int depth, std::vector<std::string>& files,
+	std::vector<std::string>& once, std::string& version, std::string& output) const {
+	if (depth > maxIncludeDepth) {
+		std::cout << "ERROR::SHADER_LIBRARY::INCLUDE_TOO_DEEP " << path << std::endl;
+		return false;
+	}
+	std::string text;
+	if (!readFile(path, text)) {
+		std::cout << "ERROR::SHADER_LIBRARY::FILE_NOT_SUCCESSFULLY_READ " << path << std::endl;
+		return false;
+	}
+
+	std::istringstream lines(text);
+	std::string line, rest;
+	std::vector<std::string> fileLines;
+	while (std::getline(lines, line)) {
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		fileLines.push_back(line);
+		if (isDirective(trimLeft(line), "pragma", rest) && rest.compare(0, 4, "once") == 0) {
+			if (std::find(once.begin(), once.end(), path) != once.end())
+				return true;
+			once.push_back(path);
+		}
+	}
+
+	int fileIndex = (int)files.size();
+	files.push_back(path);
+	bool ok = true;
+	bool seenCode = false;
+	output += "#line 1 " + std::to_string(fileIndex) + "\n";
+	for (size_t i = 0; i < fileLines.size(); i++) {
+		const std::string& current = fileLines[i];
+		std::string trimmed = trimLeft(current);
+		int nextLine = (int)i + 2;
+		if (isDirective(trimmed, "version", rest)) {
+			// defines go in after it, so it must come first and only once
+			if (depth > 0 || seenCode) {
+				std::cout << "ERROR::SHADER_LIBRARY::MISPLACED_VERSION " << path << "(" << i + 1 << ")" << std::endl;
+				ok = false;
+			}
+			else {
+				version = current + "\n";
+				output = "#line " + std::to_string(nextLine) + " " + std::to_string(fileIndex) + "\n";
+			}
+			continue;
+		}
+		if (!trimmed.empty() && trimmed.compare(0, 2, "//") != 0)
+			seenCode = true;
+		if (isDirective(trimmed, "include", rest)) {
+			size_t open = rest.find('"');
+			size_t close = open == std::string::npos ? open : rest.find('"', open + 1);
+			if (close == std::string::npos) {
+				std::cout << "ERROR::SHADER_LIBRARY::BAD_INCLUDE " << path << "(" << i + 1 << "): " << current << std::endl;
+				ok = false;
+				continue;
+			}
+			std::string included = resolveInclude(path, rest.substr(open + 1, close - open - 1));
+			ok = expand(included, depth + 1, files, once, version, output) && ok;
+			output += "#line " + std::to_string(nextLine) + " " + std::to_string(fileIndex) + "\n";
+			continue;
+		}
+		if (isDirective(trimmed, "pragma", rest) && rest.compare(0, 4, "once") == 0) {
+			output += "\n";
+			continue;
+		}
+		output += current + "\n";
+	}
+	return ok;
+}
+
+std::string ShaderLibrary::resolveInclude(const std::string& from, const std::string& name) const {
+	size_t slash = from.find_last_of("/\\");
+	std::string beside = slash == std::string::npos ? name : from.substr(0, slash + 1) + name;
+	if (memoryFiles.count(beside) || std::ifstream(beside))
+		return beside;
+	for (const std::string& directory : includeDirectories) {
+		std::string candidate = directory.empty() ? name : directory + "/" + name;
+		if (memoryFiles.count(candidate) || std::ifstream(candidate))
+			return candidate;
+	}
+	return beside;	// fails to read, with the path in the message
+}
+
+size_t ShaderLibrary::findOrAdd(const ShaderVariantDesc& desc, bool precompiling, bool& added) {
+	const ShaderSource& vertex = source(desc.vertexPath);
+	const ShaderSource& fragment = source(desc.fragmentPath);
+	uint64_t key = combineHashes(combineHashes(vertex.hash, fragment.hash), desc.defines.hash());
+	std::vector<size_t>& candidates = variantsByKey[key];
+	added = false;
+	for (size_t index : candidates) {
+		const Variant& variant = variantList[index];
+		if (variant.vertexHash == vertex.hash && variant.fragmentHash == fragment.hash && variant.defines == desc.defines)
+			return index;
+	}
+
+	Variant variant;
+	variant.info.vertexPath = desc.vertexPath;
+	variant.info.fragmentPath = desc.fragmentPath;
+	variant.info.defines = desc.defines.describe();
+	variant.info.program = 0;
+	variant.info.compileMs = 0.0;
+	variant.info.uses = 0;
+	variant.info.precompiled = precompiling;
+	variant.defines = desc.defines;
+	variant.vertexHash = vertex.hash;
+	variant.fragmentHash = fragment.hash;
+	candidates.push_back(variantList.size());
+	variantList.push_back(variant);
+	added = true;
+	return variantList.size() - 1;
+}
+
+size_t ShaderLibrary::findOrBuild(const ShaderVariantDesc& desc) {
+	bool added = false;
+	size_t index = findOrAdd(desc, false, added);
+	const ShaderSource& vertex = source(desc.vertexPath);
+	const ShaderSource& fragment = source(desc.fragmentPath);
+	if (!added || !vertex.ok || !fragment.ok)
+		return index;
+
+	Variant& variant = variantList[index];
+	std::string defines = desc.defines.text();
+	ShaderClock::time_point start = ShaderClock::now();
+	Shader shader = Shader::fromSource(vertex.version + defines + vertex.body, fragment.version + defines + fragment.body);
+	GLint linked = 0;
+	glGetProgramiv(shader.ID, GL_LINK_STATUS, &linked);
+	double seconds = std::chrono::duration<double>(ShaderClock::now() - start).count();
+	variant.info.compileMs = 1000.0 * seconds;
+	compileSeconds += seconds;
+	if (linked) {
+		variant.info.program = shader.ID;
+	}
+	else {
+		glDeleteProgram(shader.ID);
+		reportFailure(variant);
+	}
+	return index;
+}
+
+void ShaderLibrary::reportFailure(const Variant& variant) {
+	const ShaderSource& vertex = source(variant.info.vertexPath);
+	const ShaderSource& fragment = source(variant.info.fragmentPath);
+	std::cout << "ERROR::SHADER_LIBRARY::VARIANT_FAILED " << variant.info.vertexPath << " + " << variant.info.fragmentPath
+		<< " [" << variant.info.defines << "]\n";
+	for (size_t i = 0; i < vertex.files.size(); i++)
+		std::cout << "  vertex source " << i << ": " << vertex.files[i] << "\n";
+	for (size_t i = 0; i < fragment.files.size(); i++)
+		std::cout << "  fragment source " << i << ": " << fragment.files[i] << "\n";
+	std::cout << std::flush;
+}
+
+// ---------------- benchmark ----------------
+
+static const char* libraryBenchmarkCommon = R"(#pragma once
+// shared by both stages
+const float PI = 3.14159265;
+
+vec3 decodeNormal(vec2 encoded) {
+	vec2 f = encoded * 2.0 - 1.0;
+	vec3 n = vec3(f, 1.0 - abs(f.x) - abs(f.y));
+	float t = clamp(-n.z, 0.0, 1.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+	return normalize(n);
+}
+)";
+
+static const char* libraryBenchmarkLighting = R"(#pragma once
+#include "common.glsl"
+
+vec3 shade(vec3 albedo, vec3 normal, vec3 toLight, vec3 toEye, float shadow) {
+	float diffuse = max(dot(normal, toLight), 0.0);
+	vec3 halfway = normalize(toLight + toEye);
+	float specular = pow(max(dot(normal, halfway), 0.0), 32.0) * (32.0 + 8.0) / (8.0 * PI);
+	return albedo * (0.1 + diffuse * shadow) + vec3(specular * shadow);
+}
+)";
+
+static const char* libraryBenchmarkVertex = R"(#version 330 core
+#include "common.glsl"
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+#ifdef SKINNING
+layout (location = 3) in vec4 aWeights;
+layout (location = 4) in ivec4 aBones;
+uniform mat4 bones[64];
+#endif
+uniform mat4 viewProjection;
+out vec3 normal;
+out vec2 texCoord;
+out vec3 worldPosition;
+void main() {
+	vec4 position = vec4(aPos, 1.0);
+	vec3 n = decodeNormal(aNormal);
+#ifdef SKINNING
+	mat4 skin = bones[aBones.x] * aWeights.x + bones[aBones.y] * aWeights.y + bones[aBones.z] * aWeights.z + bones[aBones.w] * aWeights.w;
+	position = skin * position;
+	n = mat3(skin) * n;
+#endif
+	worldPosition = position.xyz;
+	normal = n;
+	texCoord = aTexCoord;
+	gl_Position = viewProjection * position;
+})";
+
+static const char* libraryBenchmarkFragment = R"(#version 330 core
+#include "lighting.glsl"
+#include "common.glsl"
+in vec3 normal;
+in vec2 texCoord;
+in vec3 worldPosition;
+uniform sampler2D albedoMap;
+#ifdef NORMAL_MAP
+uniform sampler2D normalMap;
+#endif
+#ifdef SHADOWS
+uniform sampler2DShadow shadowMap;
+uniform mat4 shadowMatrix;
+#endif
+uniform vec3 lightDirection;
+uniform vec3 eyePosition;
+out vec4 FragColor;
+void main() {
+	vec4 albedo = texture(albedoMap, texCoord);
+#ifdef ALPHA_TEST
+	if (albedo.a < 0.5)
+		discard;
+#endif
+	vec3 n = normalize(normal);
+#ifdef NORMAL_MAP
+	n = normalize(n + (texture(normalMap, texCoord).xyz * 2.0 - 1.0));
+#endif
+	float shadow = 1.0;
+#ifdef SHADOWS
+	vec4 shadowPosition = shadowMatrix * vec4(worldPosition, 1.0);
+	shadow = textureProj(shadowMap, shadowPosition) * 0.2;
+	shadow += textureProjOffset(shadowMap, shadowPosition, ivec2(-1, 0)) * 0.2;
+	shadow += textureProjOffset(shadowMap, shadowPosition, ivec2(1, 0)) * 0.2;
+	shadow += textureProjOffset(shadowMap, shadowPosition, ivec2(0, -1)) * 0.2;
+	shadow += textureProjOffset(shadowMap, shadowPosition, ivec2(0, 1)) * 0.2;
+#endif
+	vec3 color = shade(albedo.rgb, n, -lightDirection, normalize(eyePosition - worldPosition), shadow);
+#ifdef FOG
+	color = mix(color, vec3(0.6, 0.7, 0.8), 1.0 - exp(-length(eyePosition - worldPosition) * 0.02));
+#endif
+	FragColor = vec4(color, albedo.a);
+})";
+
+void runShaderLibraryBenchmark() {
+	const std::vector<std::string> features = { "NORMAL_MAP", "SHADOWS", "FOG", "SKINNING", "ALPHA_TEST" };
+	const int lookups = 100000;
+
+	auto addSources = [](ShaderLibrary& library) {
+		library.addSource("common.glsl", libraryBenchmarkCommon);
+		library.addSource("lighting.glsl", libraryBenchmarkLighting);
+		library.addSource("mesh.vert", libraryBenchmarkVertex);
+		library.addSource("mesh.frag", libraryBenchmarkFragment);
+	};
+	// a define unique to each run, so the driver's own shader cache can't answer instead
+	int salt = (int)(ShaderClock::now().time_since_epoch().count() & 0x3FFFFFFF);
+	auto salted = [&](int run) {
+		return ShaderLibrary::permutations(features, ShaderDefines().set("BENCHMARK_RUN", salt + run));
+	};
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << features.size() << " features, " << ((size_t)1 << features.size()) << " permutations\n";
+
+	// lazily: each variant compiles when a draw first asks for it
+	{
+		ShaderLibrary library;
+		addSources(library);
+		std::vector<ShaderDefines> permutations = salted(0);
+		ShaderClock::time_point start = ShaderClock::now();
+		double worstMs = 0.0;
+		for (const ShaderDefines& defines : permutations) {
+			ShaderClock::time_point first = ShaderClock::now();
+			library.program("mesh.vert", "mesh.frag", defines);
+			worstMs = std::max(worstMs, std::chrono::duration<double, std::milli>(ShaderClock::now() - first).count());
+		}
+		double totalMs = std::chrono::duration<double, std::milli>(ShaderClock::now() - start).count();
+		ShaderLibraryStats stats = library.stats();
+		std::cout << "lazy            " << std::setw(8) << totalMs << " ms for all, worst first use " << worstMs
+			<< " ms (preprocess " << stats.preprocessMs << " ms, compile " << stats.compileMs << " ms, "
+			<< stats.failed << " failed)\n";
+
+		start = ShaderClock::now();
+		GLuint sink = 0;
+		for (int i = 0; i < lookups; i++)
+			sink ^= library.program("mesh.vert", "mesh.frag", permutations[i % permutations.size()]);
+		double lookupNs = std::chrono::duration<double, std::nano>(ShaderClock::now() - start).count() / lookups;
+		std::cout << "cached lookup   " << std::setw(8) << lookupNs << " ns" << (sink == 0xFFFFFFFFu ? " " : "") << "\n";
+
+		std::string text;
+		library.preprocess("mesh.frag", permutations.back(), text);
+		std::cout << "mesh.frag with every feature: " << std::count(text.begin(), text.end(), '\n') << " lines, "
+			<< text.size() << " bytes after includes\n";
+	}
+
+	// ahead of time at startup, files preprocessed on the job threads
+	for (int threads : { 1, 0 }) {
+		ShaderLibrary library;
+		addSources(library);
+		std::vector<ShaderDefines> permutations = salted(threads + 1);
+		std::vector<ShaderVariantDesc> descs;
+		for (const ShaderDefines& defines : permutations)
+			descs.push_back({ "mesh.vert", "mesh.frag", defines });
+		JobSystem jobs(threads);
+		ShaderClock::time_point start = ShaderClock::now();
+		library.precompile(descs, &jobs);
+		double totalMs = std::chrono::duration<double, std::milli>(ShaderClock::now() - start).count();
+
+		// a scene that only ever draws a few of them
+		for (size_t i = 0; i < permutations.size(); i += 5)
+			library.program("mesh.vert", "mesh.frag", permutations[i]);
+		ShaderLibraryStats stats = library.stats();
+		std::cout << "precompile, " << jobs.threadCount() << " threads " << std::setw(8) << totalMs << " ms, "
+			<< stats.variants << " variants, " << stats.hits << " hits, " << stats.unusedPrecompiled
+			<< " never used (candidates to prune)\n";
+	}
+}
@@ -0,0 +1,152 @@
+#ifndef SHADER_LIBRARY_H
+#define SHADER_LIBRARY_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class JobSystem;
+
+// Preprocessor defines injected into a shader variant. Kept sorted by name, so the same
+// set built in any order hashes and compares equal.
+class ShaderDefines
+{
+public:
+	ShaderDefines& set(const std::string& name, const std::string& value = "1");
+	ShaderDefines& set(const std::string& name, int value);
+	bool empty() const;
+
+	// "#define NAME VALUE" lines
+	std::string text() const;
+	// "NAME=VALUE NAME=VALUE", for reports
+	std::string describe() const;
+	uint64_t hash() const;
+	bool operator==(const ShaderDefines& other) const;
+
+private:
+	std::vector<std::pair<std::string, std::string>> entries;
+};
+
+struct ShaderVariantDesc
+{
+	std::string vertexPath;
+	std::string fragmentPath;
+	ShaderDefines defines;
+};
+
+struct ShaderVariantInfo
+{
+	std::string vertexPath;
+	std::string fragmentPath;
+	std::string defines;
+	GLuint program;		// 0 if it failed to build
+	double compileMs;	// precompiled ones get an even share of their batch
+	size_t uses;		// program() calls that returned it
+	bool precompiled;
+};
+
+struct ShaderLibraryStats
+{
+	size_t variants;
+	size_t failed;
+	size_t hits;			// program() calls answered from the cache
+	size_t misses;			// program() calls that compiled
+	size_t unusedPrecompiled;	// precompiled, then never asked for: pruning candidates
+	double preprocessMs;	// reading files and resolving includes
+	double compileMs;		// compiling and linking, on the GL thread
+};
+
+// Builds shader programs from GLSL files with #include and defines injected from C++.
+// '#include "file"' is looked up next to the including file, then in the include
+// directories; '#pragma once' files are included once per shader. Each file gets its own
+// source string number in #line directives, so compiler errors name "<file>(<line>)" by
+// index; a failing variant prints which index is which file.
+// Programs are cached by (preprocessed source hash, define set) and compiled on first use,
+// or ahead of time with precompile(). Sources are read once per path; changes on disk are
+// not picked up.
+class ShaderLibrary
+{
+public:
+	ShaderLibrary();
+	// Deletes every program; needs the context still current
+	~ShaderLibrary();
+	ShaderLibrary(const ShaderLibrary&) = delete;
+	ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+	void addIncludeDirectory(const std::string& directory);
+	// An in-memory file, found before the disk by program() and #include
+	void addSource(const std::string& name, const std::string& code);
+
+	// The variant's program, compiled on the first call; 0 if it failed. Look it up once
+	// and keep the ID, as with uniform locations: every call hashes the paths.
+	GLuint program(const std::string& vertexPath, const std::string& fragmentPath,
+		const ShaderDefines& defines = ShaderDefines());
+
+	// Builds 'variants' ahead of first use as one ShaderBatch, so a driver compiling in
+	// parallel gets all of them at once. With 'jobs', files are read and preprocessed on
+	// the job threads; compiling stays on this (the GL) thread.
+	void precompile(const std::vector<ShaderVariantDesc>& variants, JobSystem* jobs = nullptr);
+
+	// Every combination of 'features' switched on or off, on top of 'base'
+	static std::vector<ShaderDefines> permutations(const std::vector<std::string>& features,
+		const ShaderDefines& base = ShaderDefines());
+
+	// The text the compiler gets for 'path' with 'defines', for debugging
+	bool preprocess(const std::string& path, const ShaderDefines& defines, std::string& output);
+
+	// Deletes every program and forgets the sources read
+	void clear();
+
+	ShaderLibraryStats stats() const;
+	std::vector<ShaderVariantInfo> variants() const;
+
+private:
+	// A file with its includes resolved, ready for defines to go in after '#version'
+	struct ShaderSource
+	{
+		bool ok;
+		std::string version;	// the #version line, or empty
+		std::string body;
+		std::vector<std::string> files;	// by source string number
+		uint64_t hash;
+	};
+
+	struct Variant
+	{
+		ShaderVariantInfo info;
+		ShaderDefines defines;
+		uint64_t vertexHash, fragmentHash;
+	};
+
+	std::vector<std::string> includeDirectories;
+	std::map<std::string, std::string> memoryFiles;
+	std::unordered_map<std::string, ShaderSource> sources;
+	std::vector<Variant> variantList;
+	std::unordered_map<uint64_t, std::vector<size_t>> variantsByKey;	// several on a hash collision
+	mutable std::mutex sourceMutex;	// 'sources' is filled from job threads while precompiling
+	size_t hits, misses;
+	double preprocessSeconds;
+	double compileSeconds;
+
+	const ShaderSource& source(const std::string& path);
+	ShaderSource load(const std::string& path) const;
+	bool readFile(const std::string& path, std::string& text) const;
+	bool expand(const std::string& path, int depth, std::vector<std::string>& files, std::vector<std::string>& once,
+		std::string& version, std::string& output) const;
+	std::string resolveInclude(const std::string& from, const std::string& name) const;
+	// The variant's index; 'added' if it is new and still needs building
+	size_t findOrAdd(const ShaderVariantDesc& desc, bool precompiling, bool& added);
+	size_t findOrBuild(const ShaderVariantDesc& desc);
+	void reportFailure(const Variant& variant);
+};
+
+// Lazy variant lookups against compiling 32 permutations, with and without precompiling
+void runShaderLibraryBenchmark();
+
+#endif
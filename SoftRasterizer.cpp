@@ -0,0 +1,877 @@
+#include "SoftRasterizer.h"
+#include "JobSystem.h"
+#include "Shader.h"
+#include "TextureUpload.h"
+#include "VecMath.h"
+#include "stb_image.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// ---------------- 8-lane float math ----------------
+// One lane per pixel of a 4x2 block: lane = y * 4 + x
+
+#if defined(__AVX__)
+struct Lanes
+{
+	__m256 v;
+};
+static inline Lanes lanes(float s) { return { _mm256_set1_ps(s) }; }
+static inline Lanes load(const float* p) { return { _mm256_loadu_ps(p) }; }
+static inline void store(float* p, Lanes a) { _mm256_storeu_ps(p, a.v); }
+static inline Lanes operator+(Lanes a, Lanes b) { return { _mm256_add_ps(a.v, b.v) }; }
+static inline Lanes operator*(Lanes a, Lanes b) { return { _mm256_mul_ps(a.v, b.v) }; }
+static inline Lanes operator/(Lanes a, Lanes b) { return { _mm256_div_ps(a.v, b.v) }; }
+static inline int maskGreaterEqualZero(Lanes a) { return _mm256_movemask_ps(_mm256_cmp_ps(a.v, _mm256_setzero_ps(), _CMP_GE_OQ)); }
+static inline int maskGreaterZero(Lanes a) { return _mm256_movemask_ps(_mm256_cmp_ps(a.v, _mm256_setzero_ps(), _CMP_GT_OQ)); }
+#elif defined(VECMATH_SSE)
+struct Lanes
+{
+	__m128 lo, hi;
+};
+static inline Lanes lanes(float s) { return { _mm_set1_ps(s), _mm_set1_ps(s) }; }
+static inline Lanes load(const float* p) { return { _mm_loadu_ps(p), _mm_loadu_ps(p + 4) }; }
+static inline void store(float* p, Lanes a) { _mm_storeu_ps(p, a.lo); _mm_storeu_ps(p + 4, a.hi); }
+static inline Lanes operator+(Lanes a, Lanes b) { return { _mm_add_ps(a.lo, b.lo), _mm_add_ps(a.hi, b.hi) }; }
+static inline Lanes operator*(Lanes a, Lanes b) { return { _mm_mul_ps(a.lo, b.lo), _mm_mul_ps(a.hi, b.hi) }; }
+static inline Lanes operator/(Lanes a, Lanes b) { return { _mm_div_ps(a.lo, b.lo), _mm_div_ps(a.hi, b.hi) }; }
+static inline int maskGreaterEqualZero(Lanes a) {
+	return _mm_movemask_ps(_mm_cmpge_ps(a.lo, _mm_setzero_ps())) | (_mm_movemask_ps(_mm_cmpge_ps(a.hi, _mm_setzero_ps())) << 4);
+}
+static inline int maskGreaterZero(Lanes a) {
+	return _mm_movemask_ps(_mm_cmpgt_ps(a.lo, _mm_setzero_ps())) | (_mm_movemask_ps(_mm_cmpgt_ps(a.hi, _mm_setzero_ps())) << 4);
+}
+#elif defined(VECMATH_NEON)
+struct Lanes
+{
+	float32x4_t lo, hi;
+};
+static inline Lanes lanes(float s) { return { vdupq_n_f32(s), vdupq_n_f32(s) }; }
+static inline Lanes load(const float* p) { return { vld1q_f32(p), vld1q_f32(p + 4) }; }
+static inline void store(float* p, Lanes a) { vst1q_f32(p, a.lo); vst1q_f32(p + 4, a.hi); }
+static inline Lanes operator+(Lanes a, Lanes b) { return { vaddq_f32(a.lo, b.lo), vaddq_f32(a.hi, b.hi) }; }
+static inline Lanes operator*(Lanes a, Lanes b) { return { vmulq_f32(a.lo, b.lo), vmulq_f32(a.hi, b.hi) }; }
+static inline float32x4_t divide(float32x4_t a, float32x4_t b) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+	return vdivq_f32(a, b);
+#else
+	// reciprocal estimate refined by two Newton-Raphson steps
+	float32x4_t r = vrecpeq_f32(b);
+	r = vmulq_f32(r, vrecpsq_f32(b, r));
+	r = vmulq_f32(r, vrecpsq_f32(b, r));
+	return vmulq_f32(a, r);
+#endif
+}
+static inline Lanes operator/(Lanes a, Lanes b) { return { divide(a.lo, b.lo), divide(a.hi, b.hi) }; }
+static inline int movemask(uint32x4_t m) {
+	return (vgetq_lane_u32(m, 0) & 1) | (vgetq_lane_u32(m, 1) & 2) | (vgetq_lane_u32(m, 2) & 4) | (vgetq_lane_u32(m, 3) & 8);
+}
+static inline int maskGreaterEqualZero(Lanes a) {
+	return movemask(vcgeq_f32(a.lo, vdupq_n_f32(0.0f))) | (movemask(vcgeq_f32(a.hi, vdupq_n_f32(0.0f))) << 4);
+}
+static inline int maskGreaterZero(Lanes a) {
+	return movemask(vcgtq_f32(a.lo, vdupq_n_f32(0.0f))) | (movemask(vcgtq_f32(a.hi, vdupq_n_f32(0.0f))) << 4);
+}
+#else
+struct Lanes
+{
+	float v[8];
+};
+static inline Lanes lanes(float s) { Lanes r; for (int i = 0; i < 8; i++) r.v[i] = s; return r; }
+static inline Lanes load(const float* p) { Lanes r; for (int i = 0; i < 8; i++) r.v[i] = p[i]; return r; }
+static inline void store(float* p, Lanes a) { for (int i = 0; i < 8; i++) p[i] = a.v[i]; }
+static inline Lanes operator+(Lanes a, Lanes b) { for (int i = 0; i < 8; i++) a.v[i] += b.v[i]; return a; }
+static inline Lanes operator*(Lanes a, Lanes b) { for (int i = 0; i < 8; i++) a.v[i] *= b.v[i]; return a; }
+static inline Lanes operator/(Lanes a, Lanes b) { for (int i = 0; i < 8; i++) a.v[i] /= b.v[i]; return a; }
+static inline int maskGreaterEqualZero(Lanes a) { int m = 0; for (int i = 0; i < 8; i++) m |= (a.v[i] >= 0.0f) << i; return m; }
+static inline int maskGreaterZero(Lanes a) { int m = 0; for (int i = 0; i < 8; i++) m |= (a.v[i] > 0.0f) << i; return m; }
+#endif
+
+static const int blockWidth = 4;
+static const int blockHeight = 2;
+// vertices are snapped to 1/256 pixel (GL_SUBPIXEL_BITS 8, as common hardware and llvmpipe
+// report). Edge functions are set up exactly in double; per block they are rounded to float
+// symmetrically, so triangles sharing an edge never both claim or both miss a pixel.
+static const float subpixelSteps = 256.0f;
+// triangles are set up and binned in chunks of this many, in parallel, keeping submission order
+static const size_t setupChunkSize = 4096;
+
+// ---------------- SoftTexture ----------------
+
+static inline uint32_t packRGBA(const unsigned char* rgba) {
+	return (uint32_t)rgba[0] | ((uint32_t)rgba[1] << 8) | ((uint32_t)rgba[2] << 16) | ((uint32_t)rgba[3] << 24);
+}
+
+static inline void unpackRGBA(uint32_t texel, float out[4]) {
+	const float scale = 1.0f / 255.0f;
+	out[0] = (texel & 0xFF) * scale;
+	out[1] = ((texel >> 8) & 0xFF) * scale;
+	out[2] = ((texel >> 16) & 0xFF) * scale;
+	out[3] = (texel >> 24) * scale;
+}
+
+SoftTexture::SoftTexture()
+	: wrapS(GL_REPEAT), wrapT(GL_REPEAT), minFilter(GL_NEAREST_MIPMAP_LINEAR), magFilter(GL_LINEAR) {
+}
+
+void SoftTexture::setLevels(const std::vector<MipLevel>& mipLevels, int channels) {
+	levels.clear();
+	for (const MipLevel& source : mipLevels) {
+		Level level;
+		level.width = source.width;
+		level.height = source.height;
+		level.texels.resize((size_t)source.width * source.height);
+		for (size_t i = 0; i < level.texels.size(); i++) {
+			unsigned char rgba[4] = { 0, 0, 0, 255 };
+			for (int c = 0; c < channels; c++)
+				rgba[c] = source.data[i * channels + c];
+			level.texels[i] = packRGBA(rgba);
+		}
+		levels.push_back(std::move(level));
+	}
+}
+
+void SoftTexture::setImage(const unsigned char* data, int width, int height, int channels) {
+	std::vector<MipLevel> level(1);
+	level[0].width = width;
+	level[0].height = height;
+	level[0].data.assign(data, data + (size_t)width * height * channels);
+	setLevels(level, channels);
+}
+
+int SoftTexture::width() const {
+	return levels.empty() ? 0 : levels[0].width;
+}
+
+int SoftTexture::height() const {
+	return levels.empty() ? 0 : levels[0].height;
+}
+
+int SoftTexture::levelCount() const {
+	return (int)levels.size();
+}
+
+static bool isMipmapped(GLenum filter) {
+	return filter != GL_NEAREST && filter != GL_LINEAR;
+}
+
+bool SoftTexture::complete() const {
+	if (levels.empty())
+		return false;
+	if (!isMipmapped(minFilter))
+		return true;
+	return levels.back().width == 1 && levels.back().height == 1;
+}
+
+// std::floor is a library call on some targets; this is on the per-texel path
+static inline int floorToInt(float value) {
+	int i = (int)value;
+	return value < (float)i ? i - 1 : i;
+}
+
+static inline int wrapCoordinate(int i, int size, GLenum wrap) {
+	if ((unsigned)i < (unsigned)size)
+		return i;
+	if (wrap == GL_REPEAT) {
+		i %= size;
+		return i < 0 ? i + size : i;
+	}
+	return i < 0 ? 0 : size - 1;
+}
+
+// a + (b - a) * weight / 256 for all four 8-bit channels, two at a time in 16-bit lanes
+static inline uint32_t lerpRGBA(uint32_t a, uint32_t b, uint32_t weight) {
+	uint32_t inverse = 256 - weight;
+	uint32_t redBlue = (((a & 0x00FF00FF) * inverse + (b & 0x00FF00FF) * weight + 0x00800080) >> 8) & 0x00FF00FF;
+	uint32_t greenAlpha = ((((a >> 8) & 0x00FF00FF) * inverse + ((b >> 8) & 0x00FF00FF) * weight + 0x00800080) >> 8) & 0x00FF00FF;
+	return redBlue | (greenAlpha << 8);
+}
+
+// filter weights get 8 fractional bits, as in hardware texture units
+static inline uint32_t weight8(float fraction) {
+	return (uint32_t)(fraction * 256.0f + 0.5f);
+}
+
+uint32_t SoftTexture::fetchNearest(const Level& level, float s, float t) const {
+	int i = wrapCoordinate(floorToInt(s * level.width), level.width, wrapS);
+	int j = wrapCoordinate(floorToInt(t * level.height), level.height, wrapT);
+	return level.texels[(size_t)j * level.width + i];
+}
+
+uint32_t SoftTexture::fetchLinear(const Level& level, float s, float t) const {
+	float u = s * level.width - 0.5f, v = t * level.height - 0.5f;
+	int fu = floorToInt(u), fv = floorToInt(v);
+	int i0 = wrapCoordinate(fu, level.width, wrapS), i1 = wrapCoordinate(fu + 1, level.width, wrapS);
+	int j0 = wrapCoordinate(fv, level.height, wrapT), j1 = wrapCoordinate(fv + 1, level.height, wrapT);
+	const uint32_t* row0 = &level.texels[(size_t)j0 * level.width];
+	const uint32_t* row1 = &level.texels[(size_t)j1 * level.width];
+	uint32_t a = weight8(u - fu), b = weight8(v - fv);
+	return lerpRGBA(lerpRGBA(row0[i0], row0[i1], a), lerpRGBA(row1[i0], row1[i1], a), b);
+}
+
+uint32_t SoftTexture::sampleRGBA8(float s, float t, float lambda) const {
+	if (!complete())
+		return 0xFF000000;
+
+	// magnification/minification switch point (GL 3.3 section 3.8.11)
+	float c = magFilter == GL_LINEAR && (minFilter == GL_NEAREST_MIPMAP_NEAREST || minFilter == GL_NEAREST_MIPMAP_LINEAR) ? 0.5f : 0.0f;
+	if (lambda <= c)
+		return magFilter == GL_LINEAR ? fetchLinear(levels[0], s, t) : fetchNearest(levels[0], s, t);
+
+	int q = (int)levels.size() - 1;
+	bool linearTexels = minFilter == GL_LINEAR || minFilter == GL_LINEAR_MIPMAP_NEAREST || minFilter == GL_LINEAR_MIPMAP_LINEAR;
+	auto fetch = [&](int level) {
+		return linearTexels ? fetchLinear(levels[level], s, t) : fetchNearest(levels[level], s, t);
+	};
+
+	if (!isMipmapped(minFilter))
+		return fetch(0);
+	if (minFilter == GL_NEAREST_MIPMAP_NEAREST || minFilter == GL_LINEAR_MIPMAP_NEAREST) {
+		int level = lambda <= 0.5f ? 0 : (int)std::ceil(lambda + 0.5f) - 1;
+		return fetch(std::min(level, q));
+	}
+	int level = floorToInt(lambda);
+	if (level >= q)
+		return fetch(q);
+	return lerpRGBA(fetch(level), fetch(level + 1), weight8(lambda - level));
+}
+
+void SoftTexture::sample(float s, float t, float lambda, float out[4]) const {
+	unpackRGBA(sampleRGBA8(s, t, lambda), out);
+}
+
+// ---------------- SoftFramebuffer ----------------
+
+SoftFramebuffer::SoftFramebuffer(int width, int height)
+	: width(0), height(0) {
+	resize(width, height);
+}
+
+void SoftFramebuffer::resize(int newWidth, int newHeight) {
+	width = newWidth;
+	height = newHeight;
+	pixels.assign((size_t)width * height, 0);
+}
+
+static inline unsigned char toUnorm8(float value) {
+	return (unsigned char)(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+void SoftFramebuffer::clear(float r, float g, float b, float a) {
+	unsigned char rgba[4] = { toUnorm8(r), toUnorm8(g), toUnorm8(b), toUnorm8(a) };
+	std::fill(pixels.begin(), pixels.end(), packRGBA(rgba));
+}
+
+SoftPipelineState::SoftPipelineState()
+	: texture1(nullptr), texture2(nullptr), interp(0.0f) {
+	std::fill(positionScale, positionScale + 3, 1.0f);
+	std::fill(positionBias, positionBias + 3, 0.0f);
+}
+
+SoftImageDiff compareImages(const uint32_t* a, const uint32_t* b, size_t pixelCount, int tolerance) {
+	SoftImageDiff diff = { 0, 0 };
+	for (size_t i = 0; i < pixelCount; i++) {
+		int pixelMax = 0;
+		for (int shift = 0; shift < 32; shift += 8)
+			pixelMax = std::max(pixelMax, std::abs((int)((a[i] >> shift) & 0xFF) - (int)((b[i] >> shift) & 0xFF)));
+		diff.maxDifference = std::max(diff.maxDifference, pixelMax);
+		if (pixelMax > tolerance)
+			diff.differingPixels++;
+	}
+	return diff;
+}
+
+// ---------------- setup ----------------
+
+struct TriangleSetup
+{
+	// E(x, y) = a x + b y + c, evaluated at the center of pixel (x, y); positive inside.
+	// Edge i is opposite vertex i, so E_i is proportional to its barycentric weight.
+	double a[3], b[3], c[3];
+	bool topLeft[3];		// pixels exactly on a top or left edge belong to this triangle
+	int minX, minY, maxX, maxY;
+	float invW[3];
+	float s[3], t[3];		// texture coordinates divided by w
+};
+
+static SoftVertex lerpVertex(const SoftVertex& a, const SoftVertex& b, float t) {
+	SoftVertex r;
+	for (int k = 0; k < 4; k++)
+		r.position[k] = a.position[k] + (b.position[k] - a.position[k]) * t;
+	for (int k = 0; k < 3; k++)
+		r.color[k] = a.color[k] + (b.color[k] - a.color[k]) * t;
+	for (int k = 0; k < 2; k++)
+		r.texCoord[k] = a.texCoord[k] + (b.texCoord[k] - a.texCoord[k]) * t;
+	return r;
+}
+
+// Signed distance to the view volume plane 'plane' (-x, +x, -y, +y, -z, +z), >= 0 inside
+static inline float planeDistance(const SoftVertex& v, int plane) {
+	const float* p = v.position;
+	float coordinate = p[plane >> 1];
+	return plane & 1 ? p[3] - coordinate : p[3] + coordinate;
+}
+
+// Sutherland-Hodgman against the six planes; 'polygon' needs room for 9 vertices
+static int clipPolygon(SoftVertex* polygon, int count) {
+	SoftVertex scratch[9];
+	for (int plane = 0; plane < 6 && count > 0; plane++) {
+		int outCount = 0;
+		for (int i = 0; i < count; i++) {
+			const SoftVertex& current = polygon[i];
+			const SoftVertex& next = polygon[(i + 1) % count];
+			float d0 = planeDistance(current, plane), d1 = planeDistance(next, plane);
+			if (d0 >= 0.0f)
+				scratch[outCount++] = current;
+			if ((d0 >= 0.0f) != (d1 >= 0.0f))
+				scratch[outCount++] = lerpVertex(current, next, d0 / (d0 - d1));
+		}
+		std::copy(scratch, scratch + outCount, polygon);
+		count = outCount;
+	}
+	return count;
+}
+
+static bool setupTriangle(const SoftVertex& v0, const SoftVertex& v1, const SoftVertex& v2, int width, int height, TriangleSetup& out) {
+	const SoftVertex* v[3] = { &v0, &v1, &v2 };
+	double x[3], y[3];
+	float invW[3];
+	for (int i = 0; i < 3; i++) {
+		invW[i] = 1.0f / v[i]->position[3];
+		float windowX = (v[i]->position[0] * invW[i] * 0.5f + 0.5f) * width;
+		float windowY = (v[i]->position[1] * invW[i] * 0.5f + 0.5f) * height;
+		x[i] = std::floor(windowX * subpixelSteps + 0.5f) / subpixelSteps;
+		y[i] = std::floor(windowY * subpixelSteps + 0.5f) / subpixelSteps;
+	}
+
+	double area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+	if (area == 0.0)
+		return false;
+	// both windings are drawn (no culling); make the order counter-clockwise
+	int order[3] = { 0, 1, 2 };
+	if (area < 0.0)
+		std::swap(order[1], order[2]);
+
+	double minX = x[0], maxX = x[0], minY = y[0], maxY = y[0];
+	for (int i = 0; i < 3; i++) {
+		int a = order[(i + 1) % 3], b = order[(i + 2) % 3];
+		out.a[i] = y[a] - y[b];
+		out.b[i] = x[b] - x[a];
+		out.c[i] = -(out.a[i] * x[a] + out.b[i] * y[a]) + 0.5 * (out.a[i] + out.b[i]);
+		double dx = x[b] - x[a], dy = y[b] - y[a];
+		out.topLeft[i] = dy < 0.0 || (dy == 0.0 && dx < 0.0);
+
+		int vertex = order[i];
+		out.invW[i] = invW[vertex];
+		out.s[i] = v[vertex]->texCoord[0] * invW[vertex];
+		out.t[i] = v[vertex]->texCoord[1] * invW[vertex];
+		minX = std::min(minX, x[i]);
+		maxX = std::max(maxX, x[i]);
+		minY = std::min(minY, y[i]);
+		maxY = std::max(maxY, y[i]);
+	}
+
+	// pixels whose centers can be covered
+	out.minX = std::max(0, (int)std::ceil(minX - 0.5));
+	out.minY = std::max(0, (int)std::ceil(minY - 0.5));
+	out.maxX = std::min(width - 1, (int)std::floor(maxX - 0.5));
+	out.maxY = std::min(height - 1, (int)std::floor(maxY - 0.5));
+	return out.minX <= out.maxX && out.minY <= out.maxY;
+}
+
+// ---------------- raster ----------------
+
+// an unbound texture unit samples as (0, 0, 0, 1)
+static inline uint32_t sampleOrBlack(const SoftTexture* texture, float s, float t, float lambda) {
+	return texture ? texture->sampleRGBA8(s, t, lambda) : 0xFF000000;
+}
+
+static float levelOfDetail(const SoftTexture* texture, const float* s, const float* t, int lane) {
+	if (texture == nullptr)
+		return 0.0f;
+	float w = (float)texture->width(), h = (float)texture->height();
+	float dsdx = (s[lane + 1] - s[lane]) * w, dtdx = (t[lane + 1] - t[lane]) * h;
+	float dsdy = (s[lane + blockWidth] - s[lane]) * w, dtdy = (t[lane + blockWidth] - t[lane]) * h;
+	float rho = std::max(std::sqrt(dsdx * dsdx + dtdx * dtdx), std::sqrt(dsdy * dsdy + dtdy * dtdy));
+	return std::log2(rho);
+}
+
+// Rasterizes 'tri' inside the tile [x0, x1) x [y0, y1) and returns the pixels written
+static size_t rasterizeTile(const TriangleSetup& tri, int x0, int y0, int x1, int y1,
+	SoftFramebuffer& target, const SoftPipelineState& state) {
+	int startX = std::max(tri.minX, x0) & ~(blockWidth - 1);
+	int startY = std::max(tri.minY, y0) & ~(blockHeight - 1);
+	int endX = std::min(tri.maxX + 1, x1);
+	int endY = std::min(tri.maxY + 1, y1);
+
+	Lanes offsets[3];
+	for (int e = 0; e < 3; e++) {
+		float laneOffsets[8];
+		for (int lane = 0; lane < 8; lane++)
+			laneOffsets[lane] = (float)(tri.a[e] * (lane % blockWidth) + tri.b[e] * (lane / blockWidth));
+		offsets[e] = load(laneOffsets);
+	}
+	Lanes invW[3], s[3], t[3];
+	for (int e = 0; e < 3; e++) {
+		invW[e] = lanes(tri.invW[e]);
+		s[e] = lanes(tri.s[e]);
+		t[e] = lanes(tri.t[e]);
+	}
+
+	// mix() in 8-bit fixed point, within one step of the float result
+	uint32_t interp = weight8(std::min(std::max(state.interp, 0.0f), 1.0f));
+
+	size_t written = 0;
+	for (int by = startY; by < endY; by += blockHeight) {
+		for (int bx = startX; bx < endX; bx += blockWidth) {
+			int mask = 0xFF;
+			Lanes edge[3];
+			for (int e = 0; e < 3; e++) {
+				edge[e] = lanes((float)(tri.a[e] * bx + tri.b[e] * by + tri.c[e])) + offsets[e];
+				mask &= tri.topLeft[e] ? maskGreaterEqualZero(edge[e]) : maskGreaterZero(edge[e]);
+			}
+			if (mask == 0)
+				continue;
+			// lanes past the end of the tile or target
+			if (bx + blockWidth > x1 || by + blockHeight > y1) {
+				for (int lane = 0; lane < 8; lane++) {
+					if (bx + lane % blockWidth >= x1 || by + lane / blockWidth >= y1)
+						mask &= ~(1 << lane);
+				}
+			}
+
+			// perspective-correct texture coordinates for all 8 lanes, uncovered ones too:
+			// like a GPU's helper pixels they provide the derivatives for mip selection
+			Lanes w0 = edge[0] * invW[0], w1 = edge[1] * invW[1], w2 = edge[2] * invW[2];
+			Lanes sum = w0 + w1 + w2;
+			float laneS[8], laneT[8];
+			store(laneS, (w0 * s[0] + w1 * s[1] + w2 * s[2]) / sum);
+			store(laneT, (w0 * t[0] + w1 * t[1] + w2 * t[2]) / sum);
+
+			// two 2x2 quads per block share a level of detail each
+			for (int quad = 0; quad < blockWidth; quad += 2) {
+				int quadMask = (0x3 << quad) | (0x3 << (quad + blockWidth));
+				if ((mask & quadMask) == 0)
+					continue;
+				float lambda1 = levelOfDetail(state.texture1, laneS, laneT, quad);
+				float lambda2 = levelOfDetail(state.texture2, laneS, laneT, quad);
+				for (int lane = 0; lane < 8; lane++) {
+					if (!(mask & quadMask & (1 << lane)))
+						continue;
+					// texture_fragment.glsl
+					uint32_t color1 = sampleOrBlack(state.texture1, laneS[lane], laneT[lane], lambda1);
+					uint32_t color2 = sampleOrBlack(state.texture2, laneS[lane], laneT[lane], lambda2);
+					int px = bx + lane % blockWidth, py = by + lane / blockWidth;
+					target.pixels[(size_t)py * target.width + px] = lerpRGBA(color1, color2, interp);
+					written++;
+				}
+			}
+		}
+	}
+	return written;
+}
+
+// ---------------- SoftRasterizer ----------------
+
+SoftRasterizer::SoftRasterizer(JobSystem* jobs, int tileSize)
+	: jobs(jobs), tileSize(std::max(blockWidth, tileSize & ~(blockWidth - 1))), target(nullptr) {
+	resetStats();
+}
+
+void SoftRasterizer::setTarget(SoftFramebuffer* framebuffer) {
+	target = framebuffer;
+}
+
+const SoftRasterStats& SoftRasterizer::stats() const {
+	return totals;
+}
+
+void SoftRasterizer::resetStats() {
+	totals.triangles = 0;
+	totals.clipped = 0;
+	totals.binned = 0;
+	totals.pixels = 0;
+}
+
+void SoftRasterizer::drawElements(const VertexFormat& format, const void* vertices, size_t vertexCount,
+	const uint32_t* indices, size_t indexCount, const SoftPipelineState& state) {
+	// texture_vertex.glsl; attributes the format lacks read as the GL default (0, 0, 0, 1)
+	std::vector<float> positions(vertexCount * 3, 0.0f), colors(vertexCount * 3, 0.0f), texCoords(vertexCount * 2, 0.0f);
+	format.unpack(0, vertices, vertexCount, positions.data(), 3);
+	format.unpack(1, vertices, vertexCount, colors.data(), 3);
+	format.unpack(2, vertices, vertexCount, texCoords.data(), 2);
+
+	std::vector<SoftVertex> shaded(vertexCount);
+	for (size_t v = 0; v < vertexCount; v++) {
+		SoftVertex& out = shaded[v];
+		for (int k = 0; k < 3; k++) {
+			out.position[k] = positions[v * 3 + k] * state.positionScale[k] + state.positionBias[k];
+			out.color[k] = colors[v * 3 + k];
+		}
+		out.position[3] = 1.0f;
+		out.texCoord[0] = texCoords[v * 2];
+		out.texCoord[1] = texCoords[v * 2 + 1];
+	}
+	drawTriangles(shaded.data(), indices, indexCount, state);
+}
+
+// Runs body(first, last) over [0, count), spread over the job system when there is one
+static void forEachRange(JobSystem* jobs, size_t count, const std::function<void(size_t, size_t)>& body) {
+	if (jobs && count > 1)
+		jobs->parallelFor(count, 1, body);
+	else if (count > 0)
+		body(0, count);
+}
+
+void SoftRasterizer::drawTriangles(const SoftVertex* vertices, const uint32_t* indices, size_t indexCount,
+	const SoftPipelineState& state) {
+	if (target == nullptr || target->width <= 0 || target->height <= 0)
+		return;
+	const int width = target->width, height = target->height;
+	const int tilesX = (width + tileSize - 1) / tileSize, tilesY = (height + tileSize - 1) / tileSize;
+	const size_t tileCount = (size_t)tilesX * tilesY;
+	const size_t triangleCount = indexCount / 3;
+	const int size = tileSize;
+
+	// setup and binning: every chunk keeps its own triangles and per-tile lists, so chunks
+	// run in parallel and each tile still sees its triangles in submission order
+	struct SetupChunk
+	{
+		std::vector<TriangleSetup> triangles;
+		std::vector<std::vector<uint32_t>> bins;
+		size_t clipped, binned;
+	};
+	std::vector<SetupChunk> chunks((triangleCount + setupChunkSize - 1) / setupChunkSize);
+	forEachRange(jobs, chunks.size(), [&](size_t first, size_t last) {
+		for (size_t c = first; c < last; c++) {
+			SetupChunk& chunk = chunks[c];
+			chunk.bins.resize(tileCount);
+			chunk.clipped = 0;
+			chunk.binned = 0;
+			size_t end = std::min(triangleCount, (c + 1) * setupChunkSize);
+			for (size_t triangle = c * setupChunkSize; triangle < end; triangle++) {
+				SoftVertex polygon[9];
+				bool inside = true;
+				for (int k = 0; k < 3; k++) {
+					polygon[k] = vertices[indices[triangle * 3 + k]];
+					for (int plane = 0; plane < 6; plane++)
+						inside = inside && planeDistance(polygon[k], plane) >= 0.0f;
+				}
+				int count = inside ? 3 : clipPolygon(polygon, 3);
+
+				bool visible = false;
+				for (int k = 1; k + 1 < count; k++) {
+					TriangleSetup setup;
+					if (!setupTriangle(polygon[0], polygon[k], polygon[k + 1], width, height, setup))
+						continue;
+					visible = true;
+					uint32_t index = (uint32_t)chunk.triangles.size();
+					chunk.triangles.push_back(setup);
+					for (int ty = setup.minY / size; ty <= setup.maxY / size; ty++) {
+						for (int tx = setup.minX / size; tx <= setup.maxX / size; tx++) {
+							chunk.bins[(size_t)ty * tilesX + tx].push_back(index);
+							chunk.binned++;
+						}
+					}
+				}
+				if (!visible)
+					chunk.clipped++;
+			}
+		}
+	});
+
+	std::vector<size_t> tilePixels(tileCount, 0);
+	forEachRange(jobs, tileCount, [&](size_t first, size_t last) {
+		for (size_t tile = first; tile < last; tile++) {
+			int x0 = (int)(tile % tilesX) * size, y0 = (int)(tile / tilesX) * size;
+			int x1 = std::min(x0 + size, width), y1 = std::min(y0 + size, height);
+			for (const SetupChunk& chunk : chunks) {
+				for (uint32_t index : chunk.bins[tile])
+					tilePixels[tile] += rasterizeTile(chunk.triangles[index], x0, y0, x1, y1, *target, state);
+			}
+		}
+	});
+
+	totals.triangles += triangleCount;
+	for (const SetupChunk& chunk : chunks) {
+		totals.clipped += chunk.clipped;
+		totals.binned += chunk.binned;
+	}
+	for (size_t pixels : tilePixels)
+		totals.pixels += pixels;
+}
+
+// ---------------- benchmark ----------------
+
+// Decodes an image into the demo's mip chain, or a checkerboard if it is missing
+static std::vector<MipLevel> loadBenchmarkLevels(const char* path, bool flip, int& channels) {
+	stbi_set_flip_vertically_on_load_thread(flip);
+	int width, height;
+	unsigned char* data = loadImageForUpload(path, &width, &height, &channels);
+	if (data) {
+		std::vector<MipLevel> levels = generateMipChain(data, width, height, channels, MipFilter::Box, true, 1);
+		stbi_image_free(data);
+		return levels;
+	}
+	const int size = 256;
+	std::vector<unsigned char> checker((size_t)size * size * 4);
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			unsigned char value = ((x / 16) ^ (y / 16)) & 1 ? 230 : 40;
+			unsigned char* p = &checker[((size_t)y * size + x) * 4];
+			p[0] = p[1] = p[2] = value;
+			p[3] = 255;
+		}
+	}
+	channels = 4;
+	return generateMipChain(checker.data(), size, size, 4, MipFilter::Box, true, 1);
+}
+
+static void loadBenchmarkTexture(const char* path, bool flip, SoftTexture& texture) {
+	int channels;
+	std::vector<MipLevel> levels = loadBenchmarkLevels(path, flip, channels);
+	texture.setLevels(levels, channels);
+}
+
+// The demo quad stored like Main.cpp stores it: snorm16 positions, 8-bit colors, half texture coords
+static std::vector<unsigned char> packDemoQuad(VertexFormat& format) {
+	float quad[] = {
+		1.0f,  1.0f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,
+		1.0f, -1.0f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,
+		-1.0f, -1.0f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,
+		-1.0f,  1.0f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f
+	};
+	format.addQuantized(0, 3, VertexEncoding::Snorm16).add(1, 3, VertexEncoding::Unorm8).add(2, 2, VertexEncoding::Half);
+	const VertexSource sources[] = { { quad, 8 }, { quad + 3, 8 }, { quad + 6, 8 } };
+	return format.pack(sources, 4);
+}
+
+static const uint32_t demoQuadIndices[] = { 0, 1, 3, 1, 2, 3 };
+
+void runSoftRasterizerBenchmark() {
+	const int width = 1920, height = 1080;
+	const int iterations = 5;
+
+	SoftTexture container, face;
+	loadBenchmarkTexture("container.jpg", false, container);
+	loadBenchmarkTexture("taylor.jpg", true, face);
+
+	// the demo quad, stretched over the whole target
+	VertexFormat quadFormat;
+	std::vector<unsigned char> quadVertices = packDemoQuad(quadFormat);
+
+	// a grid of small triangles with the texture repeated across it, so setup, binning and
+	// mip selection dominate
+	const int grid = 192;
+	std::vector<float> gridData;
+	std::vector<uint32_t> gridIndices;
+	for (int y = 0; y <= grid; y++) {
+		for (int x = 0; x <= grid; x++) {
+			float u = (float)x / grid, v = (float)y / grid;
+			float vertex[8] = { u * 2.0f - 1.0f, v * 2.0f - 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, u * 8.0f, v * 8.0f };
+			gridData.insert(gridData.end(), vertex, vertex + 8);
+		}
+	}
+	for (int y = 0; y < grid; y++) {
+		for (int x = 0; x < grid; x++) {
+			uint32_t i = (uint32_t)(y * (grid + 1) + x);
+			uint32_t cell[6] = { i, i + 1, i + grid + 1, i + 1, i + grid + 2, i + grid + 1 };
+			gridIndices.insert(gridIndices.end(), cell, cell + 6);
+		}
+	}
+	VertexFormat gridFormat;
+	gridFormat.add(0, 3, VertexEncoding::Float).add(1, 3, VertexEncoding::Float).add(2, 2, VertexEncoding::Float);
+	size_t gridVertexCount = gridData.size() / 8;
+
+	struct Case
+	{
+		const char* name;
+		GLenum minFilter, magFilter;
+		bool useGrid;
+	};
+	const Case cases[] = {
+		{ "quad  linear/nearest", GL_LINEAR, GL_LINEAR, false },
+		{ "quad  trilinear", GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, false },
+		{ "grid  trilinear", GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, true },
+	};
+
+#if defined(__AVX__)
+	const char* simd = "AVX";
+#elif defined(VECMATH_SSE)
+	const char* simd = "SSE";
+#elif defined(VECMATH_NEON)
+	const char* simd = "NEON";
+#else
+	const char* simd = "scalar";
+#endif
+	int hardwareThreads = std::max(1, (int)std::thread::hardware_concurrency());
+	std::cout << width << "x" << height << ", " << simd << " edge functions, " << hardwareThreads << " hardware threads\n";
+	std::cout << std::left << std::setw(24) << "case" << "threads  ms/frame  Mpix/s  Mtri/s\n";
+
+	SoftFramebuffer framebuffer(width, height);
+	for (const Case& c : cases) {
+		container.minFilter = c.minFilter;
+		container.magFilter = c.magFilter;
+		container.wrapS = container.wrapT = GL_CLAMP_TO_EDGE;
+		face.minFilter = c.minFilter == GL_LINEAR ? GL_NEAREST : c.minFilter;
+		face.magFilter = c.minFilter == GL_LINEAR ? GL_NEAREST : c.magFilter;
+		face.wrapS = face.wrapT = GL_REPEAT;
+
+		SoftPipelineState state;
+		state.texture1 = &container;
+		state.texture2 = &face;
+		state.interp = 0.2f;
+		if (!c.useGrid) {
+			std::copy(quadFormat.attribute(0).scale, quadFormat.attribute(0).scale + 3, state.positionScale);
+			std::copy(quadFormat.attribute(0).bias, quadFormat.attribute(0).bias + 3, state.positionBias);
+		}
+
+		for (int threads = 1; ; threads = std::min(threads * 2, hardwareThreads)) {
+			JobSystem jobs(threads);
+			SoftRasterizer rasterizer(threads > 1 ? &jobs : nullptr);
+			rasterizer.setTarget(&framebuffer);
+
+			double best = 1e30;
+			for (int i = 0; i < iterations; i++) {
+				framebuffer.clear(0.2f, 0.3f, 0.3f, 1.0f);
+				rasterizer.resetStats();
+				auto start = std::chrono::high_resolution_clock::now();
+				if (c.useGrid)
+					rasterizer.drawElements(gridFormat, gridData.data(), gridVertexCount, gridIndices.data(), gridIndices.size(), state);
+				else
+					rasterizer.drawElements(quadFormat, quadVertices.data(), 4, demoQuadIndices, 6, state);
+				std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+				best = std::min(best, elapsed.count());
+			}
+			const SoftRasterStats& stats = rasterizer.stats();
+			std::cout << std::left << std::setw(24) << c.name << std::setw(9) << threads
+				<< std::fixed << std::setprecision(2) << std::setw(10) << best
+				<< std::setprecision(1) << std::setw(8) << stats.pixels / (best * 1000.0)
+				<< std::setprecision(2) << stats.triangles / (best * 1000.0) << "\n";
+			if (threads == hardwareThreads)
+				break;
+		}
+	}
+}
+
+bool runSoftRasterizerCheck(int tolerance) {
+	// prime sizes: partial tiles, and no pixel center lands exactly on a texel edge, where
+	// nearest sampling may round either way
+	const int width = 197, height = 143;
+	int containerChannels, faceChannels;
+	std::vector<MipLevel> containerLevels = loadBenchmarkLevels("container.jpg", false, containerChannels);
+	std::vector<MipLevel> faceLevels = loadBenchmarkLevels("taylor.jpg", true, faceChannels);
+	SoftTexture container, face;
+	container.setLevels(containerLevels, containerChannels);
+	face.setLevels(faceLevels, faceChannels);
+
+	Shader shader("texture_vertex.glsl", "texture_fragment.glsl");
+	GLint linked = 0;
+	glGetProgramiv(shader.ID, GL_LINK_STATUS, &linked);
+	if (!linked) {
+		std::cout << "ERROR::SOFT_RASTERIZER::CHECK_NEEDS_THE_DEMO_SHADERS" << std::endl;
+		glDeleteProgram(shader.ID);
+		return false;
+	}
+
+	VertexFormat quadFormat;
+	std::vector<unsigned char> quadVertices = packDemoQuad(quadFormat);
+	GLuint vao, buffers[2];
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	glGenBuffers(2, buffers);
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, quadVertices.size(), quadVertices.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(demoQuadIndices), demoQuadIndices, GL_STATIC_DRAW);
+	quadFormat.apply();
+
+	GLuint target, framebuffer;
+	glGenTextures(1, &target);
+	glBindTexture(GL_TEXTURE_2D, target);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target, 0);
+	glViewport(0, 0, width, height);
+
+	GLuint textures[2] = { uploadMipChain(containerLevels, containerChannels), uploadMipChain(faceLevels, faceChannels) };
+	const float interp = 0.2f;
+	shader.use();
+	shader.setInt("texture1", 0);
+	shader.setInt("texture2", 1);
+	shader.setFloat("interp", interp);
+	quadFormat.setDequantUniforms(shader.ID, 0, "positionScale", "positionBias");
+
+	SoftPipelineState state;
+	state.texture1 = &container;
+	state.texture2 = &face;
+	state.interp = interp;
+	std::copy(quadFormat.attribute(0).scale, quadFormat.attribute(0).scale + 3, state.positionScale);
+	std::copy(quadFormat.attribute(0).bias, quadFormat.attribute(0).bias + 3, state.positionBias);
+	SoftFramebuffer soft(width, height);
+	SoftRasterizer rasterizer;
+	rasterizer.setTarget(&soft);
+
+	struct Case
+	{
+		const char* name;
+		GLenum minFilter[2], magFilter[2], wrap[2];
+	};
+	const Case cases[] = {
+		{ "demo samplers", { GL_LINEAR, GL_NEAREST }, { GL_LINEAR, GL_NEAREST }, { GL_CLAMP_TO_EDGE, GL_REPEAT } },
+		{ "trilinear", { GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR }, { GL_LINEAR, GL_LINEAR }, { GL_CLAMP_TO_EDGE, GL_REPEAT } },
+		{ "nearest mipmap", { GL_NEAREST_MIPMAP_NEAREST, GL_NEAREST_MIPMAP_NEAREST }, { GL_NEAREST, GL_NEAREST }, { GL_REPEAT, GL_REPEAT } },
+	};
+
+	std::cout << width << "x" << height << " demo quad, GL (" << glGetString(GL_RENDERER) << ") against the software rasterizer\n";
+	std::cout << std::left << std::setw(18) << "case" << "max channel diff  pixels over " << tolerance << "\n";
+	std::vector<uint32_t> pixels((size_t)width * height);
+	bool passed = true;
+	for (const Case& c : cases) {
+		SoftTexture* softTextures[2] = { &container, &face };
+		for (int unit = 0; unit < 2; unit++) {
+			glActiveTexture(GL_TEXTURE0 + unit);
+			glBindTexture(GL_TEXTURE_2D, textures[unit]);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, c.minFilter[unit]);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, c.magFilter[unit]);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, c.wrap[unit]);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, c.wrap[unit]);
+			softTextures[unit]->minFilter = c.minFilter[unit];
+			softTextures[unit]->magFilter = c.magFilter[unit];
+			softTextures[unit]->wrapS = softTextures[unit]->wrapT = c.wrap[unit];
+		}
+
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+		soft.clear(0.2f, 0.3f, 0.3f, 1.0f);
+		rasterizer.drawElements(quadFormat, quadVertices.data(), 4, demoQuadIndices, 6, state);
+
+		SoftImageDiff diff = compareImages(pixels.data(), soft.pixels.data(), pixels.size(), tolerance);
+		std::cout << std::left << std::setw(18) << c.name << std::setw(18) << diff.maxDifference << diff.differingPixels
+			<< (diff.differingPixels ? "  FAILED" : "") << "\n";
+		passed = passed && diff.differingPixels == 0;
+	}
+	glActiveTexture(GL_TEXTURE0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteTextures(1, &target);
+	glDeleteTextures(2, textures);
+	glDeleteBuffers(2, buffers);
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(shader.ID);
+	return passed;
+}
@@ -0,0 +1,143 @@
+#ifndef SOFT_RASTERIZER_H
+#define SOFT_RASTERIZER_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "MipGenerator.h"
+#include "VertexFormat.h"
+
+class JobSystem;
+
+// CPU implementation of the part of GL the demo renders with, so frames can be produced
+// and compared without a driver: indexed triangles through the texture_vertex.glsl /
+// texture_fragment.glsl pipeline, sampled with the GL filtering and wrapping rules.
+// The screen is cut into tiles that are rasterized in parallel on a JobSystem; coverage
+// is tested 8 pixels (a 4x2 block) at a time with AVX, SSE or NEON edge functions.
+
+// RGBA8 texture with a mip chain, sampled like a GL texture with the same parameters
+class SoftTexture
+{
+public:
+	SoftTexture();
+
+	// Takes the levels uploadMipChain would upload; 1-3 channel data is expanded the way
+	// GL_RED/GL_RG/GL_RGB are, missing components read as 0 and alpha as 1
+	void setLevels(const std::vector<MipLevel>& levels, int channels);
+	// Level 0 only, like glTexImage2D without mipmaps
+	void setImage(const unsigned char* data, int width, int height, int channels);
+
+	// glTexParameteri equivalents; defaults match GL (REPEAT, NEAREST_MIPMAP_LINEAR, LINEAR)
+	GLenum wrapS, wrapT;
+	GLenum minFilter, magFilter;
+
+	int width() const;
+	int height() const;
+	int levelCount() const;
+
+	// Filters at (s, t) with level of detail 'lambda' (log2 of the texel footprint).
+	// An incomplete texture (mipmapped filter without the full chain) returns (0, 0, 0, 1).
+	// Texels are filtered with 8-bit weights like a hardware texture unit.
+	void sample(float s, float t, float lambda, float out[4]) const;
+	// Same, returning the filtered RGBA8 texel packed as in SoftFramebuffer
+	uint32_t sampleRGBA8(float s, float t, float lambda) const;
+
+private:
+	struct Level
+	{
+		int width, height;
+		std::vector<uint32_t> texels;	// RGBA8, bottom row first
+	};
+	std::vector<Level> levels;
+
+	bool complete() const;
+	uint32_t fetchNearest(const Level& level, float s, float t) const;
+	uint32_t fetchLinear(const Level& level, float s, float t) const;
+};
+
+// Color buffer in the layout glReadPixels(GL_RGBA, GL_UNSIGNED_BYTE) returns:
+// bottom row first, each pixel R, G, B, A bytes
+struct SoftFramebuffer
+{
+	int width, height;
+	std::vector<uint32_t> pixels;
+
+	SoftFramebuffer(int width = 0, int height = 0);
+	void resize(int width, int height);
+	void clear(float r, float g, float b, float a);
+};
+
+// Uniforms of the demo pipeline
+struct SoftPipelineState
+{
+	float positionScale[3];
+	float positionBias[3];
+	const SoftTexture* texture1;
+	const SoftTexture* texture2;
+	float interp;
+
+	SoftPipelineState();
+};
+
+// texture_vertex.glsl output: clip position, color and texture coordinates
+struct SoftVertex
+{
+	float position[4];
+	float color[3];
+	float texCoord[2];
+};
+
+struct SoftRasterStats
+{
+	size_t triangles;	// submitted
+	size_t clipped;		// entirely outside the view volume or degenerate
+	size_t binned;		// triangle/tile pairs
+	size_t pixels;		// shaded and written
+};
+
+// Per-channel comparison of two RGBA8 images, e.g. a frame against a golden image
+struct SoftImageDiff
+{
+	int maxDifference;
+	size_t differingPixels;	// pixels with any channel off by more than the tolerance
+};
+SoftImageDiff compareImages(const uint32_t* a, const uint32_t* b, size_t pixelCount, int tolerance);
+
+class SoftRasterizer
+{
+public:
+	// Tiles are rasterized on 'jobs' when given, on the calling thread otherwise
+	SoftRasterizer(JobSystem* jobs = nullptr, int tileSize = 64);
+
+	void setTarget(SoftFramebuffer* framebuffer);
+
+	// glDrawElements(GL_TRIANGLES) with vertices laid out by 'format' (locations 0, 1 and 2
+	// as in texture_vertex.glsl) and the vertex shader run on the CPU
+	void drawElements(const VertexFormat& format, const void* vertices, size_t vertexCount,
+		const uint32_t* indices, size_t indexCount, const SoftPipelineState& state);
+	// Same, starting from vertex shader output
+	void drawTriangles(const SoftVertex* vertices, const uint32_t* indices, size_t indexCount,
+		const SoftPipelineState& state);
+
+	// Totals since the last resetStats()
+	const SoftRasterStats& stats() const;
+	void resetStats();
+
+private:
+	JobSystem* jobs;
+	int tileSize;
+	SoftFramebuffer* target;
+	SoftRasterStats totals;
+};
+
+// Fill rate of the demo pipeline per thread count and on a grid of small triangles, in Mpix/s
+void runSoftRasterizerBenchmark();
+
+// Renders the demo quad through GL (texture_vertex.glsl / texture_fragment.glsl, so run it
+// from the directory holding them) and through the rasterizer with the demo's samplers and
+// with mipmapped ones, and prints compareImages for each. Returns false if any channel of
+// any pixel differs by more than 'tolerance'. Needs a current context.
+bool runSoftRasterizerCheck(int tolerance);
+
+#endif
@@ -0,0 +1,148 @@
+#include "StreamBuffer.h"
+#include "GLTrace.h"
+#include <cstring>
+#include <iostream>
+
+static const GLbitfield persistentFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+StreamBuffer::StreamBuffer(GLenum target, size_t capacity)
+	: StreamBuffer(target, capacity, glCapabilities().streamPath) {
+}
+
+StreamBuffer::StreamBuffer(GLenum target, size_t capacity, StreamPath path)
+	: bufferTarget(target), size(capacity), streamPath(path), name(0), mapped(nullptr), head(0), frameBegin(0) {
+	totals.bytes = totals.wraps = totals.waits = 0;
+	create();
+}
+
+StreamBuffer::~StreamBuffer() {
+	for (Region& region : regions)
+		glDeleteSync(region.fence);
+	if (mapped) {
+		glBindBuffer(bufferTarget, name);
+		glUnmapBuffer(bufferTarget);
+	}
+	glDeleteBuffers(1, &name);
+}
+
+void StreamBuffer::create() {
+	// a trace captures mapped data at glUnmapBuffer, so writes through a persistent mapping
+	// would never reach it
+	if (streamPath == StreamPath::PersistentMapped && traceActive())
+		streamPath = StreamPath::MapRange;
+	glGenBuffers(1, &name);
+	glBindBuffer(bufferTarget, name);
+	if (streamPath == StreamPath::PersistentMapped) {
+		glBufferStorage(bufferTarget, size, nullptr, persistentFlags);
+		mapped = (unsigned char*)glMapBufferRange(bufferTarget, 0, size, persistentFlags);
+		if (mapped)
+			return;
+		// immutable storage can't be respecified, so start over with a plain buffer
+		std::cout << "ERROR::STREAM_BUFFER::PERSISTENT_MAP_FAILED falling back to " << streamPathName(StreamPath::MapRange)
+			<< std::endl;
+		glDeleteBuffers(1, &name);
+		streamPath = StreamPath::MapRange;
+		glGenBuffers(1, &name);
+		glBindBuffer(bufferTarget, name);
+	}
+	glBufferData(bufferTarget, size, nullptr, GL_STREAM_DRAW);
+}
+
+size_t StreamBuffer::push(const void* data, size_t bytes, size_t alignment) {
+	if (bytes > size) {
+		std::cout << "ERROR::STREAM_BUFFER::PUSH_TOO_LARGE " << bytes << " bytes into " << size << std::endl;
+		return (size_t)-1;
+	}
+	size_t offset = (head + alignment - 1) & ~(alignment - 1);
+	if (offset + bytes > size) {
+		// fence what this frame wrote before the wrap, it is next in line a lap from now
+		endFrame();
+		offset = 0;
+		head = frameBegin = 0;
+		totals.wraps++;
+		if (streamPath == StreamPath::SubData) {
+			glBindBuffer(bufferTarget, name);
+			glBufferData(bufferTarget, size, nullptr, GL_STREAM_DRAW);
+		}
+	}
+	if (streamPath != StreamPath::SubData)
+		waitFor(offset, offset + bytes);
+
+	glBindBuffer(bufferTarget, name);
+	switch (streamPath) {
+	case StreamPath::PersistentMapped:
+		memcpy(mapped + offset, data, bytes);
+		break;
+	case StreamPath::MapRange: {
+		void* target = glMapBufferRange(bufferTarget, offset, bytes,
+			GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+		if (target) {
+			memcpy(target, data, bytes);
+			glUnmapBuffer(bufferTarget);
+		}
+		break;
+	}
+	case StreamPath::SubData:
+		glBufferSubData(bufferTarget, offset, bytes, data);
+		break;
+	}
+	head = offset + bytes;
+	totals.bytes += bytes;
+	return offset;
+}
+
+void StreamBuffer::endFrame() {
+	if (head > frameBegin && streamPath != StreamPath::SubData) {
+		Region region;
+		region.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		region.begin = frameBegin;
+		region.end = head;
+		regions.push_back(region);
+	}
+	frameBegin = head;
+}
+
+void StreamBuffer::waitFor(size_t begin, size_t end) {
+	// fences signal in order, so waiting for the newest overlapping region frees every
+	// region before it as well
+	size_t newest = regions.size();
+	for (size_t i = 0; i < regions.size(); i++) {
+		if (regions[i].begin < end && begin < regions[i].end)
+			newest = i;
+	}
+	if (newest == regions.size())
+		return;
+
+	GLsync fence = regions[newest].fence;
+	GLenum status = glClientWaitSync(fence, 0, 0);
+	if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+		totals.waits++;
+		do {
+			status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+		} while (status == GL_TIMEOUT_EXPIRED);
+	}
+	for (size_t i = 0; i <= newest; i++) {
+		glDeleteSync(regions.front().fence);
+		regions.pop_front();
+	}
+}
+
+GLuint StreamBuffer::buffer() const {
+	return name;
+}
+
+GLenum StreamBuffer::target() const {
+	return bufferTarget;
+}
+
+size_t StreamBuffer::capacity() const {
+	return size;
+}
+
+StreamPath StreamBuffer::path() const {
+	return streamPath;
+}
+
+StreamBufferStats StreamBuffer::stats() const {
+	return totals;
+}
@@ -0,0 +1,69 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <deque>
+#include "GLCapabilities.h"
+
+struct StreamBufferStats
+{
+	size_t bytes;		// pushed since creation
+	size_t wraps;
+	size_t waits;		// pushes that had to wait for the GPU to finish with a region
+};
+
+// A ring buffer for data rewritten every frame (per-draw constants, indirect commands,
+// dynamic vertices). push() copies into the next free range and returns its offset; the
+// GPU reads it from there. endFrame() fences what the frame wrote, and a range is only
+// reused once its fence has signalled, so the ring should hold a few frames of data.
+// The path comes from glCapabilities() unless given; SubData needs no fences, as the driver
+// either copies the data or the buffer is orphaned on wrap. Buffers created while a GL trace
+// records map each push instead of persistently, so the trace sees the data.
+class StreamBuffer
+{
+public:
+	// Creates the buffer; needs a current context
+	StreamBuffer(GLenum target, size_t capacity);
+	StreamBuffer(GLenum target, size_t capacity, StreamPath path);
+	// Needs the context still current
+	~StreamBuffer();
+	StreamBuffer(const StreamBuffer&) = delete;
+	StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+	// Copies 'bytes' of 'data' in at an offset aligned to 'alignment' (a power of two) and
+	// returns the offset. Leaves the buffer bound to its target. Returns (size_t)-1 if
+	// 'bytes' is more than the capacity.
+	size_t push(const void* data, size_t bytes, size_t alignment = 16);
+	// Fences everything pushed since the last call
+	void endFrame();
+
+	GLuint buffer() const;
+	GLenum target() const;
+	size_t capacity() const;
+	StreamPath path() const;
+	StreamBufferStats stats() const;
+
+private:
+	// A range the GPU may still be reading, up to its fence
+	struct Region
+	{
+		GLsync fence;
+		size_t begin, end;
+	};
+
+	GLenum bufferTarget;
+	size_t size;
+	StreamPath streamPath;
+	GLuint name;
+	unsigned char* mapped;	// PersistentMapped only
+	size_t head;			// next free byte
+	size_t frameBegin;		// start of what this frame pushed
+	std::deque<Region> regions;
+	StreamBufferStats totals;
+
+	void create();
+	void waitFor(size_t begin, size_t end);
+};
+
+#endif
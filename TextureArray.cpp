@@ -0,0 +1,181 @@
+#include "TextureArray.h"
+#include "TextureUpload.h"
+#include "stb_image.h"
+#include <iostream>
+#include <sstream>
+
+static GLenum internalFormatFor(int channels) {
+	switch (channels) {
+	case 1: return GL_R8;
+	case 2: return GL_RG8;
+	case 3: return GL_RGB8;
+	default: return GL_RGBA8;
+	}
+}
+
+static GLenum externalFormatFor(int channels) {
+	switch (channels) {
+	case 1: return GL_RED;
+	case 2: return GL_RG;
+	case 3: return GL_RGB;
+	default: return GL_RGBA;
+	}
+}
+
+TextureArrayManager::TextureArrayManager(int initialLayers)
+	: initialLayers(initialLayers > 0 ? initialLayers : 1), copyFramebuffer(0) {
+}
+
+TextureArrayManager::~TextureArrayManager() {
+	for (const Group& group : groups)
+		glDeleteTextures(1, &group.texture);
+	if (copyFramebuffer)
+		glDeleteFramebuffers(1, &copyFramebuffer);
+}
+
+TextureLayer TextureArrayManager::add(const unsigned char* data, int width, int height, int channels) {
+	if (data == NULL || width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+		std::cout << "ERROR::TEXTURE_ARRAY::INVALID_IMAGE" << std::endl;
+		return { -1, -1 };
+	}
+
+	int index = -1;
+	for (size_t i = 0; i < groups.size(); i++) {
+		const Group& g = groups[i];
+		if (g.width == width && g.height == height && g.channels == channels) {
+			index = (int)i;
+			break;
+		}
+	}
+	if (index < 0) {
+		Group group = { width, height, channels, 0, 0, 0, false };
+		allocate(group, initialLayers);
+		groups.push_back(group);
+		index = (int)groups.size() - 1;
+	}
+
+	Group& group = groups[index];
+	if (group.layers == group.capacity)
+		allocate(group, group.capacity * 2);
+
+	// rows of 1 or 3 byte texels are not 4-byte aligned for odd widths
+	glBindTexture(GL_TEXTURE_2D_ARRAY, group.texture);
+	setUnpackRowLength(0);
+	setUnpackAlignment(alignmentForRow(width * channels));
+	glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, group.layers, width, height, 1,
+		externalFormatFor(channels), GL_UNSIGNED_BYTE, data);
+	group.dirty = true;
+
+	return { index, group.layers++ };
+}
+
+TextureLayer TextureArrayManager::addFromFile(const char* path) {
+	int width, height, nrChannels;
+	unsigned char* data = loadImageForUpload(path, &width, &height, &nrChannels);
+	if (!data)
+		return { -1, -1 };
+	TextureLayer layer = add(data, width, height, nrChannels);
+	stbi_image_free(data);
+	return layer;
+}
+
+void TextureArrayManager::generateMipmaps() {
+	for (Group& group : groups) {
+		if (!group.dirty)
+			continue;
+		glBindTexture(GL_TEXTURE_2D_ARRAY, group.texture);
+		glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+		group.dirty = false;
+	}
+}
+
+void TextureArrayManager::bind(unsigned int firstUnit) const {
+	for (size_t i = 0; i < groups.size(); i++) {
+		glActiveTexture(GL_TEXTURE0 + firstUnit + (GLenum)i);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, groups[i].texture);
+	}
+}
+
+void TextureArrayManager::setSamplers(const Shader& shader, unsigned int firstUnit) const {
+	for (size_t i = 0; i < groups.size(); i++)
+		shader.setInt("textureArrays[" + std::to_string(i) + "]", (int)(firstUnit + i));
+}
+
+int TextureArrayManager::arrayCount() const {
+	return (int)groups.size();
+}
+
+std::string TextureArrayManager::fragmentSource() const {
+	size_t count = groups.empty() ? 1 : groups.size();
+	std::ostringstream src;
+	src << "#version 330 core\n"
+		<< "in vec3 ourColor;\n"
+		<< "in vec2 texCoord;\n"
+		<< "flat in ivec2 texLayer;\n\n"
+		<< "out vec4 FragColor;\n\n"
+		<< "uniform sampler2DArray textureArrays[" << count << "];\n\n"
+		<< "vec4 sampleLayer(ivec2 l, vec2 uv)\n"
+		<< "{\n"
+		// neighbouring fragments can take different branches, so the implicit derivatives
+		// texture() would need are undefined inside them; take them once up front
+		<< "\tvec2 dx = dFdx(uv);\n"
+		<< "\tvec2 dy = dFdy(uv);\n";
+	for (size_t i = 0; i < count; i++)
+		src << "\tif (l.x == " << i << ") return textureGrad(textureArrays[" << i << "], vec3(uv, float(l.y)), dx, dy);\n";
+	src << "\treturn vec4(1.0, 0.0, 1.0, 1.0);\n"
+		<< "}\n\n"
+		<< "void main()\n"
+		<< "{\n"
+		<< "\tFragColor = sampleLayer(texLayer, texCoord);\n"
+		<< "}\n";
+	return src.str();
+}
+
+void TextureArrayManager::setupLayerAttribute(GLuint location, GLsizei stride, size_t offset, bool perInstance) {
+	glVertexAttribIPointer(location, 2, GL_INT, stride, (void*)offset);
+	glEnableVertexAttribArray(location);
+	glVertexAttribDivisor(location, perInstance ? 1 : 0);
+}
+
+void TextureArrayManager::allocate(Group& group, int capacity) {
+	unsigned int texture;
+	GLenum internalFormat = internalFormatFor(group.channels);
+	GLenum format = externalFormatFor(group.channels);
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	// grey and grey+alpha images sample like they would from a GL_RGB(A) texture
+	if (group.channels == 1) {
+		GLint swizzle[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+		glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+	}
+	else if (group.channels == 2) {
+		GLint swizzle[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+		glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+	}
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internalFormat, group.width, group.height, capacity, 0,
+		format, GL_UNSIGNED_BYTE, NULL);
+
+	// move existing layers over on the GPU instead of keeping CPU copies around
+	if (group.texture != 0) {
+		if (!copyFramebuffer)
+			glGenFramebuffers(1, &copyFramebuffer);
+		GLint previousRead;
+		glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousRead);
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, copyFramebuffer);
+		for (int layer = 0; layer < group.layers; layer++) {
+			glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, group.texture, 0, layer);
+			glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, 0, 0, group.width, group.height);
+		}
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, previousRead);
+		glDeleteTextures(1, &group.texture);
+		group.dirty = true;
+	}
+
+	group.texture = texture;
+	group.capacity = capacity;
+}
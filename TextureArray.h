@@ -0,0 +1,74 @@
+#ifndef TEXTURE_ARRAY_H
+#define TEXTURE_ARRAY_H
+
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "Shader.h"
+
+// Location of an image inside the manager: which array and which layer of it
+struct TextureLayer
+{
+	int array;
+	int layer;
+};
+
+// Groups same-sized, same-format images into GL_TEXTURE_2D_ARRAY layers so a
+// batch of differently textured quads can be drawn with one bind and one draw.
+// Each vertex (or instance) carries an ivec2 (array, layer) that the generated
+// fragment shader uses to pick the sampler and layer.
+class TextureArrayManager
+{
+public:
+	TextureArrayManager(int initialLayers = 8);
+	~TextureArrayManager();
+
+	TextureArrayManager(const TextureArrayManager&) = delete;
+	TextureArrayManager& operator=(const TextureArrayManager&) = delete;
+
+	// Uploads an image (1 to 4 channels, 8 bits each) into the array matching its size and format.
+	// Returns { -1, -1 } on invalid input.
+	TextureLayer add(const unsigned char* data, int width, int height, int channels);
+
+	// Loads an image file with stb_image and adds it
+	TextureLayer addFromFile(const char* path);
+
+	// Regenerates mipmaps for every array that received layers since the last call
+	void generateMipmaps();
+
+	// Binds array i to texture unit firstUnit + i
+	void bind(unsigned int firstUnit) const;
+
+	// Points the generated shader's 'textureArrays[i]' samplers at firstUnit + i
+	void setSamplers(const Shader& shader, unsigned int firstUnit) const;
+
+	int arrayCount() const;
+
+	// Fragment shader sampling the current set of arrays. GLSL 3.30 only allows
+	// constant indices into sampler arrays, so the selection is unrolled per array; it samples
+	// with gradients taken before the branches so mip selection stays defined.
+	std::string fragmentSource() const;
+
+	// Describes an ivec2 (array, layer) vertex attribute on the bound VAO/VBO.
+	// With perInstance set, the attribute advances once per instance instead of per vertex.
+	static void setupLayerAttribute(GLuint location, GLsizei stride, size_t offset, bool perInstance);
+
+private:
+	struct Group
+	{
+		int width, height, channels;
+		unsigned int texture;
+		int layers;
+		int capacity;
+		bool dirty;
+	};
+
+	int initialLayers;
+	std::vector<Group> groups;
+	unsigned int copyFramebuffer;
+
+	void allocate(Group& group, int capacity);
+};
+
+#endif
@@ -0,0 +1,324 @@
+#include "TextureAtlas.h"
+#include "TextureUpload.h"
+#include "stb_image.h"
+#include <iostream>
+#include <algorithm>
+#include <climits>
+
+// ---------------- SkylinePacker ----------------
+
+SkylinePacker::SkylinePacker(int width, int height) {
+	reset(width, height);
+}
+
+void SkylinePacker::reset(int width, int height) {
+	this->width = width;
+	this->height = height;
+	this->usedArea = 0;
+	skyline.clear();
+	freeRects.clear();
+	if (width > 0)
+		skyline.push_back({ 0, 0, width });
+}
+
+bool SkylinePacker::insert(int w, int h, AtlasRect& out) {
+	if (w <= 0 || h <= 0 || w > width || h > height)
+		return false;
+
+	// recycled slots first so evictions don't leave permanent holes
+	if (insertFromFreeList(w, h, out)) {
+		usedArea += (long long)w * h;
+		return true;
+	}
+
+	// bottom-left rule: lowest resulting top edge, ties broken by narrowest level
+	int bestIndex = -1;
+	int bestY = INT_MAX;
+	int bestWidth = INT_MAX;
+	for (size_t i = 0; i < skyline.size(); i++) {
+		int y = fitSkyline(i, w, h);
+		if (y < 0)
+			continue;
+		if (y + h < bestY || (y + h == bestY && skyline[i].width < bestWidth)) {
+			bestIndex = (int)i;
+			bestY = y + h;
+			bestWidth = skyline[i].width;
+		}
+	}
+	if (bestIndex < 0)
+		return false;
+
+	out = { skyline[bestIndex].x, bestY - h, w, h };
+	addSkylineLevel((size_t)bestIndex, out);
+	usedArea += (long long)w * h;
+	return true;
+}
+
+void SkylinePacker::release(const AtlasRect& slot) {
+	usedArea -= (long long)slot.w * slot.h;
+	freeRects.push_back(slot);
+}
+
+float SkylinePacker::occupancy() const {
+	if (width <= 0 || height <= 0)
+		return 0.0f;
+	return (float)usedArea / ((float)width * (float)height);
+}
+
+bool SkylinePacker::insertFromFreeList(int w, int h, AtlasRect& out) {
+	int best = -1;
+	long long bestWaste = LLONG_MAX;
+	for (size_t i = 0; i < freeRects.size(); i++) {
+		const AtlasRect& r = freeRects[i];
+		if (r.w < w || r.h < h)
+			continue;
+		long long waste = (long long)r.w * r.h - (long long)w * h;
+		if (waste < bestWaste) {
+			best = (int)i;
+			bestWaste = waste;
+		}
+	}
+	if (best < 0)
+		return false;
+
+	AtlasRect r = freeRects[best];
+	freeRects.erase(freeRects.begin() + best);
+	out = { r.x, r.y, w, h };
+
+	// guillotine split of the leftover space, cutting along the shorter leftover axis
+	int rightW = r.w - w;
+	int bottomH = r.h - h;
+	if (rightW < bottomH) {
+		if (rightW > 0) freeRects.push_back({ r.x + w, r.y, rightW, h });
+		if (bottomH > 0) freeRects.push_back({ r.x, r.y + h, r.w, bottomH });
+	}
+	else {
+		if (rightW > 0) freeRects.push_back({ r.x + w, r.y, rightW, r.h });
+		if (bottomH > 0) freeRects.push_back({ r.x, r.y + h, w, bottomH });
+	}
+	return true;
+}
+
+int SkylinePacker::fitSkyline(size_t index, int w, int h) const {
+	int x = skyline[index].x;
+	if (x + w > width)
+		return -1;
+
+	int widthLeft = w;
+	int y = skyline[index].y;
+	for (size_t i = index; widthLeft > 0; i++) {
+		y = std::max(y, skyline[i].y);
+		if (y + h > height)
+			return -1;
+		widthLeft -= skyline[i].width;
+	}
+	return y;
+}
+
+void SkylinePacker::addSkylineLevel(size_t index, const AtlasRect& slot) {
+	skyline.insert(skyline.begin() + index, { slot.x, slot.y + slot.h, slot.w });
+
+	// shrink or drop the levels now covered by the new one
+	for (size_t i = index + 1; i < skyline.size(); i++) {
+		const SkylineNode& prev = skyline[i - 1];
+		int overlap = prev.x + prev.width - skyline[i].x;
+		if (overlap <= 0)
+			break;
+		skyline[i].x += overlap;
+		skyline[i].width -= overlap;
+		if (skyline[i].width > 0)
+			break;
+		skyline.erase(skyline.begin() + i);
+		i--;
+	}
+
+	// merge neighbouring levels at the same height
+	for (size_t i = 0; i + 1 < skyline.size(); i++) {
+		if (skyline[i].y == skyline[i + 1].y) {
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(skyline.begin() + i + 1);
+			i--;
+		}
+	}
+}
+
+// ---------------- TextureAtlas ----------------
+
+TextureAtlas::TextureAtlas(int pageSize, int gutter)
+	: pageSize(pageSize), gutter(std::max(1, gutter)), maxMipLevel(0) {
+	// mip level L averages 2^L x 2^L blocks, so it stays inside the gutter while 2^L <= gutter
+	while ((2 << maxMipLevel) <= this->gutter)
+		maxMipLevel++;
+}
+
+TextureAtlas::~TextureAtlas() {
+	for (const Page& page : pages)
+		glDeleteTextures(1, &page.texture);
+}
+
+int TextureAtlas::insert(const unsigned char* data, int width, int height, int channels) {
+	if (data == NULL || width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+		std::cout << "ERROR::ATLAS::INVALID_IMAGE" << std::endl;
+		return -1;
+	}
+
+	// pad by the gutter and round up to the mip alignment so every slot starts on a mip block
+	int align = 1 << maxMipLevel;
+	int slotW = (width + 2 * gutter + align - 1) / align * align;
+	int slotH = (height + 2 * gutter + align - 1) / align * align;
+	if (slotW > pageSize || slotH > pageSize) {
+		std::cout << "ERROR::ATLAS::IMAGE_LARGER_THAN_PAGE (" << width << "x" << height << ")" << std::endl;
+		return -1;
+	}
+
+	AtlasRect slot;
+	int pageIndex = -1;
+	for (size_t i = 0; i < pages.size(); i++) {
+		if (pages[i].packer.insert(slotW, slotH, slot)) {
+			pageIndex = (int)i;
+			break;
+		}
+	}
+	if (pageIndex < 0) {
+		pageIndex = addPage();
+		if (!pages[pageIndex].packer.insert(slotW, slotH, slot))
+			return -1;
+	}
+
+	Page& page = pages[pageIndex];
+	upload(page, slot, data, width, height, channels);
+	page.liveEntries++;
+	page.dirty = true;
+
+	Entry entry;
+	entry.live = true;
+	entry.slot = slot;
+	entry.region.page = pageIndex;
+	entry.region.rect = { slot.x + gutter, slot.y + gutter, width, height };
+	entry.region.u0 = (float)entry.region.rect.x / pageSize;
+	entry.region.v0 = (float)entry.region.rect.y / pageSize;
+	entry.region.u1 = (float)(entry.region.rect.x + width) / pageSize;
+	entry.region.v1 = (float)(entry.region.rect.y + height) / pageSize;
+
+	int handle;
+	if (!freeHandles.empty()) {
+		handle = freeHandles.back();
+		freeHandles.pop_back();
+		entries[handle] = entry;
+	}
+	else {
+		handle = (int)entries.size();
+		entries.push_back(entry);
+	}
+	return handle;
+}
+
+int TextureAtlas::insertFromFile(const char* path) {
+	int width, height, nrChannels;
+	unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 0);
+	if (!data) {
+		std::cout << "Failed to load texture " << path << std::endl;
+		return -1;
+	}
+	int handle = insert(data, width, height, nrChannels);
+	stbi_image_free(data);
+	return handle;
+}
+
+void TextureAtlas::evict(int handle) {
+	if (handle < 0 || handle >= (int)entries.size() || !entries[handle].live)
+		return;
+
+	Entry& entry = entries[handle];
+	Page& page = pages[entry.region.page];
+	entry.live = false;
+	freeHandles.push_back(handle);
+
+	// an empty page goes back to a clean skyline instead of a fragmented free list
+	if (--page.liveEntries == 0)
+		page.packer.reset(pageSize, pageSize);
+	else
+		page.packer.release(entry.slot);
+}
+
+const AtlasRegion& TextureAtlas::region(int handle) const {
+	return entries[handle].region;
+}
+
+void TextureAtlas::remapUVs(int handle, float* uvs, int count, int stride) const {
+	const AtlasRegion& r = entries[handle].region;
+	float du = r.u1 - r.u0;
+	float dv = r.v1 - r.v0;
+	for (int i = 0; i < count; i++) {
+		float* uv = uvs + (size_t)i * stride;
+		uv[0] = r.u0 + uv[0] * du;
+		uv[1] = r.v0 + uv[1] * dv;
+	}
+}
+
+void TextureAtlas::flush() {
+	for (Page& page : pages) {
+		if (!page.dirty)
+			continue;
+		glBindTexture(GL_TEXTURE_2D, page.texture);
+		glGenerateMipmap(GL_TEXTURE_2D);
+		page.dirty = false;
+	}
+}
+
+void TextureAtlas::bind(int page, unsigned int unit) const {
+	glActiveTexture(GL_TEXTURE0 + unit);
+	glBindTexture(GL_TEXTURE_2D, pages[page].texture);
+}
+
+int TextureAtlas::pageCount() const {
+	return (int)pages.size();
+}
+
+unsigned int TextureAtlas::pageTexture(int page) const {
+	return pages[page].texture;
+}
+
+int TextureAtlas::addPage() {
+	Page page;
+	page.packer.reset(pageSize, pageSize);
+	page.liveEntries = 0;
+	page.dirty = false;
+
+	glGenTextures(1, &page.texture);
+	glBindTexture(GL_TEXTURE_2D, page.texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	// deeper levels would average texels from neighbouring entries
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxMipLevel);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, pageSize, pageSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+	pages.push_back(page);
+	return (int)pages.size() - 1;
+}
+
+void TextureAtlas::upload(const Page& page, const AtlasRect& slot, const unsigned char* data, int width, int height, int channels) {
+	// expand to RGBA and fill the whole slot, replicating edge texels into the gutter
+	scratch.resize((size_t)slot.w * slot.h * 4);
+	for (int y = 0; y < slot.h; y++) {
+		int sy = std::min(std::max(y - gutter, 0), height - 1);
+		for (int x = 0; x < slot.w; x++) {
+			int sx = std::min(std::max(x - gutter, 0), width - 1);
+			const unsigned char* src = data + ((size_t)sy * width + sx) * channels;
+			unsigned char* dst = &scratch[((size_t)y * slot.w + x) * 4];
+			switch (channels) {
+			case 1: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 255; break;
+			case 2: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = src[1]; break;
+			case 3: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 255; break;
+			default: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = src[3]; break;
+			}
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D, page.texture);
+	setUnpackRowLength(0);
+	setUnpackAlignment(alignmentForRow(slot.w * 4));
+	glTexSubImage2D(GL_TEXTURE_2D, 0, slot.x, slot.y, slot.w, slot.h, GL_RGBA, GL_UNSIGNED_BYTE, scratch.data());
+}
@@ -0,0 +1,126 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include <glad/glad.h>
+#include <vector>
+#include <cstddef>
+
+// Rectangle in page texel coordinates
+struct AtlasRect
+{
+	int x, y, w, h;
+};
+
+// Where an atlas entry lives: its page, its texel rect (without gutter)
+// and the matching normalized UV rect for sampling
+struct AtlasRegion
+{
+	int page;
+	AtlasRect rect;
+	float u0, v0, u1, v1;
+};
+
+// Skyline bottom-left packer for a single page.
+// Evicted slots are kept in a free list and reused before the skyline grows.
+class SkylinePacker
+{
+public:
+	SkylinePacker(int width = 0, int height = 0);
+
+	// Forget every allocation and start with an empty page
+	void reset(int width, int height);
+
+	// Finds room for a w x h slot. Returns false if the page is full.
+	bool insert(int w, int h, AtlasRect& out);
+
+	// Gives a slot previously returned by insert back to the packer
+	void release(const AtlasRect& slot);
+
+	// Fraction of the page area currently handed out
+	float occupancy() const;
+
+private:
+	struct SkylineNode
+	{
+		int x, y, width;
+	};
+
+	int width, height;
+	long long usedArea;
+	std::vector<SkylineNode> skyline;
+	std::vector<AtlasRect> freeRects;
+
+	bool insertFromFreeList(int w, int h, AtlasRect& out);
+	int fitSkyline(size_t index, int w, int h) const;
+	void addSkylineLevel(size_t index, const AtlasRect& slot);
+};
+
+// Packs decoded stb_image outputs into large RGBA8 pages so that a whole
+// scene can be drawn with a single texture binding per page.
+// Each entry is surrounded by a gutter of replicated edge texels and slots are
+// aligned to the gutter size, so mip levels up to log2(gutter) never blend
+// neighbouring entries together.
+class TextureAtlas
+{
+public:
+	TextureAtlas(int pageSize = 2048, int gutter = 4);
+	~TextureAtlas();
+
+	TextureAtlas(const TextureAtlas&) = delete;
+	TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+	// Copies an image (1 to 4 channels, 8 bits each) into the atlas.
+	// Returns a handle for the entry, or -1 if it cannot fit in a page.
+	int insert(const unsigned char* data, int width, int height, int channels);
+
+	// Loads an image file with stb_image and inserts it
+	int insertFromFile(const char* path);
+
+	// Frees the entry's slot so later inserts can reuse it
+	void evict(int handle);
+
+	// Region of a live entry
+	const AtlasRegion& region(int handle) const;
+
+	// Rewrites 'count' UV pairs given in the entry's own [0,1] space into atlas space.
+	// 'stride' is the distance in floats between consecutive UV pairs.
+	void remapUVs(int handle, float* uvs, int count, int stride = 2) const;
+
+	// Regenerates mipmaps of every page touched since the last flush
+	void flush();
+
+	// Binds a page to the given texture unit
+	void bind(int page, unsigned int unit) const;
+
+	int pageCount() const;
+	unsigned int pageTexture(int page) const;
+
+private:
+	struct Page
+	{
+		unsigned int texture;
+		SkylinePacker packer;
+		int liveEntries;
+		bool dirty;
+	};
+
+	struct Entry
+	{
+		bool live;
+		AtlasRect slot;
+		AtlasRegion region;
+	};
+
+	int pageSize;
+	int gutter;
+	int maxMipLevel;
+	std::vector<Page> pages;
+	std::vector<Entry> entries;
+	std::vector<int> freeHandles;
+	std::vector<unsigned char> scratch;
+
+	int addPage();
+	void upload(const Page& page, const AtlasRect& slot, const unsigned char* data, int width, int height, int channels);
+};
+
+#endif
@@ -0,0 +1,516 @@
+#include "TextureCompressor.h"
+#include "stb_image.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COMPRESSOR_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define COMPRESSOR_NEON
+#endif
+
+int blockSize(BlockFormat format) {
+	return (format == BlockFormat::BC1 || format == BlockFormat::BC4) ? 8 : 16;
+}
+
+GLenum compressedInternalFormat(BlockFormat format) {
+	switch (format) {
+	case BlockFormat::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+	case BlockFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+	case BlockFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+	default: return GL_COMPRESSED_RG_RGTC2;
+	}
+}
+
+bool isCompressedFormatSupported(BlockFormat format) {
+	if (format == BlockFormat::BC4 || format == BlockFormat::BC5)
+		return GLAD_GL_VERSION_3_0 != 0;
+	return GLAD_GL_EXT_texture_compression_s3tc != 0;
+}
+
+// ---------------- block helpers ----------------
+
+// Gathers a 4x4 block as RGBA8, clamping reads at the right and bottom edges
+static void fetchBlock(const unsigned char* data, int width, int height, int channels, int bx, int by, unsigned char* block) {
+	for (int y = 0; y < 4; y++) {
+		int sy = std::min(by * 4 + y, height - 1);
+		for (int x = 0; x < 4; x++) {
+			int sx = std::min(bx * 4 + x, width - 1);
+			const unsigned char* src = data + ((size_t)sy * width + sx) * channels;
+			unsigned char* dst = block + (y * 4 + x) * 4;
+			switch (channels) {
+			case 1: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 255; break;
+			case 2: dst[0] = src[0]; dst[1] = src[1]; dst[2] = 0; dst[3] = 255; break;
+			case 3: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 255; break;
+			default: memcpy(dst, src, 4); break;
+			}
+		}
+	}
+}
+
+// Per-channel min and max over the 16 RGBA texels of a block
+static void blockMinMax(const unsigned char* block, unsigned char* mn, unsigned char* mx) {
+#if defined(COMPRESSOR_SSE2)
+	__m128i a = _mm_loadu_si128((const __m128i*)block);
+	__m128i b = _mm_loadu_si128((const __m128i*)(block + 16));
+	__m128i c = _mm_loadu_si128((const __m128i*)(block + 32));
+	__m128i d = _mm_loadu_si128((const __m128i*)(block + 48));
+	__m128i lo = _mm_min_epu8(_mm_min_epu8(a, b), _mm_min_epu8(c, d));
+	__m128i hi = _mm_max_epu8(_mm_max_epu8(a, b), _mm_max_epu8(c, d));
+	// fold the four texels of each register onto the first one
+	lo = _mm_min_epu8(lo, _mm_srli_si128(lo, 8));
+	hi = _mm_max_epu8(hi, _mm_srli_si128(hi, 8));
+	lo = _mm_min_epu8(lo, _mm_srli_si128(lo, 4));
+	hi = _mm_max_epu8(hi, _mm_srli_si128(hi, 4));
+	int l = _mm_cvtsi128_si32(lo);
+	int h = _mm_cvtsi128_si32(hi);
+	memcpy(mn, &l, 4);
+	memcpy(mx, &h, 4);
+#elif defined(COMPRESSOR_NEON)
+	uint8x16_t a = vld1q_u8(block);
+	uint8x16_t b = vld1q_u8(block + 16);
+	uint8x16_t c = vld1q_u8(block + 32);
+	uint8x16_t d = vld1q_u8(block + 48);
+	uint8x16_t lo = vminq_u8(vminq_u8(a, b), vminq_u8(c, d));
+	uint8x16_t hi = vmaxq_u8(vmaxq_u8(a, b), vmaxq_u8(c, d));
+	uint8x8_t lo8 = vmin_u8(vget_low_u8(lo), vget_high_u8(lo));
+	uint8x8_t hi8 = vmax_u8(vget_low_u8(hi), vget_high_u8(hi));
+	lo8 = vmin_u8(lo8, vext_u8(lo8, lo8, 4));
+	hi8 = vmax_u8(hi8, vext_u8(hi8, hi8, 4));
+	unsigned char l[8], h[8];
+	vst1_u8(l, lo8);
+	vst1_u8(h, hi8);
+	memcpy(mn, l, 4);
+	memcpy(mx, h, 4);
+#else
+	for (int c = 0; c < 4; c++) {
+		mn[c] = 255;
+		mx[c] = 0;
+	}
+	for (int i = 0; i < 16; i++) {
+		for (int c = 0; c < 4; c++) {
+			mn[c] = std::min(mn[c], block[i * 4 + c]);
+			mx[c] = std::max(mx[c], block[i * 4 + c]);
+		}
+	}
+#endif
+}
+
+static unsigned short packRGB565(float r, float g, float b) {
+	int ri = (int)(std::min(std::max(r, 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+	int gi = (int)(std::min(std::max(g, 0.0f), 255.0f) * 63.0f / 255.0f + 0.5f);
+	int bi = (int)(std::min(std::max(b, 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+	return (unsigned short)((ri << 11) | (gi << 5) | bi);
+}
+
+static void unpackRGB565(unsigned short c, int* rgb) {
+	int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+	rgb[0] = (r << 3) | (r >> 2);
+	rgb[1] = (g << 2) | (g >> 4);
+	rgb[2] = (b << 3) | (b >> 2);
+}
+
+static void writeColorBlock(unsigned short c0, unsigned short c1, unsigned int indices, unsigned char* out) {
+	out[0] = (unsigned char)(c0 & 0xFF);
+	out[1] = (unsigned char)(c0 >> 8);
+	out[2] = (unsigned char)(c1 & 0xFF);
+	out[3] = (unsigned char)(c1 >> 8);
+	for (int i = 0; i < 4; i++)
+		out[4 + i] = (unsigned char)(indices >> (8 * i));
+}
+
+// 2-bit index of the closest palette color for each of the 16 texels, four texels per
+// distance computation. Ties go to the lower index, as in the scalar loop.
+static unsigned int colorIndices(const unsigned char* block, const int palette[4][3]) {
+	unsigned int indices = 0;
+#if defined(COMPRESSOR_SSE2)
+	// squared distances stay below 2^24, so float math is exact (SSE2 lacks a 32-bit multiply)
+	const __m128i byteMask = _mm_set1_epi32(0xFF);
+	__m128 pr[4], pg[4], pb[4];
+	for (int p = 0; p < 4; p++) {
+		pr[p] = _mm_set1_ps((float)palette[p][0]);
+		pg[p] = _mm_set1_ps((float)palette[p][1]);
+		pb[p] = _mm_set1_ps((float)palette[p][2]);
+	}
+	for (int group = 0; group < 4; group++) {
+		__m128i texels = _mm_loadu_si128((const __m128i*)(block + group * 16));
+		__m128 r = _mm_cvtepi32_ps(_mm_and_si128(texels, byteMask));
+		__m128 g = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(texels, 8), byteMask));
+		__m128 b = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(texels, 16), byteMask));
+		__m128 bestDist = _mm_set1_ps(1e30f);
+		__m128i best = _mm_setzero_si128();
+		for (int p = 0; p < 4; p++) {
+			__m128 dr = _mm_sub_ps(r, pr[p]);
+			__m128 dg = _mm_sub_ps(g, pg[p]);
+			__m128 db = _mm_sub_ps(b, pb[p]);
+			__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+			__m128i closer = _mm_castps_si128(_mm_cmplt_ps(dist, bestDist));
+			bestDist = _mm_min_ps(dist, bestDist);
+			best = _mm_or_si128(_mm_andnot_si128(closer, best), _mm_and_si128(closer, _mm_set1_epi32(p)));
+		}
+		int lanes[4];
+		_mm_storeu_si128((__m128i*)lanes, best);
+		indices |= (unsigned int)(lanes[0] | (lanes[1] << 2) | (lanes[2] << 4) | (lanes[3] << 6)) << (8 * group);
+	}
+#elif defined(COMPRESSOR_NEON)
+	const uint32x4_t byteMask = vdupq_n_u32(0xFF);
+	for (int group = 0; group < 4; group++) {
+		uint32x4_t texels = vreinterpretq_u32_u8(vld1q_u8(block + group * 16));
+		int32x4_t r = vreinterpretq_s32_u32(vandq_u32(texels, byteMask));
+		int32x4_t g = vreinterpretq_s32_u32(vandq_u32(vshrq_n_u32(texels, 8), byteMask));
+		int32x4_t b = vreinterpretq_s32_u32(vandq_u32(vshrq_n_u32(texels, 16), byteMask));
+		int32x4_t bestDist = vdupq_n_s32(1 << 30);
+		uint32x4_t best = vdupq_n_u32(0);
+		for (int p = 0; p < 4; p++) {
+			int32x4_t dr = vsubq_s32(r, vdupq_n_s32(palette[p][0]));
+			int32x4_t dg = vsubq_s32(g, vdupq_n_s32(palette[p][1]));
+			int32x4_t db = vsubq_s32(b, vdupq_n_s32(palette[p][2]));
+			int32x4_t dist = vmlaq_s32(vmlaq_s32(vmulq_s32(dr, dr), dg, dg), db, db);
+			uint32x4_t closer = vcltq_s32(dist, bestDist);
+			bestDist = vminq_s32(dist, bestDist);
+			best = vbslq_u32(closer, vdupq_n_u32((uint32_t)p), best);
+		}
+		uint32_t lanes[4];
+		vst1q_u32(lanes, best);
+		indices |= (lanes[0] | (lanes[1] << 2) | (lanes[2] << 4) | (lanes[3] << 6)) << (8 * group);
+	}
+#else
+	for (int i = 0; i < 16; i++) {
+		int best = 0, bestDist = 1 << 30;
+		for (int p = 0; p < 4; p++) {
+			int dr = block[i * 4] - palette[p][0];
+			int dg = block[i * 4 + 1] - palette[p][1];
+			int db = block[i * 4 + 2] - palette[p][2];
+			int dist = dr * dr + dg * dg + db * db;
+			if (dist < bestDist) {
+				bestDist = dist;
+				best = p;
+			}
+		}
+		indices |= (unsigned int)best << (2 * i);
+	}
+#endif
+	return indices;
+}
+
+// BC1 color block, always in 4-color mode so it is also valid inside BC3
+static void encodeColorBlock(const unsigned char* block, unsigned char* out) {
+	unsigned char mn[4], mx[4];
+	blockMinMax(block, mn, mx);
+	if (mn[0] == mx[0] && mn[1] == mx[1] && mn[2] == mx[2]) {
+		unsigned short c = packRGB565(mn[0], mn[1], mn[2]);
+		writeColorBlock(c, c, 0, out);
+		return;
+	}
+
+	// principal axis of the block colors via a few power iterations on the covariance
+	float mean[3] = { 0, 0, 0 };
+	for (int i = 0; i < 16; i++)
+		for (int c = 0; c < 3; c++)
+			mean[c] += block[i * 4 + c];
+	for (int c = 0; c < 3; c++)
+		mean[c] /= 16.0f;
+
+	float cov[6] = { 0, 0, 0, 0, 0, 0 };
+	for (int i = 0; i < 16; i++) {
+		float r = block[i * 4] - mean[0], g = block[i * 4 + 1] - mean[1], b = block[i * 4 + 2] - mean[2];
+		cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+		cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+	}
+
+	float axis[3] = { (float)(mx[0] - mn[0]), (float)(mx[1] - mn[1]), (float)(mx[2] - mn[2]) };
+	for (int iter = 0; iter < 4; iter++) {
+		float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+		float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+		float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+		float len = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+		if (len < 1e-6f)
+			break;
+		axis[0] = x / len; axis[1] = y / len; axis[2] = z / len;
+	}
+
+	// extreme texels along the axis become the endpoints
+	int lo = 0, hi = 0;
+	float minProj = 1e30f, maxProj = -1e30f;
+	for (int i = 0; i < 16; i++) {
+		float p = block[i * 4] * axis[0] + block[i * 4 + 1] * axis[1] + block[i * 4 + 2] * axis[2];
+		if (p < minProj) { minProj = p; lo = i; }
+		if (p > maxProj) { maxProj = p; hi = i; }
+	}
+
+	// inset the endpoints slightly to reduce the error of the interpolated colors
+	float e0[3], e1[3];
+	for (int c = 0; c < 3; c++) {
+		float a = block[hi * 4 + c], b = block[lo * 4 + c];
+		float inset = (a - b) / 16.0f;
+		e0[c] = a - inset;
+		e1[c] = b + inset;
+	}
+
+	unsigned short c0 = packRGB565(e0[0], e0[1], e0[2]);
+	unsigned short c1 = packRGB565(e1[0], e1[1], e1[2]);
+	if (c0 < c1)
+		std::swap(c0, c1);
+	if (c0 == c1) {
+		writeColorBlock(c0, c1, 0, out);
+		return;
+	}
+
+	int palette[4][3];
+	unpackRGB565(c0, palette[0]);
+	unpackRGB565(c1, palette[1]);
+	for (int c = 0; c < 3; c++) {
+		palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+		palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+	}
+
+	writeColorBlock(c0, c1, colorIndices(block, palette), out);
+}
+
+// BC4 block from one channel of the RGBA block (also the alpha half of BC3 and each half of BC5)
+static void encodeChannelBlock(const unsigned char* block, int channel, unsigned char mn, unsigned char mx, unsigned char* out) {
+	out[0] = mx;
+	out[1] = mn;
+	unsigned long long indices = 0;
+	if (mx != mn) {
+		int range = mx - mn;
+		for (int i = 0; i < 16; i++) {
+			// level 0..7 from min to max, mapped to the 8-value code order (0 = max, 1 = min, 2..7 descending)
+			int level = ((block[i * 4 + channel] - mn) * 7 + range / 2) / range;
+			int code = level == 7 ? 0 : (level == 0 ? 1 : 8 - level);
+			indices |= (unsigned long long)code << (3 * i);
+		}
+	}
+	for (int i = 0; i < 6; i++)
+		out[2 + i] = (unsigned char)(indices >> (8 * i));
+}
+
+static void encodeBlock(const unsigned char* block, BlockFormat format, unsigned char* out) {
+	unsigned char mn[4], mx[4];
+	switch (format) {
+	case BlockFormat::BC1:
+		encodeColorBlock(block, out);
+		break;
+	case BlockFormat::BC3:
+		blockMinMax(block, mn, mx);
+		encodeChannelBlock(block, 3, mn[3], mx[3], out);
+		encodeColorBlock(block, out + 8);
+		break;
+	case BlockFormat::BC4:
+		blockMinMax(block, mn, mx);
+		encodeChannelBlock(block, 0, mn[0], mx[0], out);
+		break;
+	case BlockFormat::BC5:
+		blockMinMax(block, mn, mx);
+		encodeChannelBlock(block, 0, mn[0], mx[0], out);
+		encodeChannelBlock(block, 1, mn[1], mx[1], out + 8);
+		break;
+	}
+}
+
+CompressedImage compressImage(const unsigned char* data, int width, int height, int channels,
+	BlockFormat format, int threads) {
+	CompressedImage image;
+	image.format = format;
+	image.width = width;
+	image.height = height;
+	if (data == NULL || width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+		std::cout << "ERROR::COMPRESSOR::INVALID_IMAGE" << std::endl;
+		return image;
+	}
+
+	int blocksX = (width + 3) / 4;
+	int blocksY = (height + 3) / 4;
+	int bytes = blockSize(format);
+	image.data.resize((size_t)blocksX * blocksY * bytes);
+
+	auto encodeRows = [&](int firstRow, int lastRow) {
+		unsigned char block[64];
+		for (int by = firstRow; by < lastRow; by++) {
+			unsigned char* out = &image.data[(size_t)by * blocksX * bytes];
+			for (int bx = 0; bx < blocksX; bx++) {
+				fetchBlock(data, width, height, channels, bx, by, block);
+				encodeBlock(block, format, out + (size_t)bx * bytes);
+			}
+		}
+	};
+
+	if (threads <= 0)
+		threads = (int)std::max(1u, std::thread::hardware_concurrency());
+	threads = std::min(threads, blocksY);
+
+	std::vector<std::thread> workers;
+	int rowsPerThread = (blocksY + threads - 1) / threads;
+	for (int t = 1; t < threads; t++) {
+		int first = t * rowsPerThread;
+		int last = std::min(blocksY, first + rowsPerThread);
+		if (first < last)
+			workers.emplace_back(encodeRows, first, last);
+	}
+	encodeRows(0, std::min(blocksY, rowsPerThread));
+	for (std::thread& worker : workers)
+		worker.join();
+
+	return image;
+}
+
+// ---------------- decoding ----------------
+
+static void decodeColorBlock(const unsigned char* in, bool allowThreeColor, unsigned char* block) {
+	unsigned short c0 = (unsigned short)(in[0] | (in[1] << 8));
+	unsigned short c1 = (unsigned short)(in[2] | (in[3] << 8));
+	unsigned int indices = in[4] | (in[5] << 8) | (in[6] << 16) | ((unsigned int)in[7] << 24);
+
+	int palette[4][4];
+	unpackRGB565(c0, palette[0]);
+	unpackRGB565(c1, palette[1]);
+	palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+	for (int c = 0; c < 3; c++) {
+		if (c0 > c1 || !allowThreeColor) {
+			palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+			palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+		}
+		else {
+			palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+			palette[3][c] = 0;
+		}
+	}
+	if (c0 <= c1 && allowThreeColor)
+		palette[3][3] = 0;
+
+	for (int i = 0; i < 16; i++) {
+		const int* p = palette[(indices >> (2 * i)) & 3];
+		for (int c = 0; c < 4; c++)
+			block[i * 4 + c] = (unsigned char)p[c];
+	}
+}
+
+static void decodeChannelBlock(const unsigned char* in, int channel, unsigned char* block) {
+	int a0 = in[0], a1 = in[1];
+	int values[8] = { a0, a1 };
+	if (a0 > a1) {
+		for (int k = 2; k < 8; k++)
+			values[k] = ((8 - k) * a0 + (k - 1) * a1) / 7;
+	}
+	else {
+		for (int k = 2; k < 6; k++)
+			values[k] = ((6 - k) * a0 + (k - 1) * a1) / 5;
+		values[6] = 0;
+		values[7] = 255;
+	}
+
+	unsigned long long indices = 0;
+	for (int i = 0; i < 6; i++)
+		indices |= (unsigned long long)in[2 + i] << (8 * i);
+	for (int i = 0; i < 16; i++)
+		block[i * 4 + channel] = (unsigned char)values[(indices >> (3 * i)) & 7];
+}
+
+void decompressImage(const CompressedImage& image, std::vector<unsigned char>& rgba) {
+	int blocksX = (image.width + 3) / 4;
+	int blocksY = (image.height + 3) / 4;
+	int bytes = blockSize(image.format);
+	rgba.assign((size_t)image.width * image.height * 4, 0);
+
+	unsigned char block[64];
+	for (int by = 0; by < blocksY; by++) {
+		for (int bx = 0; bx < blocksX; bx++) {
+			const unsigned char* in = &image.data[((size_t)by * blocksX + bx) * bytes];
+			switch (image.format) {
+			case BlockFormat::BC1:
+				decodeColorBlock(in, true, block);
+				break;
+			case BlockFormat::BC3:
+				decodeColorBlock(in + 8, false, block);
+				decodeChannelBlock(in, 3, block);
+				break;
+			case BlockFormat::BC4:
+				for (int i = 0; i < 16; i++) {
+					block[i * 4 + 1] = block[i * 4 + 2] = 0;
+					block[i * 4 + 3] = 255;
+				}
+				decodeChannelBlock(in, 0, block);
+				break;
+			case BlockFormat::BC5:
+				for (int i = 0; i < 16; i++) {
+					block[i * 4 + 2] = 0;
+					block[i * 4 + 3] = 255;
+				}
+				decodeChannelBlock(in, 0, block);
+				decodeChannelBlock(in + 8, 1, block);
+				break;
+			}
+
+			for (int y = 0; y < 4 && by * 4 + y < image.height; y++)
+				for (int x = 0; x < 4 && bx * 4 + x < image.width; x++)
+					memcpy(&rgba[((size_t)(by * 4 + y) * image.width + bx * 4 + x) * 4], block + (y * 4 + x) * 4, 4);
+		}
+	}
+}
+
+void uploadCompressed(const CompressedImage& image, GLint level) {
+	glCompressedTexImage2D(GL_TEXTURE_2D, level, compressedInternalFormat(image.format),
+		image.width, image.height, 0, (GLsizei)image.data.size(), image.data.data());
+}
+
+// ---------------- benchmark ----------------
+
+void runCompressionBenchmark(const char* path) {
+	int width, height, nrChannels;
+	unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 4);
+	if (!data) {
+		std::cout << "Failed to load texture " << path << std::endl;
+		return;
+	}
+
+	struct Case { BlockFormat format; const char* name; int channels; };
+	const Case cases[] = {
+		{ BlockFormat::BC1, "BC1", 3 },
+		{ BlockFormat::BC3, "BC3", 4 },
+		{ BlockFormat::BC4, "BC4", 1 },
+		{ BlockFormat::BC5, "BC5", 2 },
+	};
+	const int threadCounts[] = { 1, 0 };
+	double megabytes = (double)width * height * 4 / (1024.0 * 1024.0);
+
+	std::cout << path << " (" << width << "x" << height << ")\n";
+	std::cout << "format  threads   MB/s     PSNR(dB)  ratio\n";
+	for (const Case& c : cases) {
+		for (int threads : threadCounts) {
+			CompressedImage image;
+			double best = 1e30;
+			for (int run = 0; run < 5; run++) {
+				auto start = std::chrono::high_resolution_clock::now();
+				image = compressImage(data, width, height, 4, c.format, threads);
+				std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+				best = std::min(best, elapsed.count());
+			}
+
+			std::vector<unsigned char> decoded;
+			decompressImage(image, decoded);
+			double squaredError = 0.0;
+			for (size_t i = 0; i < (size_t)width * height; i++) {
+				for (int ch = 0; ch < c.channels; ch++) {
+					double d = (double)data[i * 4 + ch] - decoded[i * 4 + ch];
+					squaredError += d * d;
+				}
+			}
+			double mse = squaredError / ((double)width * height * c.channels);
+			double psnr = mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+
+			std::cout << std::left << std::setw(8) << c.name
+				<< std::setw(10) << (threads == 0 ? "all" : "1")
+				<< std::setw(9) << std::fixed << std::setprecision(1) << megabytes / best
+				<< std::setw(10) << std::setprecision(2) << psnr
+				<< std::setprecision(1) << (double)width * height * 4 / image.data.size() << ":1\n";
+		}
+	}
+	stbi_image_free(data);
+}
@@ -0,0 +1,49 @@
+#ifndef TEXTURE_COMPRESSOR_H
+#define TEXTURE_COMPRESSOR_H
+
+#include <glad/glad.h>
+#include <vector>
+
+// 4x4 block formats.
+// BC1: RGB, 8 bytes/block     BC3: RGBA, 16 bytes/block
+// BC4: R (RGTC1), 8 bytes     BC5: RG (RGTC2, normal maps), 16 bytes
+enum class BlockFormat
+{
+	BC1,
+	BC3,
+	BC4,
+	BC5
+};
+
+struct CompressedImage
+{
+	BlockFormat format;
+	int width, height;
+	std::vector<unsigned char> data;
+};
+
+// Bytes per 4x4 block for a format
+int blockSize(BlockFormat format);
+
+// Internal format to pass to glCompressedTexImage2D
+GLenum compressedInternalFormat(BlockFormat format);
+
+// True if the current context can sample the format (RGTC is core, S3TC is an extension)
+bool isCompressedFormatSupported(BlockFormat format);
+
+// Compresses an 8-bit image with 1 to 4 channels (as returned by stb_image).
+// Missing channels read as 0 (alpha as 255) and grey images are replicated into RGB.
+// Block rows are split over 'threads' workers; 0 picks one per hardware thread.
+CompressedImage compressImage(const unsigned char* data, int width, int height, int channels,
+	BlockFormat format, int threads = 0);
+
+// Decodes back to tightly packed RGBA8, used for quality measurements
+void decompressImage(const CompressedImage& image, std::vector<unsigned char>& rgba);
+
+// Uploads one level to the texture bound to GL_TEXTURE_2D
+void uploadCompressed(const CompressedImage& image, GLint level = 0);
+
+// Compresses an image file in every format and reports PSNR and throughput
+void runCompressionBenchmark(const char* path);
+
+#endif
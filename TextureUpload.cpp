@@ -0,0 +1,132 @@
+#include "TextureUpload.h"
+#include "stb_image.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+
+// GL defaults
+static int currentAlignment = 4;
+static int currentRowLength = 0;
+
+UploadFormat chooseUploadFormat(int channels) {
+	switch (channels) {
+	case 1: return { GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1, { GL_RED, GL_RED, GL_RED, GL_ONE } };
+	case 2: return { GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2, { GL_RED, GL_RED, GL_RED, GL_GREEN } };
+	case 3: return { GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 3, { GL_RED, GL_GREEN, GL_BLUE, GL_ONE } };
+	default: return { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4, { GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA } };
+	}
+}
+
+unsigned char* loadImageForUpload(const char* path, int* width, int* height, int* channels) {
+	int fileChannels = 0;
+	if (!stbi_info(path, width, height, &fileChannels)) {
+		std::cout << "Failed to load texture " << path << std::endl;
+		return NULL;
+	}
+
+	int requested = fileChannels == 3 ? 4 : fileChannels;
+	unsigned char* data = stbi_load(path, width, height, &fileChannels, requested);
+	if (!data) {
+		std::cout << "Failed to load texture " << path << std::endl;
+		return NULL;
+	}
+	*channels = requested;
+	return data;
+}
+
+int alignmentForRow(int rowBytes) {
+	if (rowBytes % 8 == 0) return 8;
+	if (rowBytes % 4 == 0) return 4;
+	if (rowBytes % 2 == 0) return 2;
+	return 1;
+}
+
+void setUnpackAlignment(int alignment) {
+	if (alignment == currentAlignment)
+		return;
+	glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+	currentAlignment = alignment;
+}
+
+void setUnpackRowLength(int rowLength) {
+	if (rowLength == currentRowLength)
+		return;
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+	currentRowLength = rowLength;
+}
+
+void applyChannelSwizzle(GLuint texture, int channels) {
+	if (channels >= 3)
+		return;
+	// one component at a time, the DSA entry points glad loads only include glTextureParameteri
+	const GLenum names[] = { GL_TEXTURE_SWIZZLE_R, GL_TEXTURE_SWIZZLE_G, GL_TEXTURE_SWIZZLE_B, GL_TEXTURE_SWIZZLE_A };
+	UploadFormat fmt = chooseUploadFormat(channels);
+	for (int i = 0; i < 4; i++) {
+		if (texture != 0)
+			glTextureParameteri(texture, names[i], fmt.swizzle[i]);
+		else
+			glTexParameteri(GL_TEXTURE_2D, names[i], fmt.swizzle[i]);
+	}
+}
+
+void uploadTextureSubLevel(GLuint texture, GLint level, int width, int height, int channels, const unsigned char* data) {
+	UploadFormat fmt = chooseUploadFormat(channels);
+	setUnpackRowLength(0);
+	setUnpackAlignment(alignmentForRow(width * fmt.bytesPerTexel));
+	if (texture != 0)
+		glTextureSubImage2D(texture, level, 0, 0, width, height, fmt.format, fmt.type, data);
+	else
+		glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, fmt.format, fmt.type, data);
+}
+
+void runUploadBenchmark() {
+	struct Case
+	{
+		const char* name;
+		int width;
+		GLint internalFormat;
+		GLenum format;
+		GLenum type;
+		int bytesPerTexel;
+	};
+	const Case cases[] = {
+		{ "RGB8  <- RGB, odd width", 1023, GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 3 },
+		{ "RGB8  <- RGB", 1024, GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 3 },
+		{ "RGBA8 <- RGBA", 1024, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4 },
+		{ "RGBA8 <- BGRA 8888_REV", 1024, GL_RGBA8, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, 4 },
+		{ "R8    <- RED", 1024, GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1 },
+	};
+	const int height = 1024;
+	const int iterations = 50;
+
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << std::left << std::setw(26) << "format" << "align  MB/s\n";
+
+	GLuint texture;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	for (const Case& c : cases) {
+		int rowBytes = c.width * c.bytesPerTexel;
+		std::vector<unsigned char> pixels((size_t)rowBytes * height, 0x7F);
+
+		setUnpackRowLength(0);
+		setUnpackAlignment(alignmentForRow(rowBytes));
+		glTexImage2D(GL_TEXTURE_2D, 0, c.internalFormat, c.width, height, 0, c.format, c.type, NULL);
+
+		// one warm-up upload so allocation isn't timed
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, c.width, height, c.format, c.type, pixels.data());
+		glFinish();
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++)
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, c.width, height, c.format, c.type, pixels.data());
+		glFinish();
+		std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+		double megabytes = (double)pixels.size() * iterations / (1024.0 * 1024.0);
+		std::cout << std::left << std::setw(26) << c.name << std::setw(7) << alignmentForRow(rowBytes)
+			<< std::fixed << std::setprecision(1) << megabytes / elapsed.count() << "\n";
+	}
+	glDeleteTextures(1, &texture);
+}
@@ -0,0 +1,48 @@
+#ifndef TEXTURE_UPLOAD_H
+#define TEXTURE_UPLOAD_H
+
+#include <glad/glad.h>
+
+// Internal/external format pair used to upload 8-bit images
+struct UploadFormat
+{
+	GLint internalFormat;
+	GLenum format;
+	GLenum type;
+	int bytesPerTexel;
+	GLint swizzle[4];	// GL_TEXTURE_SWIZZLE_RGBA that samples the data like an RGB(A) image
+};
+
+// Best format pair for tightly packed 8-bit data with the given channel count.
+// 3-channel data has no fast path on most drivers (texels get repacked to 4 bytes),
+// so RGB images should be expanded when decoding; see loadImageForUpload.
+// Grey and grey+alpha data stay GL_R8/GL_RG8 and rely on the swizzle instead.
+UploadFormat chooseUploadFormat(int channels);
+
+// Decodes an image with stb_image, expanding RGB to RGBA in the decoder so the
+// upload never hits the driver's 3-byte repack path.
+// 'channels' receives the channel count of the returned data. Free with stbi_image_free.
+unsigned char* loadImageForUpload(const char* path, int* width, int* height, int* channels);
+
+// Largest GL_UNPACK_ALIGNMENT (8, 4, 2 or 1) that rows of 'rowBytes' bytes satisfy
+int alignmentForRow(int rowBytes);
+
+// GL_UNPACK_ALIGNMENT / GL_UNPACK_ROW_LENGTH, only touching GL when the value changes.
+// All unpack state changes should go through these so the cached values stay valid.
+void setUnpackAlignment(int alignment);
+void setUnpackRowLength(int rowLength);
+
+// Sets the swizzle of chooseUploadFormat(channels) on a texture: through glTextureParameteri
+// when 'texture' is given (direct state access), otherwise on the texture bound to GL_TEXTURE_2D.
+// Does nothing for 3 and 4 channels.
+void applyChannelSwizzle(GLuint texture, int channels);
+
+// Replaces one whole level of an allocated texture with tightly packed 8-bit data: through
+// glTextureSubImage2D when 'texture' is given (direct state access), otherwise to the
+// texture bound to GL_TEXTURE_2D
+void uploadTextureSubLevel(GLuint texture, GLint level, int width, int height, int channels, const unsigned char* data);
+
+// Upload throughput of the different format pairs (needs a current context)
+void runUploadBenchmark();
+
+#endif
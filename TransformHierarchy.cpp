@@ -0,0 +1,315 @@
+#include "TransformHierarchy.h"
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+
+// levels smaller than this per worker aren't worth a thread
+static const size_t minNodesPerThread = 4096;
+
+TransformHierarchy::TransformHierarchy()
+	: needsSort(false), allChanged(false), changedFirst(0), changedLast(0), updatedCount(0), uploadedCount(0) {
+	levelStart.push_back(0);
+}
+
+int TransformHierarchy::createNode(int parent) {
+	int parentIndex = parent >= 0 ? handleToIndex[parent] : -1;
+	int depth = parentIndex >= 0 ? depths[parentIndex] + 1 : 0;
+
+	int handle;
+	if (!freeHandles.empty()) {
+		handle = freeHandles.back();
+		freeHandles.pop_back();
+	}
+	else {
+		handle = (int)handleToIndex.size();
+		handleToIndex.push_back(-1);
+	}
+
+	// appending keeps the depth order only if nothing deeper exists yet
+	if (!depths.empty() && depth < depths.back())
+		needsSort = true;
+	else {
+		levelStart.resize(std::max(levelStart.size(), (size_t)depth + 2), levelStart.back());
+		levelStart.back() = parents.size() + 1;
+	}
+
+	handleToIndex[handle] = (int)parents.size();
+	parents.push_back(parentIndex);
+	depths.push_back(depth);
+	positions.push_back(vec3(0.0f));
+	rotations.push_back(quat::identity());
+	scales.push_back(vec3(1.0f));
+	worlds.push_back(mat4::identity());
+	localDirty.push_back(1);
+	worldChanged.push_back(0);
+	handles.push_back(handle);
+	return handle;
+}
+
+void TransformHierarchy::destroyNode(int handle) {
+	if (needsSort)
+		sortByDepth();
+
+	// parents precede children, so one forward pass marks the whole subtree
+	std::vector<unsigned char> removed(parents.size(), 0);
+	int root = handleToIndex[handle];
+	removed[root] = 1;
+	for (size_t i = root + 1; i < parents.size(); i++)
+		removed[i] = parents[i] >= 0 && removed[parents[i]];
+
+	std::vector<int> oldToNew(parents.size(), -1);
+	size_t kept = 0;
+	for (size_t i = 0; i < parents.size(); i++) {
+		if (removed[i]) {
+			handleToIndex[handles[i]] = -1;
+			freeHandles.push_back(handles[i]);
+			continue;
+		}
+		oldToNew[i] = (int)kept;
+		parents[kept] = parents[i] >= 0 ? oldToNew[parents[i]] : -1;
+		depths[kept] = depths[i];
+		positions[kept] = positions[i];
+		rotations[kept] = rotations[i];
+		scales[kept] = scales[i];
+		worlds[kept] = worlds[i];
+		localDirty[kept] = localDirty[i];
+		worldChanged[kept] = worldChanged[i];
+		handles[kept] = handles[i];
+		handleToIndex[handles[i]] = (int)kept;
+		kept++;
+	}
+
+	parents.resize(kept);
+	depths.resize(kept);
+	positions.resize(kept);
+	rotations.resize(kept);
+	scales.resize(kept);
+	worlds.resize(kept);
+	localDirty.resize(kept);
+	worldChanged.resize(kept);
+	handles.resize(kept);
+
+	// compaction keeps the depth order but the level boundaries and positions moved
+	needsSort = true;
+	allChanged = true;
+}
+
+bool TransformHierarchy::setParent(int handle, int parent) {
+	int index = handleToIndex[handle];
+	int parentIndex = parent >= 0 ? handleToIndex[parent] : -1;
+	for (int p = parentIndex; p >= 0; p = parents[p]) {
+		if (p == index)
+			return false;
+	}
+
+	parents[index] = parentIndex;
+	localDirty[index] = 1;
+	recomputeDepths();
+	needsSort = true;
+	return true;
+}
+
+void TransformHierarchy::setLocal(int handle, const vec3& position, const quat& rotation, const vec3& scale) {
+	int index = handleToIndex[handle];
+	positions[index] = position;
+	rotations[index] = rotation;
+	scales[index] = scale;
+	localDirty[index] = 1;
+}
+
+void TransformHierarchy::setPosition(int handle, const vec3& position) {
+	int index = handleToIndex[handle];
+	positions[index] = position;
+	localDirty[index] = 1;
+}
+
+void TransformHierarchy::setRotation(int handle, const quat& rotation) {
+	int index = handleToIndex[handle];
+	rotations[index] = rotation;
+	localDirty[index] = 1;
+}
+
+void TransformHierarchy::setScale(int handle, const vec3& scale) {
+	int index = handleToIndex[handle];
+	scales[index] = scale;
+	localDirty[index] = 1;
+}
+
+void TransformHierarchy::update(int threads) {
+	if (needsSort)
+		sortByDepth();
+
+	size_t updated = 0;
+	size_t minChanged = parents.size();
+	size_t maxChanged = 0;
+
+	// a level only reads worlds of the previous level, so its nodes are independent
+	for (size_t level = 0; level + 1 < levelStart.size(); level++) {
+		size_t first = levelStart[level];
+		size_t last = levelStart[level + 1];
+		size_t workers = std::min((size_t)std::max(threads, 1), (last - first) / minNodesPerThread);
+		if (workers <= 1) {
+			updateRange(first, last, updated, minChanged, maxChanged);
+			continue;
+		}
+
+		std::vector<size_t> counts(workers, 0), mins(workers, parents.size()), maxs(workers, 0);
+		std::vector<std::thread> pool;
+		size_t chunk = (last - first + workers - 1) / workers;
+		for (size_t w = 1; w < workers; w++) {
+			size_t begin = first + w * chunk;
+			size_t end = std::min(last, begin + chunk);
+			pool.emplace_back([this, begin, end, w, &counts, &mins, &maxs] {
+				updateRange(begin, end, counts[w], mins[w], maxs[w]);
+			});
+		}
+		updateRange(first, std::min(last, first + chunk), counts[0], mins[0], maxs[0]);
+		for (std::thread& t : pool)
+			t.join();
+		for (size_t w = 0; w < workers; w++) {
+			updated += counts[w];
+			minChanged = std::min(minChanged, mins[w]);
+			maxChanged = std::max(maxChanged, maxs[w]);
+		}
+	}
+
+	updatedCount = updated;
+	if (allChanged) {
+		changedFirst = 0;
+		changedLast = parents.size();
+		allChanged = false;
+	}
+	else if (updated > 0) {
+		changedFirst = minChanged;
+		changedLast = maxChanged + 1;
+	}
+	else {
+		changedFirst = changedLast = 0;
+	}
+}
+
+const mat4& TransformHierarchy::world(int handle) const {
+	return worlds[handleToIndex[handle]];
+}
+
+const mat4* TransformHierarchy::instanceData() const {
+	return worlds.data();
+}
+
+size_t TransformHierarchy::nodeCount() const {
+	return parents.size();
+}
+
+int TransformHierarchy::instanceIndex(int handle) const {
+	return handleToIndex[handle];
+}
+
+void TransformHierarchy::changedRange(size_t& first, size_t& last) const {
+	first = changedFirst;
+	last = changedLast;
+}
+
+size_t TransformHierarchy::lastUpdateCount() const {
+	return updatedCount;
+}
+
+void TransformHierarchy::uploadInstances(GLuint buffer) {
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	if (uploadedCount != worlds.size()) {
+		glBufferData(GL_ARRAY_BUFFER, worlds.size() * sizeof(mat4), worlds.data(), GL_DYNAMIC_DRAW);
+		uploadedCount = worlds.size();
+	}
+	else if (changedLast > changedFirst) {
+		glBufferSubData(GL_ARRAY_BUFFER, changedFirst * sizeof(mat4), (changedLast - changedFirst) * sizeof(mat4),
+			&worlds[changedFirst]);
+	}
+}
+
+void TransformHierarchy::setupInstanceAttribute(GLuint location) {
+	for (GLuint i = 0; i < 4; i++) {
+		glVertexAttribPointer(location + i, 4, GL_FLOAT, GL_FALSE, sizeof(mat4), (void*)(i * sizeof(vec4)));
+		glEnableVertexAttribArray(location + i);
+		glVertexAttribDivisor(location + i, 1);
+	}
+}
+
+void TransformHierarchy::sortByDepth() {
+	size_t count = parents.size();
+	if (!std::is_sorted(depths.begin(), depths.end())) {
+		std::vector<int> order(count);
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [this](int a, int b) { return depths[a] < depths[b]; });
+
+		std::vector<int> oldToNew(count);
+		for (size_t i = 0; i < count; i++)
+			oldToNew[order[i]] = (int)i;
+
+		auto permute = [&order](auto& values) {
+			typename std::decay<decltype(values)>::type sorted;
+			sorted.reserve(values.size());
+			for (int index : order)
+				sorted.push_back(values[index]);
+			values.swap(sorted);
+		};
+		permute(parents);
+		permute(depths);
+		permute(positions);
+		permute(rotations);
+		permute(scales);
+		permute(worlds);
+		permute(localDirty);
+		permute(worldChanged);
+		permute(handles);
+
+		for (size_t i = 0; i < count; i++) {
+			if (parents[i] >= 0)
+				parents[i] = oldToNew[parents[i]];
+			handleToIndex[handles[i]] = (int)i;
+		}
+		allChanged = true;
+	}
+
+	levelStart.assign(1, 0);
+	for (size_t i = 0; i < count; i++) {
+		while ((int)levelStart.size() <= depths[i])
+			levelStart.push_back(i);
+	}
+	levelStart.push_back(count);
+	needsSort = false;
+}
+
+void TransformHierarchy::recomputeDepths() {
+	// a node's depth is final once its parent's is; repeat until every node resolved
+	std::vector<unsigned char> resolved(parents.size(), 0);
+	size_t remaining = parents.size();
+	while (remaining > 0) {
+		for (size_t i = 0; i < parents.size(); i++) {
+			if (resolved[i])
+				continue;
+			int p = parents[i];
+			if (p < 0 || resolved[p]) {
+				depths[i] = p < 0 ? 0 : depths[p] + 1;
+				resolved[i] = 1;
+				remaining--;
+			}
+		}
+	}
+}
+
+void TransformHierarchy::updateRange(size_t first, size_t last, size_t& updated, size_t& minChanged, size_t& maxChanged) {
+	for (size_t i = first; i < last; i++) {
+		int p = parents[i];
+		bool dirty = localDirty[i] || (p >= 0 && worldChanged[p]);
+		worldChanged[i] = dirty;
+		if (!dirty)
+			continue;
+
+		mat4 local = composeTRS(positions[i], rotations[i], scales[i]);
+		worlds[i] = p >= 0 ? worlds[p] * local : local;
+		localDirty[i] = 0;
+		updated++;
+		minChanged = std::min(minChanged, i);
+		maxChanged = std::max(maxChanged, i);
+	}
+}
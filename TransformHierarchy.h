@@ -0,0 +1,92 @@
+#ifndef TRANSFORM_HIERARCHY_H
+#define TRANSFORM_HIERARCHY_H
+
+#include <glad/glad.h>
+#include <vector>
+#include <cstddef>
+#include "VecMath.h"
+
+// Parent/child transforms stored as flat arrays sorted by hierarchy depth.
+// Parents always come before their children, so world matrices are computed in
+// one forward pass, level by level, touching only nodes whose local transform or
+// ancestor changed. The world matrices double as a packed per-instance buffer.
+//
+// Nodes are referred to by stable handles; their array position can change
+// whenever the hierarchy is re-sorted.
+class TransformHierarchy
+{
+public:
+	TransformHierarchy();
+
+	// Adds a node with an identity local transform. 'parent' is a handle or -1 for a root.
+	int createNode(int parent = -1);
+
+	// Removes a node together with all of its descendants
+	void destroyNode(int handle);
+
+	// Moves a node (and its subtree) under another parent, or to the root with -1.
+	// Returns false if 'parent' is inside the node's own subtree.
+	bool setParent(int handle, int parent);
+
+	void setLocal(int handle, const vec3& position, const quat& rotation, const vec3& scale);
+	void setPosition(int handle, const vec3& position);
+	void setRotation(int handle, const quat& rotation);
+	void setScale(int handle, const vec3& scale);
+
+	// Recomputes world matrices of changed subtrees. Levels with enough dirty work
+	// are split across 'threads' workers.
+	void update(int threads = 1);
+
+	const mat4& world(int handle) const;
+
+	// Packed world matrices in depth order, ready for instanced upload
+	const mat4* instanceData() const;
+	size_t nodeCount() const;
+
+	// Array position of a node inside instanceData()
+	int instanceIndex(int handle) const;
+
+	// Range of instanceData() written by the last update, [first, last); empty when first == last
+	void changedRange(size_t& first, size_t& last) const;
+
+	// Nodes recomputed by the last update
+	size_t lastUpdateCount() const;
+
+	// Uploads the matrices touched by the last update into an instance VBO sized for
+	// nodeCount() matrices, reallocating it when the node count changed
+	void uploadInstances(GLuint buffer);
+
+	// Binds a mat4 per-instance attribute (4 consecutive locations) to the bound GL_ARRAY_BUFFER
+	static void setupInstanceAttribute(GLuint location);
+
+private:
+	// per node, indexed by array position
+	std::vector<int> parents;
+	std::vector<int> depths;
+	std::vector<vec3> positions;
+	std::vector<quat> rotations;
+	std::vector<vec3> scales;
+	std::vector<mat4> worlds;
+	std::vector<unsigned char> localDirty;
+	std::vector<unsigned char> worldChanged;
+	std::vector<int> handles;
+
+	// handle -> array position, -1 for free handles
+	std::vector<int> handleToIndex;
+	std::vector<int> freeHandles;
+
+	// levelStart[d] is the first position at depth d; the last entry is nodeCount()
+	std::vector<size_t> levelStart;
+	bool needsSort;
+	bool allChanged;
+
+	size_t changedFirst, changedLast;
+	size_t updatedCount;
+	size_t uploadedCount;
+
+	void sortByDepth();
+	void recomputeDepths();
+	void updateRange(size_t first, size_t last, size_t& updated, size_t& minChanged, size_t& maxChanged);
+};
+
+#endif
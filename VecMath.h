@@ -0,0 +1,369 @@
+#ifndef VEC_MATH_H
+#define VEC_MATH_H
+
+// Header-only 3D math for transforms: vec3, vec4, mat4 (column-major, like GLSL) and quat.
+// vec4/mat4 products use SSE on x86/x64 and NEON on ARM, with a scalar fallback.
+// Construction and the scalar helpers are constexpr.
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define VECMATH_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define VECMATH_NEON
+#endif
+
+struct vec3
+{
+	float x, y, z;
+
+	constexpr vec3() : x(0), y(0), z(0) {}
+	constexpr vec3(float s) : x(s), y(s), z(s) {}
+	constexpr vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+};
+
+struct alignas(16) vec4
+{
+	float x, y, z, w;
+
+	constexpr vec4() : x(0), y(0), z(0), w(0) {}
+	constexpr vec4(float s) : x(s), y(s), z(s), w(s) {}
+	constexpr vec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+	constexpr vec4(const vec3& v, float w) : x(v.x), y(v.y), z(v.z), w(w) {}
+
+	constexpr vec3 xyz() const { return vec3(x, y, z); }
+};
+
+// Column-major 4x4 matrix: cols[c] is column c, so data() can go straight to glUniformMatrix4fv
+struct alignas(16) mat4
+{
+	vec4 cols[4];
+
+	constexpr mat4() : cols{ vec4(1, 0, 0, 0), vec4(0, 1, 0, 0), vec4(0, 0, 1, 0), vec4(0, 0, 0, 1) } {}
+	constexpr mat4(const vec4& c0, const vec4& c1, const vec4& c2, const vec4& c3) : cols{ c0, c1, c2, c3 } {}
+
+	static constexpr mat4 identity() { return mat4(); }
+
+	const float* data() const { return &cols[0].x; }
+	float* data() { return &cols[0].x; }
+};
+
+struct quat
+{
+	float x, y, z, w;
+
+	constexpr quat() : x(0), y(0), z(0), w(1) {}
+	constexpr quat(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+	static constexpr quat identity() { return quat(); }
+};
+
+// ---------------- vec3 ----------------
+
+constexpr vec3 operator+(const vec3& a, const vec3& b) { return vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+constexpr vec3 operator-(const vec3& a, const vec3& b) { return vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+constexpr vec3 operator-(const vec3& a) { return vec3(-a.x, -a.y, -a.z); }
+constexpr vec3 operator*(const vec3& a, const vec3& b) { return vec3(a.x * b.x, a.y * b.y, a.z * b.z); }
+constexpr vec3 operator*(const vec3& a, float s) { return vec3(a.x * s, a.y * s, a.z * s); }
+constexpr vec3 operator*(float s, const vec3& a) { return a * s; }
+
+constexpr float dot(const vec3& a, const vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+constexpr vec3 cross(const vec3& a, const vec3& b) {
+	return vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+inline float length(const vec3& a) { return std::sqrt(dot(a, a)); }
+inline vec3 normalize(const vec3& a) {
+	float len = length(a);
+	return len > 0.0f ? a * (1.0f / len) : a;
+}
+
+// ---------------- vec4 ----------------
+
+#if defined(VECMATH_SSE)
+inline __m128 load(const vec4& v) { return _mm_load_ps(&v.x); }
+inline vec4 store(__m128 r) { vec4 v; _mm_store_ps(&v.x, r); return v; }
+#elif defined(VECMATH_NEON)
+inline float32x4_t load(const vec4& v) { return vld1q_f32(&v.x); }
+inline vec4 store(float32x4_t r) { vec4 v; vst1q_f32(&v.x, r); return v; }
+#endif
+
+inline vec4 operator+(const vec4& a, const vec4& b) {
+#if defined(VECMATH_SSE)
+	return store(_mm_add_ps(load(a), load(b)));
+#elif defined(VECMATH_NEON)
+	return store(vaddq_f32(load(a), load(b)));
+#else
+	return vec4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+#endif
+}
+
+inline vec4 operator-(const vec4& a, const vec4& b) {
+#if defined(VECMATH_SSE)
+	return store(_mm_sub_ps(load(a), load(b)));
+#elif defined(VECMATH_NEON)
+	return store(vsubq_f32(load(a), load(b)));
+#else
+	return vec4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+#endif
+}
+
+inline vec4 operator*(const vec4& a, float s) {
+#if defined(VECMATH_SSE)
+	return store(_mm_mul_ps(load(a), _mm_set1_ps(s)));
+#elif defined(VECMATH_NEON)
+	return store(vmulq_n_f32(load(a), s));
+#else
+	return vec4(a.x * s, a.y * s, a.z * s, a.w * s);
+#endif
+}
+
+inline vec4 operator*(float s, const vec4& a) { return a * s; }
+constexpr float dot(const vec4& a, const vec4& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+// ---------------- mat4 ----------------
+
+inline vec4 operator*(const mat4& m, const vec4& v) {
+#if defined(VECMATH_SSE)
+	__m128 r = _mm_mul_ps(load(m.cols[0]), _mm_set1_ps(v.x));
+	r = _mm_add_ps(r, _mm_mul_ps(load(m.cols[1]), _mm_set1_ps(v.y)));
+	r = _mm_add_ps(r, _mm_mul_ps(load(m.cols[2]), _mm_set1_ps(v.z)));
+	r = _mm_add_ps(r, _mm_mul_ps(load(m.cols[3]), _mm_set1_ps(v.w)));
+	return store(r);
+#elif defined(VECMATH_NEON)
+	float32x4_t r = vmulq_n_f32(load(m.cols[0]), v.x);
+	r = vmlaq_n_f32(r, load(m.cols[1]), v.y);
+	r = vmlaq_n_f32(r, load(m.cols[2]), v.z);
+	r = vmlaq_n_f32(r, load(m.cols[3]), v.w);
+	return store(r);
+#else
+	return m.cols[0] * v.x + m.cols[1] * v.y + m.cols[2] * v.z + m.cols[3] * v.w;
+#endif
+}
+
+inline mat4 operator*(const mat4& a, const mat4& b) {
+	return mat4(a * b.cols[0], a * b.cols[1], a * b.cols[2], a * b.cols[3]);
+}
+
+// Plain scalar product, kept as the reference the SIMD paths are measured against
+constexpr mat4 mulScalar(const mat4& a, const mat4& b) {
+	mat4 r(vec4(0.0f), vec4(0.0f), vec4(0.0f), vec4(0.0f));
+	for (int c = 0; c < 4; c++) {
+		const vec4& bc = b.cols[c];
+		r.cols[c].x = a.cols[0].x * bc.x + a.cols[1].x * bc.y + a.cols[2].x * bc.z + a.cols[3].x * bc.w;
+		r.cols[c].y = a.cols[0].y * bc.x + a.cols[1].y * bc.y + a.cols[2].y * bc.z + a.cols[3].y * bc.w;
+		r.cols[c].z = a.cols[0].z * bc.x + a.cols[1].z * bc.y + a.cols[2].z * bc.z + a.cols[3].z * bc.w;
+		r.cols[c].w = a.cols[0].w * bc.x + a.cols[1].w * bc.y + a.cols[2].w * bc.z + a.cols[3].w * bc.w;
+	}
+	return r;
+}
+
+inline vec3 transformPoint(const mat4& m, const vec3& p) { return (m * vec4(p, 1.0f)).xyz(); }
+inline vec3 transformVector(const mat4& m, const vec3& v) { return (m * vec4(v, 0.0f)).xyz(); }
+
+constexpr mat4 transpose(const mat4& m) {
+	return mat4(
+		vec4(m.cols[0].x, m.cols[1].x, m.cols[2].x, m.cols[3].x),
+		vec4(m.cols[0].y, m.cols[1].y, m.cols[2].y, m.cols[3].y),
+		vec4(m.cols[0].z, m.cols[1].z, m.cols[2].z, m.cols[3].z),
+		vec4(m.cols[0].w, m.cols[1].w, m.cols[2].w, m.cols[3].w));
+}
+
+constexpr mat4 translate(const vec3& t) {
+	return mat4(vec4(1, 0, 0, 0), vec4(0, 1, 0, 0), vec4(0, 0, 1, 0), vec4(t, 1.0f));
+}
+
+constexpr mat4 scale(const vec3& s) {
+	return mat4(vec4(s.x, 0, 0, 0), vec4(0, s.y, 0, 0), vec4(0, 0, s.z, 0), vec4(0, 0, 0, 1));
+}
+
+// Rotation of 'radians' around a (not necessarily normalized) axis
+inline mat4 rotate(float radians, const vec3& axis) {
+	vec3 a = normalize(axis);
+	float c = std::cos(radians), s = std::sin(radians), t = 1.0f - c;
+	return mat4(
+		vec4(t * a.x * a.x + c, t * a.x * a.y + s * a.z, t * a.x * a.z - s * a.y, 0),
+		vec4(t * a.x * a.y - s * a.z, t * a.y * a.y + c, t * a.y * a.z + s * a.x, 0),
+		vec4(t * a.x * a.z + s * a.y, t * a.y * a.z - s * a.x, t * a.z * a.z + c, 0),
+		vec4(0, 0, 0, 1));
+}
+
+// Right-handed projection mapping depth to [-1, 1], same convention as glm::perspective
+inline mat4 perspective(float fovyRadians, float aspect, float zNear, float zFar) {
+	float f = 1.0f / std::tan(fovyRadians * 0.5f);
+	return mat4(
+		vec4(f / aspect, 0, 0, 0),
+		vec4(0, f, 0, 0),
+		vec4(0, 0, (zFar + zNear) / (zNear - zFar), -1),
+		vec4(0, 0, 2.0f * zFar * zNear / (zNear - zFar), 0));
+}
+
+constexpr mat4 ortho(float left, float right, float bottom, float top, float zNear, float zFar) {
+	return mat4(
+		vec4(2.0f / (right - left), 0, 0, 0),
+		vec4(0, 2.0f / (top - bottom), 0, 0),
+		vec4(0, 0, -2.0f / (zFar - zNear), 0),
+		vec4(-(right + left) / (right - left), -(top + bottom) / (top - bottom), -(zFar + zNear) / (zFar - zNear), 1));
+}
+
+inline mat4 lookAt(const vec3& eye, const vec3& center, const vec3& up) {
+	vec3 f = normalize(center - eye);
+	vec3 s = normalize(cross(f, up));
+	vec3 u = cross(s, f);
+	return mat4(
+		vec4(s.x, u.x, -f.x, 0),
+		vec4(s.y, u.y, -f.y, 0),
+		vec4(s.z, u.z, -f.z, 0),
+		vec4(-dot(s, eye), -dot(u, eye), dot(f, eye), 1));
+}
+
+// Inverse of a matrix made of rotation, scale and translation only (no projection)
+inline mat4 affineInverse(const mat4& m) {
+	// inverse of the upper 3x3 through its adjugate
+	vec3 c0 = m.cols[0].xyz(), c1 = m.cols[1].xyz(), c2 = m.cols[2].xyz();
+	vec3 r0 = cross(c1, c2), r1 = cross(c2, c0), r2 = cross(c0, c1);
+	float invDet = 1.0f / dot(c0, r0);
+	r0 = r0 * invDet;
+	r1 = r1 * invDet;
+	r2 = r2 * invDet;
+	vec3 t = m.cols[3].xyz();
+	return mat4(
+		vec4(r0.x, r1.x, r2.x, 0),
+		vec4(r0.y, r1.y, r2.y, 0),
+		vec4(r0.z, r1.z, r2.z, 0),
+		vec4(-dot(r0, t), -dot(r1, t), -dot(r2, t), 1));
+}
+
+// ---------------- quat ----------------
+
+inline quat angleAxis(float radians, const vec3& axis) {
+	vec3 a = normalize(axis);
+	float s = std::sin(radians * 0.5f);
+	return quat(a.x * s, a.y * s, a.z * s, std::cos(radians * 0.5f));
+}
+
+constexpr quat operator*(const quat& a, const quat& b) {
+	return quat(
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+}
+
+constexpr quat conjugate(const quat& q) { return quat(-q.x, -q.y, -q.z, q.w); }
+constexpr float dot(const quat& a, const quat& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+inline quat normalize(const quat& q) {
+	float len = std::sqrt(dot(q, q));
+	return len > 0.0f ? quat(q.x / len, q.y / len, q.z / len, q.w / len) : quat();
+}
+
+// Rotates v by a unit quaternion
+constexpr vec3 rotate(const quat& q, const vec3& v) {
+	// v + 2w(u x v) + 2u x (u x v), with u the vector part
+	vec3 u(q.x, q.y, q.z);
+	vec3 t = cross(u, v) * 2.0f;
+	return v + t * q.w + cross(u, t);
+}
+
+// Normalized lerp along the shortest arc; cheap and good enough for animation blending
+inline quat nlerp(const quat& a, const quat& b, float t) {
+	float sign = dot(a, b) < 0.0f ? -1.0f : 1.0f;
+	return normalize(quat(
+		a.x + (b.x * sign - a.x) * t,
+		a.y + (b.y * sign - a.y) * t,
+		a.z + (b.z * sign - a.z) * t,
+		a.w + (b.w * sign - a.w) * t));
+}
+
+inline quat slerp(const quat& a, const quat& b, float t) {
+	float cosTheta = dot(a, b);
+	float sign = cosTheta < 0.0f ? -1.0f : 1.0f;
+	cosTheta *= sign;
+	if (cosTheta > 0.9995f)
+		return nlerp(a, b, t);
+	float theta = std::acos(cosTheta);
+	float sinTheta = std::sin(theta);
+	float wa = std::sin((1.0f - t) * theta) / sinTheta;
+	float wb = std::sin(t * theta) / sinTheta * sign;
+	return quat(a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb);
+}
+
+constexpr mat4 toMat4(const quat& q) {
+	return mat4(
+		vec4(1 - 2 * (q.y * q.y + q.z * q.z), 2 * (q.x * q.y + q.z * q.w), 2 * (q.x * q.z - q.y * q.w), 0),
+		vec4(2 * (q.x * q.y - q.z * q.w), 1 - 2 * (q.x * q.x + q.z * q.z), 2 * (q.y * q.z + q.x * q.w), 0),
+		vec4(2 * (q.x * q.z + q.y * q.w), 2 * (q.y * q.z - q.x * q.w), 1 - 2 * (q.x * q.x + q.y * q.y), 0),
+		vec4(0, 0, 0, 1));
+}
+
+// translate * rotate * scale in one go
+constexpr mat4 composeTRS(const vec3& t, const quat& r, const vec3& s) {
+	return mat4(
+		vec4((1 - 2 * (r.y * r.y + r.z * r.z)) * s.x, 2 * (r.x * r.y + r.z * r.w) * s.x, 2 * (r.x * r.z - r.y * r.w) * s.x, 0),
+		vec4(2 * (r.x * r.y - r.z * r.w) * s.y, (1 - 2 * (r.x * r.x + r.z * r.z)) * s.y, 2 * (r.y * r.z + r.x * r.w) * s.y, 0),
+		vec4(2 * (r.x * r.z + r.y * r.w) * s.z, 2 * (r.y * r.z - r.x * r.w) * s.z, (1 - 2 * (r.x * r.x + r.y * r.y)) * s.z, 0),
+		vec4(t, 1.0f));
+}
+
+// ---------------- batched routines ----------------
+
+// out[i] = a[i] * b[i]; 'out' may alias 'b'
+inline void mulBatch(const mat4* a, const mat4* b, mat4* out, size_t count) {
+	for (size_t i = 0; i < count; i++)
+		out[i] = a[i] * b[i];
+}
+
+// out[i] = parent * local[i]
+inline void mulBatch(const mat4& parent, const mat4* local, mat4* out, size_t count) {
+	for (size_t i = 0; i < count; i++)
+		out[i] = parent * local[i];
+}
+
+// out[i] = composeTRS(t[i], r[i], s[i])
+inline void composeTRSBatch(const vec3* t, const quat* r, const vec3* s, mat4* out, size_t count) {
+	for (size_t i = 0; i < count; i++)
+		out[i] = composeTRS(t[i], r[i], s[i]);
+}
+
+// Transforms points stored as separate x/y/z arrays (SoA), four at a time.
+// In and out arrays may be the same.
+inline void transformPointsSoA(const mat4& m, const float* xs, const float* ys, const float* zs,
+	float* outX, float* outY, float* outZ, size_t count) {
+	size_t i = 0;
+	size_t vectorCount = count & ~(size_t)3;
+#if defined(VECMATH_SSE)
+	__m128 m00 = _mm_set1_ps(m.cols[0].x), m01 = _mm_set1_ps(m.cols[1].x), m02 = _mm_set1_ps(m.cols[2].x), m03 = _mm_set1_ps(m.cols[3].x);
+	__m128 m10 = _mm_set1_ps(m.cols[0].y), m11 = _mm_set1_ps(m.cols[1].y), m12 = _mm_set1_ps(m.cols[2].y), m13 = _mm_set1_ps(m.cols[3].y);
+	__m128 m20 = _mm_set1_ps(m.cols[0].z), m21 = _mm_set1_ps(m.cols[1].z), m22 = _mm_set1_ps(m.cols[2].z), m23 = _mm_set1_ps(m.cols[3].z);
+	for (; i < vectorCount; i += 4) {
+		__m128 x = _mm_loadu_ps(xs + i), y = _mm_loadu_ps(ys + i), z = _mm_loadu_ps(zs + i);
+		__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_add_ps(_mm_mul_ps(m02, z), m03));
+		__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_add_ps(_mm_mul_ps(m12, z), m13));
+		__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_add_ps(_mm_mul_ps(m22, z), m23));
+		_mm_storeu_ps(outX + i, rx);
+		_mm_storeu_ps(outY + i, ry);
+		_mm_storeu_ps(outZ + i, rz);
+	}
+#elif defined(VECMATH_NEON)
+	for (; i < vectorCount; i += 4) {
+		float32x4_t x = vld1q_f32(xs + i), y = vld1q_f32(ys + i), z = vld1q_f32(zs + i);
+		float32x4_t rx = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.cols[3].x), x, m.cols[0].x), y, m.cols[1].x), z, m.cols[2].x);
+		float32x4_t ry = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.cols[3].y), x, m.cols[0].y), y, m.cols[1].y), z, m.cols[2].y);
+		float32x4_t rz = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.cols[3].z), x, m.cols[0].z), y, m.cols[1].z), z, m.cols[2].z);
+		vst1q_f32(outX + i, rx);
+		vst1q_f32(outY + i, ry);
+		vst1q_f32(outZ + i, rz);
+	}
+#endif
+	for (; i < count; i++) {
+		float x = xs[i], y = ys[i], z = zs[i];
+		outX[i] = m.cols[0].x * x + m.cols[1].x * y + m.cols[2].x * z + m.cols[3].x;
+		outY[i] = m.cols[0].y * x + m.cols[1].y * y + m.cols[2].y * z + m.cols[3].y;
+		outZ[i] = m.cols[0].z * x + m.cols[1].z * y + m.cols[2].z * z + m.cols[3].z;
+	}
+}
+
+#endif
@@ -0,0 +1,503 @@
+#include "VertexFormat.h"
+#include "Shader.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+GLenum vertexEncodingType(VertexEncoding encoding) {
+	switch (encoding) {
+	case VertexEncoding::Half: return GL_HALF_FLOAT;
+	case VertexEncoding::Unorm8: return GL_UNSIGNED_BYTE;
+	case VertexEncoding::Snorm8: return GL_BYTE;
+	case VertexEncoding::Unorm16: return GL_UNSIGNED_SHORT;
+	case VertexEncoding::Snorm16: return GL_SHORT;
+	case VertexEncoding::Snorm10: return GL_INT_2_10_10_10_REV;
+	default: return GL_FLOAT;
+	}
+}
+
+bool vertexEncodingNormalized(VertexEncoding encoding) {
+	return encoding != VertexEncoding::Float && encoding != VertexEncoding::Half;
+}
+
+static bool isUnsigned(VertexEncoding encoding) {
+	return encoding == VertexEncoding::Unorm8 || encoding == VertexEncoding::Unorm16;
+}
+
+uint32_t vertexEncodingSize(VertexEncoding encoding, int components) {
+	switch (encoding) {
+	case VertexEncoding::Half: return 2 * components;
+	case VertexEncoding::Unorm8:
+	case VertexEncoding::Snorm8: return components;
+	case VertexEncoding::Unorm16:
+	case VertexEncoding::Snorm16: return 2 * components;
+	case VertexEncoding::Snorm10: return 4;
+	default: return 4 * components;
+	}
+}
+
+void quantizationRange(VertexEncoding encoding, const float* minimum, const float* maximum, int components,
+	float* scale, float* bias) {
+	for (int k = 0; k < components; k++) {
+		float extent = maximum[k] - minimum[k];
+		if (isUnsigned(encoding)) {
+			scale[k] = extent > 0.0f ? extent : 1.0f;
+			bias[k] = minimum[k];
+		}
+		else {
+			scale[k] = extent > 0.0f ? extent * 0.5f : 1.0f;
+			bias[k] = (minimum[k] + maximum[k]) * 0.5f;
+		}
+	}
+}
+
+uint16_t floatToHalf(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, 4);
+	uint32_t sign = (bits >> 16) & 0x8000;
+	uint32_t magnitude = bits & 0x7FFFFFFF;
+
+	if (magnitude >= 0x7F800000)	// inf, nan (keeps a mantissa bit so nan stays nan)
+		return (uint16_t)(sign | 0x7C00 | (magnitude > 0x7F800000 ? 0x200 : 0));
+	if (magnitude >= 0x477FF000)	// rounds past the largest half
+		return (uint16_t)(sign | 0x7C00);
+	if (magnitude < 0x38800000) {	// half denormal or zero
+		if (magnitude < 0x33000000)
+			return (uint16_t)sign;
+		uint32_t mantissa = (magnitude & 0x7FFFFF) | 0x800000;
+		int shift = 126 - (int)(magnitude >> 23);
+		uint32_t half = mantissa >> shift;
+		uint32_t remainder = mantissa & ((1u << shift) - 1);
+		uint32_t halfway = 1u << (shift - 1);
+		if (remainder > halfway || (remainder == halfway && (half & 1)))
+			half++;
+		return (uint16_t)(sign | half);
+	}
+	// rebias the exponent, round the mantissa to nearest even
+	uint32_t half = (magnitude - 0x38000000) >> 13;
+	uint32_t remainder = magnitude & 0x1FFF;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+		half++;
+	return (uint16_t)(sign | half);
+}
+
+float halfToFloat(uint16_t value) {
+	uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+	uint32_t exponent = (value >> 10) & 0x1F;
+	uint32_t mantissa = value & 0x3FF;
+	uint32_t bits;
+	if (exponent == 0) {
+		// zero or denormal: scale as an integer
+		float result = std::ldexp((float)mantissa, -24);
+		return sign ? -result : result;
+	}
+	if (exponent == 31)
+		bits = sign | 0x7F800000 | (mantissa << 13);
+	else
+		bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	float result;
+	memcpy(&result, &bits, 4);
+	return result;
+}
+
+// Signed normalized values use c = round(f * (2^(b-1) - 1)), the GL 4.2+ conversion; under the
+// older (2c + 1) / (2^b - 1) rule the decoded value is off by less than one step
+static int32_t toSnorm(float value, int bits) {
+	float maximum = (float)((1 << (bits - 1)) - 1);
+	return (int32_t)std::lround(std::min(std::max(value, -1.0f), 1.0f) * maximum);
+}
+
+static uint32_t toUnorm(float value, int bits) {
+	float maximum = (float)((1u << bits) - 1);
+	return (uint32_t)std::lround(std::min(std::max(value, 0.0f), 1.0f) * maximum);
+}
+
+uint32_t packSnorm10(float x, float y, float z, float w) {
+	return ((uint32_t)toSnorm(x, 10) & 0x3FF)
+		| (((uint32_t)toSnorm(y, 10) & 0x3FF) << 10)
+		| (((uint32_t)toSnorm(z, 10) & 0x3FF) << 20)
+		| (((uint32_t)toSnorm(w, 2) & 0x3) << 30);
+}
+
+// ---------------- VertexFormat ----------------
+
+VertexFormat::VertexFormat()
+	: size(0) {
+}
+
+VertexFormat& VertexFormat::add(GLuint location, int components, VertexEncoding encoding) {
+	VertexAttribute attribute;
+	attribute.location = location;
+	attribute.components = components;
+	attribute.encoding = encoding;
+	attribute.quantized = false;
+	attribute.offset = size;
+	std::fill(attribute.scale, attribute.scale + 4, 1.0f);
+	std::fill(attribute.bias, attribute.bias + 4, 0.0f);
+	attributes.push_back(attribute);
+	rangeFixed.push_back(0);
+	size = (size + vertexEncodingSize(encoding, components) + 3) & ~3u;
+	return *this;
+}
+
+VertexFormat& VertexFormat::addQuantized(GLuint location, int components, VertexEncoding encoding) {
+	add(location, components, encoding);
+	attributes.back().quantized = true;
+	return *this;
+}
+
+GLsizei VertexFormat::stride() const {
+	return (GLsizei)size;
+}
+
+size_t VertexFormat::attributeCount() const {
+	return attributes.size();
+}
+
+const VertexAttribute& VertexFormat::attribute(size_t index) const {
+	return attributes[index];
+}
+
+const VertexAttribute* VertexFormat::find(GLuint location) const {
+	for (const VertexAttribute& attribute : attributes) {
+		if (attribute.location == location)
+			return &attribute;
+	}
+	return nullptr;
+}
+
+void VertexFormat::setRange(GLuint location, const float* minimum, const float* maximum) {
+	for (size_t a = 0; a < attributes.size(); a++) {
+		VertexAttribute& attribute = attributes[a];
+		if (attribute.location != location || !attribute.quantized)
+			continue;
+		quantizationRange(attribute.encoding, minimum, maximum, attribute.components, attribute.scale, attribute.bias);
+		rangeFixed[a] = 1;
+	}
+}
+
+void VertexFormat::pack(const VertexSource* sources, size_t vertexCount, void* out) {
+	unsigned char* bytes = static_cast<unsigned char*>(out);
+	for (size_t a = 0; a < attributes.size(); a++) {
+		VertexAttribute& attribute = attributes[a];
+		const VertexSource& source = sources[a];
+		int components = attribute.components;
+
+		if (attribute.quantized && !rangeFixed[a]) {
+			float minimum[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+			float maximum[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+			for (size_t v = 0; v < vertexCount; v++) {
+				for (int k = 0; k < components; k++) {
+					minimum[k] = std::min(minimum[k], source.data[v * source.stride + k]);
+					maximum[k] = std::max(maximum[k], source.data[v * source.stride + k]);
+				}
+			}
+			if (vertexCount)
+				quantizationRange(attribute.encoding, minimum, maximum, components, attribute.scale, attribute.bias);
+		}
+
+		for (size_t v = 0; v < vertexCount; v++) {
+			const float* in = source.data + v * source.stride;
+			unsigned char* dst = bytes + v * size + attribute.offset;
+			float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for (int k = 0; k < components; k++)
+				value[k] = attribute.quantized ? (in[k] - attribute.bias[k]) / attribute.scale[k] : in[k];
+
+			switch (attribute.encoding) {
+			case VertexEncoding::Float:
+				memcpy(dst, value, components * 4);
+				break;
+			case VertexEncoding::Half:
+				for (int k = 0; k < components; k++) {
+					uint16_t half = floatToHalf(value[k]);
+					memcpy(dst + k * 2, &half, 2);
+				}
+				break;
+			case VertexEncoding::Unorm8:
+				for (int k = 0; k < components; k++)
+					dst[k] = (unsigned char)toUnorm(value[k], 8);
+				break;
+			case VertexEncoding::Snorm8:
+				for (int k = 0; k < components; k++)
+					dst[k] = (unsigned char)(int8_t)toSnorm(value[k], 8);
+				break;
+			case VertexEncoding::Unorm16:
+				for (int k = 0; k < components; k++) {
+					uint16_t unorm = (uint16_t)toUnorm(value[k], 16);
+					memcpy(dst + k * 2, &unorm, 2);
+				}
+				break;
+			case VertexEncoding::Snorm16:
+				for (int k = 0; k < components; k++) {
+					int16_t snorm = (int16_t)toSnorm(value[k], 16);
+					memcpy(dst + k * 2, &snorm, 2);
+				}
+				break;
+			case VertexEncoding::Snorm10: {
+				uint32_t packed = packSnorm10(value[0], value[1], value[2], value[3]);
+				memcpy(dst, &packed, 4);
+				break;
+			}
+			}
+		}
+	}
+}
+
+std::vector<unsigned char> VertexFormat::pack(const VertexSource* sources, size_t vertexCount) {
+	std::vector<unsigned char> bytes(vertexCount * size, 0);
+	pack(sources, vertexCount, bytes.data());
+	return bytes;
+}
+
+bool VertexFormat::unpack(GLuint location, const void* vertices, size_t vertexCount, float* out, int outComponents) const {
+	const VertexAttribute* attribute = find(location);
+	if (attribute == nullptr)
+		return false;
+	const unsigned char* bytes = static_cast<const unsigned char*>(vertices);
+	int components = attribute->encoding == VertexEncoding::Snorm10 ? 4 : attribute->components;
+	for (size_t v = 0; v < vertexCount; v++) {
+		const unsigned char* src = bytes + v * size + attribute->offset;
+		float value[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+		switch (attribute->encoding) {
+		case VertexEncoding::Float:
+			memcpy(value, src, components * 4);
+			break;
+		case VertexEncoding::Half:
+			for (int k = 0; k < components; k++) {
+				uint16_t half;
+				memcpy(&half, src + k * 2, 2);
+				value[k] = halfToFloat(half);
+			}
+			break;
+		case VertexEncoding::Unorm8:
+			for (int k = 0; k < components; k++)
+				value[k] = src[k] / 255.0f;
+			break;
+		case VertexEncoding::Snorm8:
+			for (int k = 0; k < components; k++)
+				value[k] = std::max((int8_t)src[k] / 127.0f, -1.0f);
+			break;
+		case VertexEncoding::Unorm16:
+			for (int k = 0; k < components; k++) {
+				uint16_t unorm;
+				memcpy(&unorm, src + k * 2, 2);
+				value[k] = unorm / 65535.0f;
+			}
+			break;
+		case VertexEncoding::Snorm16:
+			for (int k = 0; k < components; k++) {
+				int16_t snorm;
+				memcpy(&snorm, src + k * 2, 2);
+				value[k] = std::max(snorm / 32767.0f, -1.0f);
+			}
+			break;
+		case VertexEncoding::Snorm10: {
+			uint32_t packed;
+			memcpy(&packed, src, 4);
+			for (int k = 0; k < 3; k++) {
+				// sign-extend the 10-bit field
+				int32_t field = (int32_t)(packed << (22 - k * 10)) >> 22;
+				value[k] = std::max(field / 511.0f, -1.0f);
+			}
+			value[3] = std::max((float)((int32_t)packed >> 30), -1.0f);
+			break;
+		}
+		}
+		memcpy(out + v * outComponents, value, outComponents * sizeof(float));
+	}
+	return true;
+}
+
+void VertexFormat::apply(size_t baseOffset) const {
+	for (const VertexAttribute& attribute : attributes) {
+		// GL_INT_2_10_10_10_REV only accepts a size of 4; a vec3 input just drops w
+		GLint components = attribute.encoding == VertexEncoding::Snorm10 ? 4 : attribute.components;
+		glVertexAttribPointer(attribute.location, components, vertexEncodingType(attribute.encoding),
+			vertexEncodingNormalized(attribute.encoding) ? GL_TRUE : GL_FALSE, (GLsizei)size,
+			(void*)(baseOffset + attribute.offset));
+		glEnableVertexAttribArray(attribute.location);
+	}
+}
+
+void VertexFormat::setDequantUniforms(GLuint program, GLuint location, const char* scaleName, const char* biasName) const {
+	const VertexAttribute* attribute = find(location);
+	if (attribute == nullptr) {
+		std::cout << "ERROR::VERTEX_FORMAT::NO_ATTRIBUTE_AT_LOCATION: " << location << std::endl;
+		return;
+	}
+	GLint scaleLocation = glGetUniformLocation(program, scaleName);
+	GLint biasLocation = glGetUniformLocation(program, biasName);
+	if (attribute->components == 4) {
+		glUniform4fv(scaleLocation, 1, attribute->scale);
+		glUniform4fv(biasLocation, 1, attribute->bias);
+	}
+	else {
+		glUniform3fv(scaleLocation, 1, attribute->scale);
+		glUniform3fv(biasLocation, 1, attribute->bias);
+	}
+}
+
+// ---------------- benchmark ----------------
+
+static const char* benchmarkVertexShader = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in vec3 aNormal;
+uniform vec3 positionScale;
+uniform vec3 positionBias;
+out vec3 color;
+void main() {
+	gl_Position = vec4(aPos * positionScale + positionBias, 1.0);
+	color = aColor * (0.5 + 0.5 * aNormal.z) + vec3(aTexCoord, 0.0) * 0.1;
+})";
+
+static const char* benchmarkFragmentShader = R"(#version 330 core
+in vec3 color;
+out vec4 FragColor;
+void main() {
+	FragColor = vec4(color, 1.0);
+})";
+
+void runVertexFormatBenchmark() {
+	// a grid of tiny triangles over a small target, so the draw is bound by vertex fetch
+	const int gridSize = 512;
+	const int targetSize = 128;
+	const int iterations = 20;
+	const size_t vertexCount = (size_t)gridSize * gridSize;
+
+	std::vector<float> positions, colors, texcoords, normals;
+	for (int y = 0; y < gridSize; y++) {
+		for (int x = 0; x < gridSize; x++) {
+			float u = (float)x / (gridSize - 1), v = (float)y / (gridSize - 1);
+			float height = 0.25f * std::sin(u * 20.0f) * std::cos(v * 20.0f);
+			float n[3] = { -5.0f * std::cos(u * 20.0f) * std::cos(v * 20.0f), 5.0f * std::sin(u * 20.0f) * std::sin(v * 20.0f), 1.0f };
+			float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			float p[3] = { u * 2.0f - 1.0f, v * 2.0f - 1.0f, height };
+			float c[3] = { u, v, 1.0f - u };
+			positions.insert(positions.end(), p, p + 3);
+			colors.insert(colors.end(), c, c + 3);
+			texcoords.push_back(u);
+			texcoords.push_back(v);
+			for (int k = 0; k < 3; k++)
+				normals.push_back(n[k] / length);
+		}
+	}
+	std::vector<uint32_t> indices;
+	for (int y = 0; y + 1 < gridSize; y++) {
+		for (int x = 0; x + 1 < gridSize; x++) {
+			uint32_t i = (uint32_t)(y * gridSize + x);
+			uint32_t quad[6] = { i, i + 1, i + gridSize, i + 1, i + gridSize + 1, i + gridSize };
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+	const VertexSource sources[] = {
+		{ positions.data(), 3 }, { colors.data(), 3 }, { texcoords.data(), 2 }, { normals.data(), 3 }
+	};
+
+	struct Case
+	{
+		const char* name;
+		VertexFormat format;
+	};
+	Case cases[3];
+	cases[0].name = "float";
+	cases[0].format.add(0, 3, VertexEncoding::Float).add(1, 3, VertexEncoding::Float)
+		.add(2, 2, VertexEncoding::Float).add(3, 3, VertexEncoding::Float);
+	cases[1].name = "half";
+	cases[1].format.add(0, 3, VertexEncoding::Half).add(1, 3, VertexEncoding::Half)
+		.add(2, 2, VertexEncoding::Half).add(3, 3, VertexEncoding::Half);
+	cases[2].name = "compressed";
+	cases[2].format.addQuantized(0, 3, VertexEncoding::Snorm16).add(1, 3, VertexEncoding::Unorm8)
+		.add(2, 2, VertexEncoding::Half).add(3, 3, VertexEncoding::Snorm10);
+
+	Shader shader = Shader::fromSource(benchmarkVertexShader, benchmarkFragmentShader);
+	shader.use();
+
+	GLuint framebuffer, renderbuffer;
+	glGenFramebuffers(1, &framebuffer);
+	glGenRenderbuffers(1, &renderbuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, targetSize, targetSize);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+	glViewport(0, 0, targetSize, targetSize);
+
+	std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
+	std::cout << vertexCount << " vertices, " << indices.size() / 3 << " triangles, " << iterations << " draws\n";
+	std::cout << std::left << std::setw(12) << "format" << "bytes  MB     pack ms  draw ms  Mvert/s  max position error\n";
+
+	for (Case& c : cases) {
+		auto start = std::chrono::high_resolution_clock::now();
+		std::vector<unsigned char> vertices = c.format.pack(sources, vertexCount);
+		std::chrono::duration<double, std::milli> packTime = std::chrono::high_resolution_clock::now() - start;
+
+		// decode positions on the CPU the way the shader does to report the quantisation error
+		const VertexAttribute& position = c.format.attribute(0);
+		float maxError = 0.0f;
+		for (size_t v = 0; v < vertexCount; v++) {
+			const unsigned char* p = &vertices[v * c.format.stride() + position.offset];
+			for (int k = 0; k < 3; k++) {
+				float decoded;
+				if (position.encoding == VertexEncoding::Float) {
+					memcpy(&decoded, p + k * 4, 4);
+				}
+				else if (position.encoding == VertexEncoding::Half) {
+					uint16_t half;
+					memcpy(&half, p + k * 2, 2);
+					decoded = halfToFloat(half);
+				}
+				else {
+					int16_t snorm;
+					memcpy(&snorm, p + k * 2, 2);
+					decoded = std::max(snorm / 32767.0f, -1.0f);
+				}
+				decoded = decoded * position.scale[k] + position.bias[k];
+				maxError = std::max(maxError, std::fabs(decoded - positions[v * 3 + k]));
+			}
+		}
+
+		GLuint vao, buffers[2];
+		glGenVertexArrays(1, &vao);
+		glGenBuffers(2, buffers);
+		glBindVertexArray(vao);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size(), vertices.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * 4, indices.data(), GL_STATIC_DRAW);
+		c.format.apply();
+		c.format.setDequantUniforms(shader.ID, 0, "positionScale", "positionBias");
+
+		// warm-up draw so buffer creation isn't timed
+		glClear(GL_COLOR_BUFFER_BIT);
+		glDrawElements(GL_TRIANGLES, (GLsizei)indices.size(), GL_UNSIGNED_INT, 0);
+		glFinish();
+
+		start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++)
+			glDrawElements(GL_TRIANGLES, (GLsizei)indices.size(), GL_UNSIGNED_INT, 0);
+		glFinish();
+		std::chrono::duration<double, std::milli> drawTime = std::chrono::high_resolution_clock::now() - start;
+		double perDraw = drawTime.count() / iterations;
+
+		std::cout << std::left << std::setw(12) << c.name << std::setw(7) << c.format.stride()
+			<< std::fixed << std::setprecision(1) << std::setw(7) << vertices.size() / (1024.0 * 1024.0)
+			<< std::setw(9) << packTime.count() << std::setw(9) << perDraw
+			<< std::setw(9) << vertexCount / (perDraw * 1000.0)
+			<< std::scientific << std::setprecision(2) << maxError << std::defaultfloat << "\n";
+
+		glBindVertexArray(0);
+		glDeleteVertexArrays(1, &vao);
+		glDeleteBuffers(2, buffers);
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteRenderbuffers(1, &renderbuffer);
+	glDeleteProgram(shader.ID);
+}
@@ -0,0 +1,106 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Declarative description of an interleaved vertex: attributes are listed with the
+// encoding they are stored in, the format works out offsets and stride, converts
+// float source data and issues the glVertexAttribPointer calls. Every encoding is
+// core in GL 3.3.
+
+enum class VertexEncoding
+{
+	Float,		// 32-bit float
+	Half,		// GL_HALF_FLOAT, ~3 significant digits, good for texture coordinates
+	Unorm8,		// GL_UNSIGNED_BYTE normalized to [0, 1], colors
+	Snorm8,		// GL_BYTE normalized to [-1, 1]
+	Unorm16,	// GL_UNSIGNED_SHORT normalized to [0, 1]
+	Snorm16,	// GL_SHORT normalized to [-1, 1], quantized positions
+	Snorm10		// GL_INT_2_10_10_10_REV normalized, xyz in 10 bits + 2 bit w, normals/tangents
+};
+
+struct VertexAttribute
+{
+	GLuint location;
+	int components;
+	VertexEncoding encoding;
+	bool quantized;		// stored relative to the source range, value = stored * scale + bias
+	uint32_t offset;	// byte offset within the vertex
+	float scale[4];
+	float bias[4];
+};
+
+// Where pack() reads an attribute from: 'stride' floats between consecutive vertices
+struct VertexSource
+{
+	const float* data;
+	size_t stride;
+};
+
+class VertexFormat
+{
+public:
+	VertexFormat();
+
+	// Attributes are laid out in the order they are added, each at a 4-byte aligned offset
+	VertexFormat& add(GLuint location, int components, VertexEncoding encoding);
+	// Data outside the encoding's range: the source range is mapped onto [-1, 1] ([0, 1]
+	// for unsigned encodings) when packing, and the shader applies scale/bias to undo it
+	VertexFormat& addQuantized(GLuint location, int components, VertexEncoding encoding);
+
+	GLsizei stride() const;
+	size_t attributeCount() const;
+	const VertexAttribute& attribute(size_t index) const;
+	// Attribute at 'location', or nullptr
+	const VertexAttribute* find(GLuint location) const;
+
+	// Fixes the range of a quantized attribute instead of measuring it in pack(),
+	// e.g. so several meshes share one dequantisation
+	void setRange(GLuint location, const float* minimum, const float* maximum);
+
+	// Converts float sources (one per attribute, in add order) into 'vertexCount'
+	// interleaved vertices at 'out', which must hold vertexCount * stride() bytes
+	void pack(const VertexSource* sources, size_t vertexCount, void* out);
+	std::vector<unsigned char> pack(const VertexSource* sources, size_t vertexCount);
+
+	// Decodes the attribute at 'location' of 'vertexCount' packed vertices into 'outComponents'
+	// floats each, the values the vertex shader receives: normalized, not dequantized, and
+	// missing components filled from (0, 0, 0, 1). Returns false if there is no such attribute.
+	bool unpack(GLuint location, const void* vertices, size_t vertexCount, float* out, int outComponents) const;
+
+	// Sets up and enables every attribute for the bound GL_ARRAY_BUFFER, starting at 'baseOffset'
+	void apply(size_t baseOffset = 0) const;
+
+	// Uploads scale and bias of the quantized attribute at 'location' as vec3/vec4 uniforms
+	// of the program currently in use
+	void setDequantUniforms(GLuint program, GLuint location, const char* scaleName, const char* biasName) const;
+
+private:
+	std::vector<VertexAttribute> attributes;
+	std::vector<unsigned char> rangeFixed;
+	uint32_t size;
+};
+
+// GL type and normalized flag for an encoding; Snorm10 always passes 4 components to GL
+GLenum vertexEncodingType(VertexEncoding encoding);
+bool vertexEncodingNormalized(VertexEncoding encoding);
+// Bytes an attribute takes before the offset of the next one is aligned
+uint32_t vertexEncodingSize(VertexEncoding encoding, int components);
+
+// Scale/bias that map [minimum, maximum] onto [-1, 1], or onto [0, 1] for unsigned
+// encodings; a flat axis gets scale 1
+void quantizationRange(VertexEncoding encoding, const float* minimum, const float* maximum, int components,
+	float* scale, float* bias);
+
+uint16_t floatToHalf(float value);
+float halfToFloat(uint16_t value);
+// Packs xyz (and w in [-1, 1], rounded to 2 bits) into GL_INT_2_10_10_10_REV
+uint32_t packSnorm10(float x, float y, float z, float w);
+
+// Draw throughput of full-float against compressed vertex formats on a dense grid
+void runVertexFormatBenchmark();
+
+#endif
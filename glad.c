@@ -7,16 +7,33 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_buffer_storage,
+        GL_ARB_debug_output,
+        GL_ARB_direct_state_access,
+        GL_ARB_draw_indirect,
+        GL_ARB_get_program_binary,
+        GL_ARB_invalidate_subdata,
+        GL_ARB_multi_draw_indirect,
+        GL_ARB_parallel_shader_compile,
+        GL_ARB_texture_storage,
+        GL_ARB_timer_query,
+        GL_EXT_texture_compression_s3tc,
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_debug_output,GL_ARB_direct_state_access,GL_ARB_draw_indirect,GL_ARB_get_program_binary,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ARB_parallel_shader_compile,GL_ARB_texture_storage,GL_ARB_timer_query,GL_EXT_texture_compression_s3tc,GL_KHR_parallel_shader_compile"
     Online:
         https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+
+    Local changes: gladLoadGLLoaderLazy (entry points resolved on their first call through
+    trampolines) and gladHasExtension (extension names kept in a hash set).
+    GL_ARB_direct_state_access only declares the buffer and texture functions in use.
+    The storage, indirect draw and direct state access loaders also run when the context
+    version has them in core (same entry point names); their GLAD_ flags stay as advertised.
 */
 
 #include <stdio.h>
@@ -169,7 +186,47 @@ static const char *exts = NULL;
 static int num_exts_i = 0;
 static char **exts_i = NULL;
 
+/* exts_i as an open addressing hash set: slot holds an index into exts_i plus one, 0 if
+ * empty. Built once per load so has_ext doesn't strcmp through the whole list. */
+static int *exts_set = NULL;
+static unsigned int exts_set_mask = 0;
+
+static unsigned int hash_ext(const char *ext) {
+    unsigned int hash = 2166136261u;
+    while(*ext) {
+        hash ^= (unsigned char)*ext++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int build_exts_set(void) {
+    unsigned int size = 16;
+    int index;
+    while(size < (unsigned int)num_exts_i * 2) {
+        size <<= 1;
+    }
+    exts_set = (int *)calloc(size, sizeof *exts_set);
+    if(exts_set == NULL) {
+        return 0;
+    }
+    exts_set_mask = size - 1;
+    for(index = 0; index < num_exts_i; index++) {
+        unsigned int slot;
+        if(exts_i[index] == NULL) continue;
+        slot = hash_ext(exts_i[index]) & exts_set_mask;
+        while(exts_set[slot] != 0) {
+            slot = (slot + 1) & exts_set_mask;
+        }
+        exts_set[slot] = index + 1;
+    }
+    return 1;
+}
+
+static void free_exts(void);
+
 static int get_exts(void) {
+    free_exts();
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
@@ -198,6 +255,10 @@ static int get_exts(void) {
             }
             exts_i[index] = local_str;
         }
+
+        if (!build_exts_set()) {
+            return 0;
+        }
     }
 #endif
     return 1;
@@ -212,6 +273,11 @@ static void free_exts(void) {
         free((void *)exts_i);
         exts_i = NULL;
     }
+    if (exts_set != NULL) {
+        free((void *)exts_set);
+        exts_set = NULL;
+    }
+    num_exts_i = 0;
 }
 
 static int has_ext(const char *ext) {
@@ -241,12 +307,10 @@ static int has_ext(const char *ext) {
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
+        unsigned int slot;
+        if(exts_set == NULL || ext == NULL) return 0;
+        for(slot = hash_ext(ext) & exts_set_mask; exts_set[slot] != 0; slot = (slot + 1) & exts_set_mask) {
+            if(strcmp(exts_i[exts_set[slot] - 1], ext) == 0) {
                 return 1;
             }
         }
@@ -641,6 +705,52 @@ PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+int GLAD_GL_ARB_buffer_storage = 0;
+int GLAD_GL_ARB_debug_output = 0;
+int GLAD_GL_ARB_direct_state_access = 0;
+int GLAD_GL_ARB_draw_indirect = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_ARB_invalidate_subdata = 0;
+int GLAD_GL_ARB_multi_draw_indirect = 0;
+int GLAD_GL_ARB_parallel_shader_compile = 0;
+int GLAD_GL_ARB_texture_storage = 0;
+int GLAD_GL_ARB_timer_query = 0;
+int GLAD_GL_EXT_texture_compression_s3tc = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
+PFNGLDEBUGMESSAGECONTROLARBPROC glad_glDebugMessageControlARB = NULL;
+PFNGLDEBUGMESSAGEINSERTARBPROC glad_glDebugMessageInsertARB = NULL;
+PFNGLDEBUGMESSAGECALLBACKARBPROC glad_glDebugMessageCallbackARB = NULL;
+PFNGLGETDEBUGMESSAGELOGARBPROC glad_glGetDebugMessageLogARB = NULL;
+PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
+PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = NULL;
+PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
+PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = NULL;
+PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = NULL;
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
+PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
+PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
+PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = NULL;
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = NULL;
+PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = NULL;
+PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = NULL;
+PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = NULL;
+PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = NULL;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSARBPROC glad_glMaxShaderCompilerThreadsARB = NULL;
+PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
+PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
+PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1054,10 +1164,91 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage && !(GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 4))) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_debug_output(GLADloadproc load) {
+	if(!GLAD_GL_ARB_debug_output) return;
+	glad_glDebugMessageControlARB = (PFNGLDEBUGMESSAGECONTROLARBPROC)load("glDebugMessageControlARB");
+	glad_glDebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC)load("glDebugMessageInsertARB");
+	glad_glDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC)load("glDebugMessageCallbackARB");
+	glad_glGetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC)load("glGetDebugMessageLogARB");
+}
+static void load_GL_ARB_direct_state_access(GLADloadproc load) {
+	if(!GLAD_GL_ARB_direct_state_access && !(GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 5))) return;
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+}
+static void load_GL_ARB_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_draw_indirect && !(GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 0))) return;
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_ARB_invalidate_subdata(GLADloadproc load) {
+	if(!GLAD_GL_ARB_invalidate_subdata) return;
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
+}
+static void load_GL_ARB_multi_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_multi_draw_indirect && !(GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3))) return;
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
+static void load_GL_ARB_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_ARB_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)load("glMaxShaderCompilerThreadsARB");
+}
+static void load_GL_ARB_texture_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_texture_storage && !(GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 2))) return;
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
+}
+static void load_GL_ARB_timer_query(GLADloadproc load) {
+	if(!GLAD_GL_ARB_timer_query) return;
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
+	GLAD_GL_ARB_debug_output = has_ext("GL_ARB_debug_output");
+	GLAD_GL_ARB_direct_state_access = has_ext("GL_ARB_direct_state_access");
+	GLAD_GL_ARB_draw_indirect = has_ext("GL_ARB_draw_indirect");
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_ARB_invalidate_subdata = has_ext("GL_ARB_invalidate_subdata");
+	GLAD_GL_ARB_multi_draw_indirect = has_ext("GL_ARB_multi_draw_indirect");
+	GLAD_GL_ARB_parallel_shader_compile = has_ext("GL_ARB_parallel_shader_compile");
+	GLAD_GL_ARB_texture_storage = has_ext("GL_ARB_texture_storage");
+	GLAD_GL_ARB_timer_query = has_ext("GL_ARB_timer_query");
+	GLAD_GL_EXT_texture_compression_s3tc = has_ext("GL_EXT_texture_compression_s3tc");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
+	/* kept for gladHasExtension */
 	return 1;
 }
 
@@ -1135,6 +1326,2539 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_debug_output(load);
+	load_GL_ARB_direct_state_access(load);
+	load_GL_ARB_draw_indirect(load);
+	load_GL_ARB_get_program_binary(load);
+	load_GL_ARB_invalidate_subdata(load);
+	load_GL_ARB_multi_draw_indirect(load);
+	load_GL_ARB_parallel_shader_compile(load);
+	load_GL_ARB_texture_storage(load);
+	load_GL_ARB_timer_query(load);
+	load_GL_KHR_parallel_shader_compile(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+int gladHasExtension(const char *extension) {
+    return has_ext(extension);
+}
+
+/* On-demand loading. gladLoadGLLoaderLazy hands the load_* functions glad_lazy_proc instead
+ * of the real loader, which returns a trampoline per name. The trampoline resolves the entry
+ * point once (cached in glad_lazy_resolved) and only replaces itself in its glad_ pointer if
+ * it is still installed there, so wrappers that saved it (GLTrace) keep working. */
+static GLADloadproc glad_lazy_loader = NULL;
+static void* glad_lazy_resolved[408];
+
+static void* glad_lazy_resolve(int index, const char *name) {
+    if(glad_lazy_resolved[index] == NULL && glad_lazy_loader != NULL) {
+        glad_lazy_resolved[index] = glad_lazy_loader(name);
+    }
+    return glad_lazy_resolved[index];
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+	PFNGLACTIVETEXTUREPROC resolved = (PFNGLACTIVETEXTUREPROC)glad_lazy_resolve(0, "glActiveTexture");
+	if(glad_glActiveTexture == glad_lazy_glActiveTexture) glad_glActiveTexture = resolved;
+	resolved(texture);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+	PFNGLATTACHSHADERPROC resolved = (PFNGLATTACHSHADERPROC)glad_lazy_resolve(1, "glAttachShader");
+	if(glad_glAttachShader == glad_lazy_glAttachShader) glad_glAttachShader = resolved;
+	resolved(program, shader);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	PFNGLBEGINCONDITIONALRENDERPROC resolved = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve(2, "glBeginConditionalRender");
+	if(glad_glBeginConditionalRender == glad_lazy_glBeginConditionalRender) glad_glBeginConditionalRender = resolved;
+	resolved(id, mode);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+	PFNGLBEGINQUERYPROC resolved = (PFNGLBEGINQUERYPROC)glad_lazy_resolve(3, "glBeginQuery");
+	if(glad_glBeginQuery == glad_lazy_glBeginQuery) glad_glBeginQuery = resolved;
+	resolved(target, id);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	PFNGLBEGINTRANSFORMFEEDBACKPROC resolved = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve(4, "glBeginTransformFeedback");
+	if(glad_glBeginTransformFeedback == glad_lazy_glBeginTransformFeedback) glad_glBeginTransformFeedback = resolved;
+	resolved(primitiveMode);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	PFNGLBINDATTRIBLOCATIONPROC resolved = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve(5, "glBindAttribLocation");
+	if(glad_glBindAttribLocation == glad_lazy_glBindAttribLocation) glad_glBindAttribLocation = resolved;
+	resolved(program, index, name);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	PFNGLBINDBUFFERPROC resolved = (PFNGLBINDBUFFERPROC)glad_lazy_resolve(6, "glBindBuffer");
+	if(glad_glBindBuffer == glad_lazy_glBindBuffer) glad_glBindBuffer = resolved;
+	resolved(target, buffer);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	PFNGLBINDBUFFERBASEPROC resolved = (PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve(7, "glBindBufferBase");
+	if(glad_glBindBufferBase == glad_lazy_glBindBufferBase) glad_glBindBufferBase = resolved;
+	resolved(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	PFNGLBINDBUFFERRANGEPROC resolved = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve(8, "glBindBufferRange");
+	if(glad_glBindBufferRange == glad_lazy_glBindBufferRange) glad_glBindBufferRange = resolved;
+	resolved(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	PFNGLBINDFRAGDATALOCATIONPROC resolved = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve(9, "glBindFragDataLocation");
+	if(glad_glBindFragDataLocation == glad_lazy_glBindFragDataLocation) glad_glBindFragDataLocation = resolved;
+	resolved(program, color, name);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	PFNGLBINDFRAGDATALOCATIONINDEXEDPROC resolved = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve(10, "glBindFragDataLocationIndexed");
+	if(glad_glBindFragDataLocationIndexed == glad_lazy_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = resolved;
+	resolved(program, colorNumber, index, name);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	PFNGLBINDFRAMEBUFFERPROC resolved = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve(11, "glBindFramebuffer");
+	if(glad_glBindFramebuffer == glad_lazy_glBindFramebuffer) glad_glBindFramebuffer = resolved;
+	resolved(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	PFNGLBINDRENDERBUFFERPROC resolved = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve(12, "glBindRenderbuffer");
+	if(glad_glBindRenderbuffer == glad_lazy_glBindRenderbuffer) glad_glBindRenderbuffer = resolved;
+	resolved(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	PFNGLBINDSAMPLERPROC resolved = (PFNGLBINDSAMPLERPROC)glad_lazy_resolve(13, "glBindSampler");
+	if(glad_glBindSampler == glad_lazy_glBindSampler) glad_glBindSampler = resolved;
+	resolved(unit, sampler);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+	PFNGLBINDTEXTUREPROC resolved = (PFNGLBINDTEXTUREPROC)glad_lazy_resolve(14, "glBindTexture");
+	if(glad_glBindTexture == glad_lazy_glBindTexture) glad_glBindTexture = resolved;
+	resolved(target, texture);
+}
+static void APIENTRY glad_lazy_glBindTextureUnit(GLuint unit, GLuint texture) {
+	PFNGLBINDTEXTUREUNITPROC resolved = (PFNGLBINDTEXTUREUNITPROC)glad_lazy_resolve(15, "glBindTextureUnit");
+	if(glad_glBindTextureUnit == glad_lazy_glBindTextureUnit) glad_glBindTextureUnit = resolved;
+	resolved(unit, texture);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+	PFNGLBINDVERTEXARRAYPROC resolved = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve(16, "glBindVertexArray");
+	if(glad_glBindVertexArray == glad_lazy_glBindVertexArray) glad_glBindVertexArray = resolved;
+	resolved(array);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	PFNGLBLENDCOLORPROC resolved = (PFNGLBLENDCOLORPROC)glad_lazy_resolve(17, "glBlendColor");
+	if(glad_glBlendColor == glad_lazy_glBlendColor) glad_glBlendColor = resolved;
+	resolved(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+	PFNGLBLENDEQUATIONPROC resolved = (PFNGLBLENDEQUATIONPROC)glad_lazy_resolve(18, "glBlendEquation");
+	if(glad_glBlendEquation == glad_lazy_glBlendEquation) glad_glBlendEquation = resolved;
+	resolved(mode);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	PFNGLBLENDEQUATIONSEPARATEPROC resolved = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve(19, "glBlendEquationSeparate");
+	if(glad_glBlendEquationSeparate == glad_lazy_glBlendEquationSeparate) glad_glBlendEquationSeparate = resolved;
+	resolved(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	PFNGLBLENDFUNCPROC resolved = (PFNGLBLENDFUNCPROC)glad_lazy_resolve(20, "glBlendFunc");
+	if(glad_glBlendFunc == glad_lazy_glBlendFunc) glad_glBlendFunc = resolved;
+	resolved(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	PFNGLBLENDFUNCSEPARATEPROC resolved = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve(21, "glBlendFuncSeparate");
+	if(glad_glBlendFuncSeparate == glad_lazy_glBlendFuncSeparate) glad_glBlendFuncSeparate = resolved;
+	resolved(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	PFNGLBLITFRAMEBUFFERPROC resolved = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve(22, "glBlitFramebuffer");
+	if(glad_glBlitFramebuffer == glad_lazy_glBlitFramebuffer) glad_glBlitFramebuffer = resolved;
+	resolved(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	PFNGLBUFFERDATAPROC resolved = (PFNGLBUFFERDATAPROC)glad_lazy_resolve(23, "glBufferData");
+	if(glad_glBufferData == glad_lazy_glBufferData) glad_glBufferData = resolved;
+	resolved(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	PFNGLBUFFERSTORAGEPROC resolved = (PFNGLBUFFERSTORAGEPROC)glad_lazy_resolve(24, "glBufferStorage");
+	if(glad_glBufferStorage == glad_lazy_glBufferStorage) glad_glBufferStorage = resolved;
+	resolved(target, size, data, flags);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	PFNGLBUFFERSUBDATAPROC resolved = (PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve(25, "glBufferSubData");
+	if(glad_glBufferSubData == glad_lazy_glBufferSubData) glad_glBufferSubData = resolved;
+	resolved(target, offset, size, data);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC resolved = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve(26, "glCheckFramebufferStatus");
+	if(glad_glCheckFramebufferStatus == glad_lazy_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = resolved;
+	return resolved(target);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+	PFNGLCLAMPCOLORPROC resolved = (PFNGLCLAMPCOLORPROC)glad_lazy_resolve(27, "glClampColor");
+	if(glad_glClampColor == glad_lazy_glClampColor) glad_glClampColor = resolved;
+	resolved(target, clamp);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+	PFNGLCLEARPROC resolved = (PFNGLCLEARPROC)glad_lazy_resolve(28, "glClear");
+	if(glad_glClear == glad_lazy_glClear) glad_glClear = resolved;
+	resolved(mask);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	PFNGLCLEARBUFFERFIPROC resolved = (PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve(29, "glClearBufferfi");
+	if(glad_glClearBufferfi == glad_lazy_glClearBufferfi) glad_glClearBufferfi = resolved;
+	resolved(buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	PFNGLCLEARBUFFERFVPROC resolved = (PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve(30, "glClearBufferfv");
+	if(glad_glClearBufferfv == glad_lazy_glClearBufferfv) glad_glClearBufferfv = resolved;
+	resolved(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	PFNGLCLEARBUFFERIVPROC resolved = (PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve(31, "glClearBufferiv");
+	if(glad_glClearBufferiv == glad_lazy_glClearBufferiv) glad_glClearBufferiv = resolved;
+	resolved(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	PFNGLCLEARBUFFERUIVPROC resolved = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve(32, "glClearBufferuiv");
+	if(glad_glClearBufferuiv == glad_lazy_glClearBufferuiv) glad_glClearBufferuiv = resolved;
+	resolved(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	PFNGLCLEARCOLORPROC resolved = (PFNGLCLEARCOLORPROC)glad_lazy_resolve(33, "glClearColor");
+	if(glad_glClearColor == glad_lazy_glClearColor) glad_glClearColor = resolved;
+	resolved(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+	PFNGLCLEARDEPTHPROC resolved = (PFNGLCLEARDEPTHPROC)glad_lazy_resolve(34, "glClearDepth");
+	if(glad_glClearDepth == glad_lazy_glClearDepth) glad_glClearDepth = resolved;
+	resolved(depth);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+	PFNGLCLEARSTENCILPROC resolved = (PFNGLCLEARSTENCILPROC)glad_lazy_resolve(35, "glClearStencil");
+	if(glad_glClearStencil == glad_lazy_glClearStencil) glad_glClearStencil = resolved;
+	resolved(s);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	PFNGLCLIENTWAITSYNCPROC resolved = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve(36, "glClientWaitSync");
+	if(glad_glClientWaitSync == glad_lazy_glClientWaitSync) glad_glClientWaitSync = resolved;
+	return resolved(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	PFNGLCOLORMASKPROC resolved = (PFNGLCOLORMASKPROC)glad_lazy_resolve(37, "glColorMask");
+	if(glad_glColorMask == glad_lazy_glColorMask) glad_glColorMask = resolved;
+	resolved(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	PFNGLCOLORMASKIPROC resolved = (PFNGLCOLORMASKIPROC)glad_lazy_resolve(38, "glColorMaski");
+	if(glad_glColorMaski == glad_lazy_glColorMaski) glad_glColorMaski = resolved;
+	resolved(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+	PFNGLCOLORP3UIPROC resolved = (PFNGLCOLORP3UIPROC)glad_lazy_resolve(39, "glColorP3ui");
+	if(glad_glColorP3ui == glad_lazy_glColorP3ui) glad_glColorP3ui = resolved;
+	resolved(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	PFNGLCOLORP3UIVPROC resolved = (PFNGLCOLORP3UIVPROC)glad_lazy_resolve(40, "glColorP3uiv");
+	if(glad_glColorP3uiv == glad_lazy_glColorP3uiv) glad_glColorP3uiv = resolved;
+	resolved(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+	PFNGLCOLORP4UIPROC resolved = (PFNGLCOLORP4UIPROC)glad_lazy_resolve(41, "glColorP4ui");
+	if(glad_glColorP4ui == glad_lazy_glColorP4ui) glad_glColorP4ui = resolved;
+	resolved(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	PFNGLCOLORP4UIVPROC resolved = (PFNGLCOLORP4UIVPROC)glad_lazy_resolve(42, "glColorP4uiv");
+	if(glad_glColorP4uiv == glad_lazy_glColorP4uiv) glad_glColorP4uiv = resolved;
+	resolved(type, color);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+	PFNGLCOMPILESHADERPROC resolved = (PFNGLCOMPILESHADERPROC)glad_lazy_resolve(43, "glCompileShader");
+	if(glad_glCompileShader == glad_lazy_glCompileShader) glad_glCompileShader = resolved;
+	resolved(shader);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXIMAGE1DPROC resolved = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve(44, "glCompressedTexImage1D");
+	if(glad_glCompressedTexImage1D == glad_lazy_glCompressedTexImage1D) glad_glCompressedTexImage1D = resolved;
+	resolved(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC resolved = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve(45, "glCompressedTexImage2D");
+	if(glad_glCompressedTexImage2D == glad_lazy_glCompressedTexImage2D) glad_glCompressedTexImage2D = resolved;
+	resolved(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXIMAGE3DPROC resolved = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve(46, "glCompressedTexImage3D");
+	if(glad_glCompressedTexImage3D == glad_lazy_glCompressedTexImage3D) glad_glCompressedTexImage3D = resolved;
+	resolved(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC resolved = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve(47, "glCompressedTexSubImage1D");
+	if(glad_glCompressedTexSubImage1D == glad_lazy_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = resolved;
+	resolved(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC resolved = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve(48, "glCompressedTexSubImage2D");
+	if(glad_glCompressedTexSubImage2D == glad_lazy_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = resolved;
+	resolved(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC resolved = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve(49, "glCompressedTexSubImage3D");
+	if(glad_glCompressedTexSubImage3D == glad_lazy_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = resolved;
+	resolved(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	PFNGLCOPYBUFFERSUBDATAPROC resolved = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve(50, "glCopyBufferSubData");
+	if(glad_glCopyBufferSubData == glad_lazy_glCopyBufferSubData) glad_glCopyBufferSubData = resolved;
+	resolved(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	PFNGLCOPYTEXIMAGE1DPROC resolved = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve(51, "glCopyTexImage1D");
+	if(glad_glCopyTexImage1D == glad_lazy_glCopyTexImage1D) glad_glCopyTexImage1D = resolved;
+	resolved(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	PFNGLCOPYTEXIMAGE2DPROC resolved = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve(52, "glCopyTexImage2D");
+	if(glad_glCopyTexImage2D == glad_lazy_glCopyTexImage2D) glad_glCopyTexImage2D = resolved;
+	resolved(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	PFNGLCOPYTEXSUBIMAGE1DPROC resolved = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve(53, "glCopyTexSubImage1D");
+	if(glad_glCopyTexSubImage1D == glad_lazy_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = resolved;
+	resolved(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLCOPYTEXSUBIMAGE2DPROC resolved = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve(54, "glCopyTexSubImage2D");
+	if(glad_glCopyTexSubImage2D == glad_lazy_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = resolved;
+	resolved(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLCOPYTEXSUBIMAGE3DPROC resolved = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve(55, "glCopyTexSubImage3D");
+	if(glad_glCopyTexSubImage3D == glad_lazy_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = resolved;
+	resolved(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	PFNGLCREATEBUFFERSPROC resolved = (PFNGLCREATEBUFFERSPROC)glad_lazy_resolve(56, "glCreateBuffers");
+	if(glad_glCreateBuffers == glad_lazy_glCreateBuffers) glad_glCreateBuffers = resolved;
+	resolved(n, buffers);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	PFNGLCREATEPROGRAMPROC resolved = (PFNGLCREATEPROGRAMPROC)glad_lazy_resolve(57, "glCreateProgram");
+	if(glad_glCreateProgram == glad_lazy_glCreateProgram) glad_glCreateProgram = resolved;
+	return resolved();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+	PFNGLCREATESHADERPROC resolved = (PFNGLCREATESHADERPROC)glad_lazy_resolve(58, "glCreateShader");
+	if(glad_glCreateShader == glad_lazy_glCreateShader) glad_glCreateShader = resolved;
+	return resolved(type);
+}
+static void APIENTRY glad_lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	PFNGLCREATETEXTURESPROC resolved = (PFNGLCREATETEXTURESPROC)glad_lazy_resolve(59, "glCreateTextures");
+	if(glad_glCreateTextures == glad_lazy_glCreateTextures) glad_glCreateTextures = resolved;
+	resolved(target, n, textures);
+}
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+	PFNGLCULLFACEPROC resolved = (PFNGLCULLFACEPROC)glad_lazy_resolve(60, "glCullFace");
+	if(glad_glCullFace == glad_lazy_glCullFace) glad_glCullFace = resolved;
+	resolved(mode);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallbackARB(GLDEBUGPROCARB callback, const void *userParam) {
+	PFNGLDEBUGMESSAGECALLBACKARBPROC resolved = (PFNGLDEBUGMESSAGECALLBACKARBPROC)glad_lazy_resolve(61, "glDebugMessageCallbackARB");
+	if(glad_glDebugMessageCallbackARB == glad_lazy_glDebugMessageCallbackARB) glad_glDebugMessageCallbackARB = resolved;
+	resolved(callback, userParam);
+}
+static void APIENTRY glad_lazy_glDebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	PFNGLDEBUGMESSAGECONTROLARBPROC resolved = (PFNGLDEBUGMESSAGECONTROLARBPROC)glad_lazy_resolve(62, "glDebugMessageControlARB");
+	if(glad_glDebugMessageControlARB == glad_lazy_glDebugMessageControlARB) glad_glDebugMessageControlARB = resolved;
+	resolved(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	PFNGLDEBUGMESSAGEINSERTARBPROC resolved = (PFNGLDEBUGMESSAGEINSERTARBPROC)glad_lazy_resolve(63, "glDebugMessageInsertARB");
+	if(glad_glDebugMessageInsertARB == glad_lazy_glDebugMessageInsertARB) glad_glDebugMessageInsertARB = resolved;
+	resolved(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	PFNGLDELETEBUFFERSPROC resolved = (PFNGLDELETEBUFFERSPROC)glad_lazy_resolve(64, "glDeleteBuffers");
+	if(glad_glDeleteBuffers == glad_lazy_glDeleteBuffers) glad_glDeleteBuffers = resolved;
+	resolved(n, buffers);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	PFNGLDELETEFRAMEBUFFERSPROC resolved = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve(65, "glDeleteFramebuffers");
+	if(glad_glDeleteFramebuffers == glad_lazy_glDeleteFramebuffers) glad_glDeleteFramebuffers = resolved;
+	resolved(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+	PFNGLDELETEPROGRAMPROC resolved = (PFNGLDELETEPROGRAMPROC)glad_lazy_resolve(66, "glDeleteProgram");
+	if(glad_glDeleteProgram == glad_lazy_glDeleteProgram) glad_glDeleteProgram = resolved;
+	resolved(program);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	PFNGLDELETEQUERIESPROC resolved = (PFNGLDELETEQUERIESPROC)glad_lazy_resolve(67, "glDeleteQueries");
+	if(glad_glDeleteQueries == glad_lazy_glDeleteQueries) glad_glDeleteQueries = resolved;
+	resolved(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	PFNGLDELETERENDERBUFFERSPROC resolved = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve(68, "glDeleteRenderbuffers");
+	if(glad_glDeleteRenderbuffers == glad_lazy_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = resolved;
+	resolved(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	PFNGLDELETESAMPLERSPROC resolved = (PFNGLDELETESAMPLERSPROC)glad_lazy_resolve(69, "glDeleteSamplers");
+	if(glad_glDeleteSamplers == glad_lazy_glDeleteSamplers) glad_glDeleteSamplers = resolved;
+	resolved(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+	PFNGLDELETESHADERPROC resolved = (PFNGLDELETESHADERPROC)glad_lazy_resolve(70, "glDeleteShader");
+	if(glad_glDeleteShader == glad_lazy_glDeleteShader) glad_glDeleteShader = resolved;
+	resolved(shader);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+	PFNGLDELETESYNCPROC resolved = (PFNGLDELETESYNCPROC)glad_lazy_resolve(71, "glDeleteSync");
+	if(glad_glDeleteSync == glad_lazy_glDeleteSync) glad_glDeleteSync = resolved;
+	resolved(sync);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	PFNGLDELETETEXTURESPROC resolved = (PFNGLDELETETEXTURESPROC)glad_lazy_resolve(72, "glDeleteTextures");
+	if(glad_glDeleteTextures == glad_lazy_glDeleteTextures) glad_glDeleteTextures = resolved;
+	resolved(n, textures);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	PFNGLDELETEVERTEXARRAYSPROC resolved = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve(73, "glDeleteVertexArrays");
+	if(glad_glDeleteVertexArrays == glad_lazy_glDeleteVertexArrays) glad_glDeleteVertexArrays = resolved;
+	resolved(n, arrays);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+	PFNGLDEPTHFUNCPROC resolved = (PFNGLDEPTHFUNCPROC)glad_lazy_resolve(74, "glDepthFunc");
+	if(glad_glDepthFunc == glad_lazy_glDepthFunc) glad_glDepthFunc = resolved;
+	resolved(func);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+	PFNGLDEPTHMASKPROC resolved = (PFNGLDEPTHMASKPROC)glad_lazy_resolve(75, "glDepthMask");
+	if(glad_glDepthMask == glad_lazy_glDepthMask) glad_glDepthMask = resolved;
+	resolved(flag);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	PFNGLDEPTHRANGEPROC resolved = (PFNGLDEPTHRANGEPROC)glad_lazy_resolve(76, "glDepthRange");
+	if(glad_glDepthRange == glad_lazy_glDepthRange) glad_glDepthRange = resolved;
+	resolved(n, f);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+	PFNGLDETACHSHADERPROC resolved = (PFNGLDETACHSHADERPROC)glad_lazy_resolve(77, "glDetachShader");
+	if(glad_glDetachShader == glad_lazy_glDetachShader) glad_glDetachShader = resolved;
+	resolved(program, shader);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+	PFNGLDISABLEPROC resolved = (PFNGLDISABLEPROC)glad_lazy_resolve(78, "glDisable");
+	if(glad_glDisable == glad_lazy_glDisable) glad_glDisable = resolved;
+	resolved(cap);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+	PFNGLDISABLEVERTEXATTRIBARRAYPROC resolved = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve(79, "glDisableVertexAttribArray");
+	if(glad_glDisableVertexAttribArray == glad_lazy_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = resolved;
+	resolved(index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+	PFNGLDISABLEIPROC resolved = (PFNGLDISABLEIPROC)glad_lazy_resolve(80, "glDisablei");
+	if(glad_glDisablei == glad_lazy_glDisablei) glad_glDisablei = resolved;
+	resolved(target, index);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	PFNGLDRAWARRAYSPROC resolved = (PFNGLDRAWARRAYSPROC)glad_lazy_resolve(81, "glDrawArrays");
+	if(glad_glDrawArrays == glad_lazy_glDrawArrays) glad_glDrawArrays = resolved;
+	resolved(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	PFNGLDRAWARRAYSINDIRECTPROC resolved = (PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_resolve(82, "glDrawArraysIndirect");
+	if(glad_glDrawArraysIndirect == glad_lazy_glDrawArraysIndirect) glad_glDrawArraysIndirect = resolved;
+	resolved(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	PFNGLDRAWARRAYSINSTANCEDPROC resolved = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve(83, "glDrawArraysInstanced");
+	if(glad_glDrawArraysInstanced == glad_lazy_glDrawArraysInstanced) glad_glDrawArraysInstanced = resolved;
+	resolved(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+	PFNGLDRAWBUFFERPROC resolved = (PFNGLDRAWBUFFERPROC)glad_lazy_resolve(84, "glDrawBuffer");
+	if(glad_glDrawBuffer == glad_lazy_glDrawBuffer) glad_glDrawBuffer = resolved;
+	resolved(buf);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	PFNGLDRAWBUFFERSPROC resolved = (PFNGLDRAWBUFFERSPROC)glad_lazy_resolve(85, "glDrawBuffers");
+	if(glad_glDrawBuffers == glad_lazy_glDrawBuffers) glad_glDrawBuffers = resolved;
+	resolved(n, bufs);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	PFNGLDRAWELEMENTSPROC resolved = (PFNGLDRAWELEMENTSPROC)glad_lazy_resolve(86, "glDrawElements");
+	if(glad_glDrawElements == glad_lazy_glDrawElements) glad_glDrawElements = resolved;
+	resolved(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	PFNGLDRAWELEMENTSBASEVERTEXPROC resolved = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve(87, "glDrawElementsBaseVertex");
+	if(glad_glDrawElementsBaseVertex == glad_lazy_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = resolved;
+	resolved(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	PFNGLDRAWELEMENTSINDIRECTPROC resolved = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve(88, "glDrawElementsIndirect");
+	if(glad_glDrawElementsIndirect == glad_lazy_glDrawElementsIndirect) glad_glDrawElementsIndirect = resolved;
+	resolved(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	PFNGLDRAWELEMENTSINSTANCEDPROC resolved = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve(89, "glDrawElementsInstanced");
+	if(glad_glDrawElementsInstanced == glad_lazy_glDrawElementsInstanced) glad_glDrawElementsInstanced = resolved;
+	resolved(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC resolved = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve(90, "glDrawElementsInstancedBaseVertex");
+	if(glad_glDrawElementsInstancedBaseVertex == glad_lazy_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = resolved;
+	resolved(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	PFNGLDRAWRANGEELEMENTSPROC resolved = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve(91, "glDrawRangeElements");
+	if(glad_glDrawRangeElements == glad_lazy_glDrawRangeElements) glad_glDrawRangeElements = resolved;
+	resolved(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC resolved = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve(92, "glDrawRangeElementsBaseVertex");
+	if(glad_glDrawRangeElementsBaseVertex == glad_lazy_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = resolved;
+	resolved(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+	PFNGLENABLEPROC resolved = (PFNGLENABLEPROC)glad_lazy_resolve(93, "glEnable");
+	if(glad_glEnable == glad_lazy_glEnable) glad_glEnable = resolved;
+	resolved(cap);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+	PFNGLENABLEVERTEXATTRIBARRAYPROC resolved = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve(94, "glEnableVertexAttribArray");
+	if(glad_glEnableVertexAttribArray == glad_lazy_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = resolved;
+	resolved(index);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+	PFNGLENABLEIPROC resolved = (PFNGLENABLEIPROC)glad_lazy_resolve(95, "glEnablei");
+	if(glad_glEnablei == glad_lazy_glEnablei) glad_glEnablei = resolved;
+	resolved(target, index);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	PFNGLENDCONDITIONALRENDERPROC resolved = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve(96, "glEndConditionalRender");
+	if(glad_glEndConditionalRender == glad_lazy_glEndConditionalRender) glad_glEndConditionalRender = resolved;
+	resolved();
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+	PFNGLENDQUERYPROC resolved = (PFNGLENDQUERYPROC)glad_lazy_resolve(97, "glEndQuery");
+	if(glad_glEndQuery == glad_lazy_glEndQuery) glad_glEndQuery = resolved;
+	resolved(target);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	PFNGLENDTRANSFORMFEEDBACKPROC resolved = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve(98, "glEndTransformFeedback");
+	if(glad_glEndTransformFeedback == glad_lazy_glEndTransformFeedback) glad_glEndTransformFeedback = resolved;
+	resolved();
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	PFNGLFENCESYNCPROC resolved = (PFNGLFENCESYNCPROC)glad_lazy_resolve(99, "glFenceSync");
+	if(glad_glFenceSync == glad_lazy_glFenceSync) glad_glFenceSync = resolved;
+	return resolved(condition, flags);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	PFNGLFINISHPROC resolved = (PFNGLFINISHPROC)glad_lazy_resolve(100, "glFinish");
+	if(glad_glFinish == glad_lazy_glFinish) glad_glFinish = resolved;
+	resolved();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	PFNGLFLUSHPROC resolved = (PFNGLFLUSHPROC)glad_lazy_resolve(101, "glFlush");
+	if(glad_glFlush == glad_lazy_glFlush) glad_glFlush = resolved;
+	resolved();
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC resolved = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve(102, "glFlushMappedBufferRange");
+	if(glad_glFlushMappedBufferRange == glad_lazy_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = resolved;
+	resolved(target, offset, length);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC resolved = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve(103, "glFramebufferRenderbuffer");
+	if(glad_glFramebufferRenderbuffer == glad_lazy_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = resolved;
+	resolved(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	PFNGLFRAMEBUFFERTEXTUREPROC resolved = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve(104, "glFramebufferTexture");
+	if(glad_glFramebufferTexture == glad_lazy_glFramebufferTexture) glad_glFramebufferTexture = resolved;
+	resolved(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	PFNGLFRAMEBUFFERTEXTURE1DPROC resolved = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve(105, "glFramebufferTexture1D");
+	if(glad_glFramebufferTexture1D == glad_lazy_glFramebufferTexture1D) glad_glFramebufferTexture1D = resolved;
+	resolved(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	PFNGLFRAMEBUFFERTEXTURE2DPROC resolved = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve(106, "glFramebufferTexture2D");
+	if(glad_glFramebufferTexture2D == glad_lazy_glFramebufferTexture2D) glad_glFramebufferTexture2D = resolved;
+	resolved(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	PFNGLFRAMEBUFFERTEXTURE3DPROC resolved = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve(107, "glFramebufferTexture3D");
+	if(glad_glFramebufferTexture3D == glad_lazy_glFramebufferTexture3D) glad_glFramebufferTexture3D = resolved;
+	resolved(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	PFNGLFRAMEBUFFERTEXTURELAYERPROC resolved = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve(108, "glFramebufferTextureLayer");
+	if(glad_glFramebufferTextureLayer == glad_lazy_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = resolved;
+	resolved(target, attachment, texture, level, layer);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+	PFNGLFRONTFACEPROC resolved = (PFNGLFRONTFACEPROC)glad_lazy_resolve(109, "glFrontFace");
+	if(glad_glFrontFace == glad_lazy_glFrontFace) glad_glFrontFace = resolved;
+	resolved(mode);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	PFNGLGENBUFFERSPROC resolved = (PFNGLGENBUFFERSPROC)glad_lazy_resolve(110, "glGenBuffers");
+	if(glad_glGenBuffers == glad_lazy_glGenBuffers) glad_glGenBuffers = resolved;
+	resolved(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	PFNGLGENFRAMEBUFFERSPROC resolved = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve(111, "glGenFramebuffers");
+	if(glad_glGenFramebuffers == glad_lazy_glGenFramebuffers) glad_glGenFramebuffers = resolved;
+	resolved(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	PFNGLGENQUERIESPROC resolved = (PFNGLGENQUERIESPROC)glad_lazy_resolve(112, "glGenQueries");
+	if(glad_glGenQueries == glad_lazy_glGenQueries) glad_glGenQueries = resolved;
+	resolved(n, ids);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	PFNGLGENRENDERBUFFERSPROC resolved = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve(113, "glGenRenderbuffers");
+	if(glad_glGenRenderbuffers == glad_lazy_glGenRenderbuffers) glad_glGenRenderbuffers = resolved;
+	resolved(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	PFNGLGENSAMPLERSPROC resolved = (PFNGLGENSAMPLERSPROC)glad_lazy_resolve(114, "glGenSamplers");
+	if(glad_glGenSamplers == glad_lazy_glGenSamplers) glad_glGenSamplers = resolved;
+	resolved(count, samplers);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	PFNGLGENTEXTURESPROC resolved = (PFNGLGENTEXTURESPROC)glad_lazy_resolve(115, "glGenTextures");
+	if(glad_glGenTextures == glad_lazy_glGenTextures) glad_glGenTextures = resolved;
+	resolved(n, textures);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	PFNGLGENVERTEXARRAYSPROC resolved = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve(116, "glGenVertexArrays");
+	if(glad_glGenVertexArrays == glad_lazy_glGenVertexArrays) glad_glGenVertexArrays = resolved;
+	resolved(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+	PFNGLGENERATEMIPMAPPROC resolved = (PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve(117, "glGenerateMipmap");
+	if(glad_glGenerateMipmap == glad_lazy_glGenerateMipmap) glad_glGenerateMipmap = resolved;
+	resolved(target);
+}
+static void APIENTRY glad_lazy_glGenerateTextureMipmap(GLuint texture) {
+	PFNGLGENERATETEXTUREMIPMAPPROC resolved = (PFNGLGENERATETEXTUREMIPMAPPROC)glad_lazy_resolve(118, "glGenerateTextureMipmap");
+	if(glad_glGenerateTextureMipmap == glad_lazy_glGenerateTextureMipmap) glad_glGenerateTextureMipmap = resolved;
+	resolved(texture);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	PFNGLGETACTIVEATTRIBPROC resolved = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve(119, "glGetActiveAttrib");
+	if(glad_glGetActiveAttrib == glad_lazy_glGetActiveAttrib) glad_glGetActiveAttrib = resolved;
+	resolved(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	PFNGLGETACTIVEUNIFORMPROC resolved = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve(120, "glGetActiveUniform");
+	if(glad_glGetActiveUniform == glad_lazy_glGetActiveUniform) glad_glGetActiveUniform = resolved;
+	resolved(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC resolved = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve(121, "glGetActiveUniformBlockName");
+	if(glad_glGetActiveUniformBlockName == glad_lazy_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = resolved;
+	resolved(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	PFNGLGETACTIVEUNIFORMBLOCKIVPROC resolved = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve(122, "glGetActiveUniformBlockiv");
+	if(glad_glGetActiveUniformBlockiv == glad_lazy_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = resolved;
+	resolved(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	PFNGLGETACTIVEUNIFORMNAMEPROC resolved = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve(123, "glGetActiveUniformName");
+	if(glad_glGetActiveUniformName == glad_lazy_glGetActiveUniformName) glad_glGetActiveUniformName = resolved;
+	resolved(program, uniformIndex, bufSize, length, uniformName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	PFNGLGETACTIVEUNIFORMSIVPROC resolved = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve(124, "glGetActiveUniformsiv");
+	if(glad_glGetActiveUniformsiv == glad_lazy_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = resolved;
+	resolved(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	PFNGLGETATTACHEDSHADERSPROC resolved = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve(125, "glGetAttachedShaders");
+	if(glad_glGetAttachedShaders == glad_lazy_glGetAttachedShaders) glad_glGetAttachedShaders = resolved;
+	resolved(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	PFNGLGETATTRIBLOCATIONPROC resolved = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve(126, "glGetAttribLocation");
+	if(glad_glGetAttribLocation == glad_lazy_glGetAttribLocation) glad_glGetAttribLocation = resolved;
+	return resolved(program, name);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	PFNGLGETBOOLEANI_VPROC resolved = (PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve(127, "glGetBooleani_v");
+	if(glad_glGetBooleani_v == glad_lazy_glGetBooleani_v) glad_glGetBooleani_v = resolved;
+	resolved(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	PFNGLGETBOOLEANVPROC resolved = (PFNGLGETBOOLEANVPROC)glad_lazy_resolve(128, "glGetBooleanv");
+	if(glad_glGetBooleanv == glad_lazy_glGetBooleanv) glad_glGetBooleanv = resolved;
+	resolved(pname, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	PFNGLGETBUFFERPARAMETERI64VPROC resolved = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve(129, "glGetBufferParameteri64v");
+	if(glad_glGetBufferParameteri64v == glad_lazy_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETBUFFERPARAMETERIVPROC resolved = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve(130, "glGetBufferParameteriv");
+	if(glad_glGetBufferParameteriv == glad_lazy_glGetBufferParameteriv) glad_glGetBufferParameteriv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	PFNGLGETBUFFERPOINTERVPROC resolved = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve(131, "glGetBufferPointerv");
+	if(glad_glGetBufferPointerv == glad_lazy_glGetBufferPointerv) glad_glGetBufferPointerv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	PFNGLGETBUFFERSUBDATAPROC resolved = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve(132, "glGetBufferSubData");
+	if(glad_glGetBufferSubData == glad_lazy_glGetBufferSubData) glad_glGetBufferSubData = resolved;
+	resolved(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	PFNGLGETCOMPRESSEDTEXIMAGEPROC resolved = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve(133, "glGetCompressedTexImage");
+	if(glad_glGetCompressedTexImage == glad_lazy_glGetCompressedTexImage) glad_glGetCompressedTexImage = resolved;
+	resolved(target, level, img);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLogARB(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	PFNGLGETDEBUGMESSAGELOGARBPROC resolved = (PFNGLGETDEBUGMESSAGELOGARBPROC)glad_lazy_resolve(134, "glGetDebugMessageLogARB");
+	if(glad_glGetDebugMessageLogARB == glad_lazy_glGetDebugMessageLogARB) glad_glGetDebugMessageLogARB = resolved;
+	return resolved(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	PFNGLGETDOUBLEVPROC resolved = (PFNGLGETDOUBLEVPROC)glad_lazy_resolve(135, "glGetDoublev");
+	if(glad_glGetDoublev == glad_lazy_glGetDoublev) glad_glGetDoublev = resolved;
+	resolved(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	PFNGLGETERRORPROC resolved = (PFNGLGETERRORPROC)glad_lazy_resolve(136, "glGetError");
+	if(glad_glGetError == glad_lazy_glGetError) glad_glGetError = resolved;
+	return resolved();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	PFNGLGETFLOATVPROC resolved = (PFNGLGETFLOATVPROC)glad_lazy_resolve(137, "glGetFloatv");
+	if(glad_glGetFloatv == glad_lazy_glGetFloatv) glad_glGetFloatv = resolved;
+	resolved(pname, data);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	PFNGLGETFRAGDATAINDEXPROC resolved = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve(138, "glGetFragDataIndex");
+	if(glad_glGetFragDataIndex == glad_lazy_glGetFragDataIndex) glad_glGetFragDataIndex = resolved;
+	return resolved(program, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	PFNGLGETFRAGDATALOCATIONPROC resolved = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve(139, "glGetFragDataLocation");
+	if(glad_glGetFragDataLocation == glad_lazy_glGetFragDataLocation) glad_glGetFragDataLocation = resolved;
+	return resolved(program, name);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC resolved = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve(140, "glGetFramebufferAttachmentParameteriv");
+	if(glad_glGetFramebufferAttachmentParameteriv == glad_lazy_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = resolved;
+	resolved(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	PFNGLGETINTEGER64I_VPROC resolved = (PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve(141, "glGetInteger64i_v");
+	if(glad_glGetInteger64i_v == glad_lazy_glGetInteger64i_v) glad_glGetInteger64i_v = resolved;
+	resolved(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	PFNGLGETINTEGER64VPROC resolved = (PFNGLGETINTEGER64VPROC)glad_lazy_resolve(142, "glGetInteger64v");
+	if(glad_glGetInteger64v == glad_lazy_glGetInteger64v) glad_glGetInteger64v = resolved;
+	resolved(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	PFNGLGETINTEGERI_VPROC resolved = (PFNGLGETINTEGERI_VPROC)glad_lazy_resolve(143, "glGetIntegeri_v");
+	if(glad_glGetIntegeri_v == glad_lazy_glGetIntegeri_v) glad_glGetIntegeri_v = resolved;
+	resolved(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	PFNGLGETINTEGERVPROC resolved = (PFNGLGETINTEGERVPROC)glad_lazy_resolve(144, "glGetIntegerv");
+	if(glad_glGetIntegerv == glad_lazy_glGetIntegerv) glad_glGetIntegerv = resolved;
+	resolved(pname, data);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	PFNGLGETMULTISAMPLEFVPROC resolved = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve(145, "glGetMultisamplefv");
+	if(glad_glGetMultisamplefv == glad_lazy_glGetMultisamplefv) glad_glGetMultisamplefv = resolved;
+	resolved(pname, index, val);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	PFNGLGETPROGRAMBINARYPROC resolved = (PFNGLGETPROGRAMBINARYPROC)glad_lazy_resolve(146, "glGetProgramBinary");
+	if(glad_glGetProgramBinary == glad_lazy_glGetProgramBinary) glad_glGetProgramBinary = resolved;
+	resolved(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	PFNGLGETPROGRAMINFOLOGPROC resolved = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve(147, "glGetProgramInfoLog");
+	if(glad_glGetProgramInfoLog == glad_lazy_glGetProgramInfoLog) glad_glGetProgramInfoLog = resolved;
+	resolved(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	PFNGLGETPROGRAMIVPROC resolved = (PFNGLGETPROGRAMIVPROC)glad_lazy_resolve(148, "glGetProgramiv");
+	if(glad_glGetProgramiv == glad_lazy_glGetProgramiv) glad_glGetProgramiv = resolved;
+	resolved(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	PFNGLGETQUERYOBJECTI64VPROC resolved = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve(149, "glGetQueryObjecti64v");
+	if(glad_glGetQueryObjecti64v == glad_lazy_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = resolved;
+	resolved(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	PFNGLGETQUERYOBJECTIVPROC resolved = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve(150, "glGetQueryObjectiv");
+	if(glad_glGetQueryObjectiv == glad_lazy_glGetQueryObjectiv) glad_glGetQueryObjectiv = resolved;
+	resolved(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	PFNGLGETQUERYOBJECTUI64VPROC resolved = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve(151, "glGetQueryObjectui64v");
+	if(glad_glGetQueryObjectui64v == glad_lazy_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = resolved;
+	resolved(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	PFNGLGETQUERYOBJECTUIVPROC resolved = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve(152, "glGetQueryObjectuiv");
+	if(glad_glGetQueryObjectuiv == glad_lazy_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = resolved;
+	resolved(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETQUERYIVPROC resolved = (PFNGLGETQUERYIVPROC)glad_lazy_resolve(153, "glGetQueryiv");
+	if(glad_glGetQueryiv == glad_lazy_glGetQueryiv) glad_glGetQueryiv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETRENDERBUFFERPARAMETERIVPROC resolved = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve(154, "glGetRenderbufferParameteriv");
+	if(glad_glGetRenderbufferParameteriv == glad_lazy_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	PFNGLGETSAMPLERPARAMETERIIVPROC resolved = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve(155, "glGetSamplerParameterIiv");
+	if(glad_glGetSamplerParameterIiv == glad_lazy_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = resolved;
+	resolved(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	PFNGLGETSAMPLERPARAMETERIUIVPROC resolved = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve(156, "glGetSamplerParameterIuiv");
+	if(glad_glGetSamplerParameterIuiv == glad_lazy_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = resolved;
+	resolved(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	PFNGLGETSAMPLERPARAMETERFVPROC resolved = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve(157, "glGetSamplerParameterfv");
+	if(glad_glGetSamplerParameterfv == glad_lazy_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = resolved;
+	resolved(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	PFNGLGETSAMPLERPARAMETERIVPROC resolved = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve(158, "glGetSamplerParameteriv");
+	if(glad_glGetSamplerParameteriv == glad_lazy_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = resolved;
+	resolved(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	PFNGLGETSHADERINFOLOGPROC resolved = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve(159, "glGetShaderInfoLog");
+	if(glad_glGetShaderInfoLog == glad_lazy_glGetShaderInfoLog) glad_glGetShaderInfoLog = resolved;
+	resolved(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	PFNGLGETSHADERSOURCEPROC resolved = (PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve(160, "glGetShaderSource");
+	if(glad_glGetShaderSource == glad_lazy_glGetShaderSource) glad_glGetShaderSource = resolved;
+	resolved(shader, bufSize, length, source);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	PFNGLGETSHADERIVPROC resolved = (PFNGLGETSHADERIVPROC)glad_lazy_resolve(161, "glGetShaderiv");
+	if(glad_glGetShaderiv == glad_lazy_glGetShaderiv) glad_glGetShaderiv = resolved;
+	resolved(shader, pname, params);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) {
+	PFNGLGETSTRINGPROC resolved = (PFNGLGETSTRINGPROC)glad_lazy_resolve(162, "glGetString");
+	if(glad_glGetString == glad_lazy_glGetString) glad_glGetString = resolved;
+	return resolved(name);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+	PFNGLGETSTRINGIPROC resolved = (PFNGLGETSTRINGIPROC)glad_lazy_resolve(163, "glGetStringi");
+	if(glad_glGetStringi == glad_lazy_glGetStringi) glad_glGetStringi = resolved;
+	return resolved(name, index);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	PFNGLGETSYNCIVPROC resolved = (PFNGLGETSYNCIVPROC)glad_lazy_resolve(164, "glGetSynciv");
+	if(glad_glGetSynciv == glad_lazy_glGetSynciv) glad_glGetSynciv = resolved;
+	resolved(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	PFNGLGETTEXIMAGEPROC resolved = (PFNGLGETTEXIMAGEPROC)glad_lazy_resolve(165, "glGetTexImage");
+	if(glad_glGetTexImage == glad_lazy_glGetTexImage) glad_glGetTexImage = resolved;
+	resolved(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	PFNGLGETTEXLEVELPARAMETERFVPROC resolved = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve(166, "glGetTexLevelParameterfv");
+	if(glad_glGetTexLevelParameterfv == glad_lazy_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = resolved;
+	resolved(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	PFNGLGETTEXLEVELPARAMETERIVPROC resolved = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve(167, "glGetTexLevelParameteriv");
+	if(glad_glGetTexLevelParameteriv == glad_lazy_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = resolved;
+	resolved(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETTEXPARAMETERIIVPROC resolved = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve(168, "glGetTexParameterIiv");
+	if(glad_glGetTexParameterIiv == glad_lazy_glGetTexParameterIiv) glad_glGetTexParameterIiv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	PFNGLGETTEXPARAMETERIUIVPROC resolved = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve(169, "glGetTexParameterIuiv");
+	if(glad_glGetTexParameterIuiv == glad_lazy_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	PFNGLGETTEXPARAMETERFVPROC resolved = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve(170, "glGetTexParameterfv");
+	if(glad_glGetTexParameterfv == glad_lazy_glGetTexParameterfv) glad_glGetTexParameterfv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETTEXPARAMETERIVPROC resolved = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve(171, "glGetTexParameteriv");
+	if(glad_glGetTexParameteriv == glad_lazy_glGetTexParameteriv) glad_glGetTexParameteriv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	PFNGLGETTRANSFORMFEEDBACKVARYINGPROC resolved = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve(172, "glGetTransformFeedbackVarying");
+	if(glad_glGetTransformFeedbackVarying == glad_lazy_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = resolved;
+	resolved(program, index, bufSize, length, size, type, name);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	PFNGLGETUNIFORMBLOCKINDEXPROC resolved = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve(173, "glGetUniformBlockIndex");
+	if(glad_glGetUniformBlockIndex == glad_lazy_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = resolved;
+	return resolved(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	PFNGLGETUNIFORMINDICESPROC resolved = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve(174, "glGetUniformIndices");
+	if(glad_glGetUniformIndices == glad_lazy_glGetUniformIndices) glad_glGetUniformIndices = resolved;
+	resolved(program, uniformCount, uniformNames, uniformIndices);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	PFNGLGETUNIFORMLOCATIONPROC resolved = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve(175, "glGetUniformLocation");
+	if(glad_glGetUniformLocation == glad_lazy_glGetUniformLocation) glad_glGetUniformLocation = resolved;
+	return resolved(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	PFNGLGETUNIFORMFVPROC resolved = (PFNGLGETUNIFORMFVPROC)glad_lazy_resolve(176, "glGetUniformfv");
+	if(glad_glGetUniformfv == glad_lazy_glGetUniformfv) glad_glGetUniformfv = resolved;
+	resolved(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	PFNGLGETUNIFORMIVPROC resolved = (PFNGLGETUNIFORMIVPROC)glad_lazy_resolve(177, "glGetUniformiv");
+	if(glad_glGetUniformiv == glad_lazy_glGetUniformiv) glad_glGetUniformiv = resolved;
+	resolved(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	PFNGLGETUNIFORMUIVPROC resolved = (PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve(178, "glGetUniformuiv");
+	if(glad_glGetUniformuiv == glad_lazy_glGetUniformuiv) glad_glGetUniformuiv = resolved;
+	resolved(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	PFNGLGETVERTEXATTRIBIIVPROC resolved = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve(179, "glGetVertexAttribIiv");
+	if(glad_glGetVertexAttribIiv == glad_lazy_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = resolved;
+	resolved(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	PFNGLGETVERTEXATTRIBIUIVPROC resolved = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve(180, "glGetVertexAttribIuiv");
+	if(glad_glGetVertexAttribIuiv == glad_lazy_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = resolved;
+	resolved(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	PFNGLGETVERTEXATTRIBPOINTERVPROC resolved = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve(181, "glGetVertexAttribPointerv");
+	if(glad_glGetVertexAttribPointerv == glad_lazy_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = resolved;
+	resolved(index, pname, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	PFNGLGETVERTEXATTRIBDVPROC resolved = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve(182, "glGetVertexAttribdv");
+	if(glad_glGetVertexAttribdv == glad_lazy_glGetVertexAttribdv) glad_glGetVertexAttribdv = resolved;
+	resolved(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	PFNGLGETVERTEXATTRIBFVPROC resolved = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve(183, "glGetVertexAttribfv");
+	if(glad_glGetVertexAttribfv == glad_lazy_glGetVertexAttribfv) glad_glGetVertexAttribfv = resolved;
+	resolved(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	PFNGLGETVERTEXATTRIBIVPROC resolved = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve(184, "glGetVertexAttribiv");
+	if(glad_glGetVertexAttribiv == glad_lazy_glGetVertexAttribiv) glad_glGetVertexAttribiv = resolved;
+	resolved(index, pname, params);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+	PFNGLHINTPROC resolved = (PFNGLHINTPROC)glad_lazy_resolve(185, "glHint");
+	if(glad_glHint == glad_lazy_glHint) glad_glHint = resolved;
+	resolved(target, mode);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint buffer) {
+	PFNGLINVALIDATEBUFFERDATAPROC resolved = (PFNGLINVALIDATEBUFFERDATAPROC)glad_lazy_resolve(186, "glInvalidateBufferData");
+	if(glad_glInvalidateBufferData == glad_lazy_glInvalidateBufferData) glad_glInvalidateBufferData = resolved;
+	resolved(buffer);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	PFNGLINVALIDATEBUFFERSUBDATAPROC resolved = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_lazy_resolve(187, "glInvalidateBufferSubData");
+	if(glad_glInvalidateBufferSubData == glad_lazy_glInvalidateBufferSubData) glad_glInvalidateBufferSubData = resolved;
+	resolved(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	PFNGLINVALIDATEFRAMEBUFFERPROC resolved = (PFNGLINVALIDATEFRAMEBUFFERPROC)glad_lazy_resolve(188, "glInvalidateFramebuffer");
+	if(glad_glInvalidateFramebuffer == glad_lazy_glInvalidateFramebuffer) glad_glInvalidateFramebuffer = resolved;
+	resolved(target, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLINVALIDATESUBFRAMEBUFFERPROC resolved = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_lazy_resolve(189, "glInvalidateSubFramebuffer");
+	if(glad_glInvalidateSubFramebuffer == glad_lazy_glInvalidateSubFramebuffer) glad_glInvalidateSubFramebuffer = resolved;
+	resolved(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+	PFNGLINVALIDATETEXIMAGEPROC resolved = (PFNGLINVALIDATETEXIMAGEPROC)glad_lazy_resolve(190, "glInvalidateTexImage");
+	if(glad_glInvalidateTexImage == glad_lazy_glInvalidateTexImage) glad_glInvalidateTexImage = resolved;
+	resolved(texture, level);
+}
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	PFNGLINVALIDATETEXSUBIMAGEPROC resolved = (PFNGLINVALIDATETEXSUBIMAGEPROC)glad_lazy_resolve(191, "glInvalidateTexSubImage");
+	if(glad_glInvalidateTexSubImage == glad_lazy_glInvalidateTexSubImage) glad_glInvalidateTexSubImage = resolved;
+	resolved(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+	PFNGLISBUFFERPROC resolved = (PFNGLISBUFFERPROC)glad_lazy_resolve(192, "glIsBuffer");
+	if(glad_glIsBuffer == glad_lazy_glIsBuffer) glad_glIsBuffer = resolved;
+	return resolved(buffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+	PFNGLISENABLEDPROC resolved = (PFNGLISENABLEDPROC)glad_lazy_resolve(193, "glIsEnabled");
+	if(glad_glIsEnabled == glad_lazy_glIsEnabled) glad_glIsEnabled = resolved;
+	return resolved(cap);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	PFNGLISENABLEDIPROC resolved = (PFNGLISENABLEDIPROC)glad_lazy_resolve(194, "glIsEnabledi");
+	if(glad_glIsEnabledi == glad_lazy_glIsEnabledi) glad_glIsEnabledi = resolved;
+	return resolved(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+	PFNGLISFRAMEBUFFERPROC resolved = (PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve(195, "glIsFramebuffer");
+	if(glad_glIsFramebuffer == glad_lazy_glIsFramebuffer) glad_glIsFramebuffer = resolved;
+	return resolved(framebuffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+	PFNGLISPROGRAMPROC resolved = (PFNGLISPROGRAMPROC)glad_lazy_resolve(196, "glIsProgram");
+	if(glad_glIsProgram == glad_lazy_glIsProgram) glad_glIsProgram = resolved;
+	return resolved(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+	PFNGLISQUERYPROC resolved = (PFNGLISQUERYPROC)glad_lazy_resolve(197, "glIsQuery");
+	if(glad_glIsQuery == glad_lazy_glIsQuery) glad_glIsQuery = resolved;
+	return resolved(id);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	PFNGLISRENDERBUFFERPROC resolved = (PFNGLISRENDERBUFFERPROC)glad_lazy_resolve(198, "glIsRenderbuffer");
+	if(glad_glIsRenderbuffer == glad_lazy_glIsRenderbuffer) glad_glIsRenderbuffer = resolved;
+	return resolved(renderbuffer);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+	PFNGLISSAMPLERPROC resolved = (PFNGLISSAMPLERPROC)glad_lazy_resolve(199, "glIsSampler");
+	if(glad_glIsSampler == glad_lazy_glIsSampler) glad_glIsSampler = resolved;
+	return resolved(sampler);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+	PFNGLISSHADERPROC resolved = (PFNGLISSHADERPROC)glad_lazy_resolve(200, "glIsShader");
+	if(glad_glIsShader == glad_lazy_glIsShader) glad_glIsShader = resolved;
+	return resolved(shader);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+	PFNGLISSYNCPROC resolved = (PFNGLISSYNCPROC)glad_lazy_resolve(201, "glIsSync");
+	if(glad_glIsSync == glad_lazy_glIsSync) glad_glIsSync = resolved;
+	return resolved(sync);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+	PFNGLISTEXTUREPROC resolved = (PFNGLISTEXTUREPROC)glad_lazy_resolve(202, "glIsTexture");
+	if(glad_glIsTexture == glad_lazy_glIsTexture) glad_glIsTexture = resolved;
+	return resolved(texture);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+	PFNGLISVERTEXARRAYPROC resolved = (PFNGLISVERTEXARRAYPROC)glad_lazy_resolve(203, "glIsVertexArray");
+	if(glad_glIsVertexArray == glad_lazy_glIsVertexArray) glad_glIsVertexArray = resolved;
+	return resolved(array);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+	PFNGLLINEWIDTHPROC resolved = (PFNGLLINEWIDTHPROC)glad_lazy_resolve(204, "glLineWidth");
+	if(glad_glLineWidth == glad_lazy_glLineWidth) glad_glLineWidth = resolved;
+	resolved(width);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+	PFNGLLINKPROGRAMPROC resolved = (PFNGLLINKPROGRAMPROC)glad_lazy_resolve(205, "glLinkProgram");
+	if(glad_glLinkProgram == glad_lazy_glLinkProgram) glad_glLinkProgram = resolved;
+	resolved(program);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+	PFNGLLOGICOPPROC resolved = (PFNGLLOGICOPPROC)glad_lazy_resolve(206, "glLogicOp");
+	if(glad_glLogicOp == glad_lazy_glLogicOp) glad_glLogicOp = resolved;
+	resolved(opcode);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+	PFNGLMAPBUFFERPROC resolved = (PFNGLMAPBUFFERPROC)glad_lazy_resolve(207, "glMapBuffer");
+	if(glad_glMapBuffer == glad_lazy_glMapBuffer) glad_glMapBuffer = resolved;
+	return resolved(target, access);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	PFNGLMAPBUFFERRANGEPROC resolved = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve(208, "glMapBufferRange");
+	if(glad_glMapBufferRange == glad_lazy_glMapBufferRange) glad_glMapBufferRange = resolved;
+	return resolved(target, offset, length, access);
+}
+static void * APIENTRY glad_lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	PFNGLMAPNAMEDBUFFERRANGEPROC resolved = (PFNGLMAPNAMEDBUFFERRANGEPROC)glad_lazy_resolve(209, "glMapNamedBufferRange");
+	if(glad_glMapNamedBufferRange == glad_lazy_glMapNamedBufferRange) glad_glMapNamedBufferRange = resolved;
+	return resolved(buffer, offset, length, access);
+}
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsARB(GLuint count) {
+	PFNGLMAXSHADERCOMPILERTHREADSARBPROC resolved = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)glad_lazy_resolve(210, "glMaxShaderCompilerThreadsARB");
+	if(glad_glMaxShaderCompilerThreadsARB == glad_lazy_glMaxShaderCompilerThreadsARB) glad_glMaxShaderCompilerThreadsARB = resolved;
+	resolved(count);
+}
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC resolved = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glad_lazy_resolve(211, "glMaxShaderCompilerThreadsKHR");
+	if(glad_glMaxShaderCompilerThreadsKHR == glad_lazy_glMaxShaderCompilerThreadsKHR) glad_glMaxShaderCompilerThreadsKHR = resolved;
+	resolved(count);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	PFNGLMULTIDRAWARRAYSPROC resolved = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve(212, "glMultiDrawArrays");
+	if(glad_glMultiDrawArrays == glad_lazy_glMultiDrawArrays) glad_glMultiDrawArrays = resolved;
+	resolved(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	PFNGLMULTIDRAWARRAYSINDIRECTPROC resolved = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_resolve(213, "glMultiDrawArraysIndirect");
+	if(glad_glMultiDrawArraysIndirect == glad_lazy_glMultiDrawArraysIndirect) glad_glMultiDrawArraysIndirect = resolved;
+	resolved(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	PFNGLMULTIDRAWELEMENTSPROC resolved = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve(214, "glMultiDrawElements");
+	if(glad_glMultiDrawElements == glad_lazy_glMultiDrawElements) glad_glMultiDrawElements = resolved;
+	resolved(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC resolved = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve(215, "glMultiDrawElementsBaseVertex");
+	if(glad_glMultiDrawElementsBaseVertex == glad_lazy_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = resolved;
+	resolved(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	PFNGLMULTIDRAWELEMENTSINDIRECTPROC resolved = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve(216, "glMultiDrawElementsIndirect");
+	if(glad_glMultiDrawElementsIndirect == glad_lazy_glMultiDrawElementsIndirect) glad_glMultiDrawElementsIndirect = resolved;
+	resolved(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP1UIPROC resolved = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve(217, "glMultiTexCoordP1ui");
+	if(glad_glMultiTexCoordP1ui == glad_lazy_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP1UIVPROC resolved = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve(218, "glMultiTexCoordP1uiv");
+	if(glad_glMultiTexCoordP1uiv == glad_lazy_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP2UIPROC resolved = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve(219, "glMultiTexCoordP2ui");
+	if(glad_glMultiTexCoordP2ui == glad_lazy_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP2UIVPROC resolved = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve(220, "glMultiTexCoordP2uiv");
+	if(glad_glMultiTexCoordP2uiv == glad_lazy_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP3UIPROC resolved = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve(221, "glMultiTexCoordP3ui");
+	if(glad_glMultiTexCoordP3ui == glad_lazy_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP3UIVPROC resolved = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve(222, "glMultiTexCoordP3uiv");
+	if(glad_glMultiTexCoordP3uiv == glad_lazy_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP4UIPROC resolved = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve(223, "glMultiTexCoordP4ui");
+	if(glad_glMultiTexCoordP4ui == glad_lazy_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP4UIVPROC resolved = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve(224, "glMultiTexCoordP4uiv");
+	if(glad_glMultiTexCoordP4uiv == glad_lazy_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = resolved;
+	resolved(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	PFNGLNAMEDBUFFERSTORAGEPROC resolved = (PFNGLNAMEDBUFFERSTORAGEPROC)glad_lazy_resolve(225, "glNamedBufferStorage");
+	if(glad_glNamedBufferStorage == glad_lazy_glNamedBufferStorage) glad_glNamedBufferStorage = resolved;
+	resolved(buffer, size, data, flags);
+}
+static void APIENTRY glad_lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	PFNGLNAMEDBUFFERSUBDATAPROC resolved = (PFNGLNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve(226, "glNamedBufferSubData");
+	if(glad_glNamedBufferSubData == glad_lazy_glNamedBufferSubData) glad_glNamedBufferSubData = resolved;
+	resolved(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	PFNGLNORMALP3UIPROC resolved = (PFNGLNORMALP3UIPROC)glad_lazy_resolve(227, "glNormalP3ui");
+	if(glad_glNormalP3ui == glad_lazy_glNormalP3ui) glad_glNormalP3ui = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	PFNGLNORMALP3UIVPROC resolved = (PFNGLNORMALP3UIVPROC)glad_lazy_resolve(228, "glNormalP3uiv");
+	if(glad_glNormalP3uiv == glad_lazy_glNormalP3uiv) glad_glNormalP3uiv = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	PFNGLPIXELSTOREFPROC resolved = (PFNGLPIXELSTOREFPROC)glad_lazy_resolve(229, "glPixelStoref");
+	if(glad_glPixelStoref == glad_lazy_glPixelStoref) glad_glPixelStoref = resolved;
+	resolved(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+	PFNGLPIXELSTOREIPROC resolved = (PFNGLPIXELSTOREIPROC)glad_lazy_resolve(230, "glPixelStorei");
+	if(glad_glPixelStorei == glad_lazy_glPixelStorei) glad_glPixelStorei = resolved;
+	resolved(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	PFNGLPOINTPARAMETERFPROC resolved = (PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve(231, "glPointParameterf");
+	if(glad_glPointParameterf == glad_lazy_glPointParameterf) glad_glPointParameterf = resolved;
+	resolved(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	PFNGLPOINTPARAMETERFVPROC resolved = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve(232, "glPointParameterfv");
+	if(glad_glPointParameterfv == glad_lazy_glPointParameterfv) glad_glPointParameterfv = resolved;
+	resolved(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+	PFNGLPOINTPARAMETERIPROC resolved = (PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve(233, "glPointParameteri");
+	if(glad_glPointParameteri == glad_lazy_glPointParameteri) glad_glPointParameteri = resolved;
+	resolved(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	PFNGLPOINTPARAMETERIVPROC resolved = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve(234, "glPointParameteriv");
+	if(glad_glPointParameteriv == glad_lazy_glPointParameteriv) glad_glPointParameteriv = resolved;
+	resolved(pname, params);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+	PFNGLPOINTSIZEPROC resolved = (PFNGLPOINTSIZEPROC)glad_lazy_resolve(235, "glPointSize");
+	if(glad_glPointSize == glad_lazy_glPointSize) glad_glPointSize = resolved;
+	resolved(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	PFNGLPOLYGONMODEPROC resolved = (PFNGLPOLYGONMODEPROC)glad_lazy_resolve(236, "glPolygonMode");
+	if(glad_glPolygonMode == glad_lazy_glPolygonMode) glad_glPolygonMode = resolved;
+	resolved(face, mode);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	PFNGLPOLYGONOFFSETPROC resolved = (PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve(237, "glPolygonOffset");
+	if(glad_glPolygonOffset == glad_lazy_glPolygonOffset) glad_glPolygonOffset = resolved;
+	resolved(factor, units);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+	PFNGLPRIMITIVERESTARTINDEXPROC resolved = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve(238, "glPrimitiveRestartIndex");
+	if(glad_glPrimitiveRestartIndex == glad_lazy_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = resolved;
+	resolved(index);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	PFNGLPROGRAMBINARYPROC resolved = (PFNGLPROGRAMBINARYPROC)glad_lazy_resolve(239, "glProgramBinary");
+	if(glad_glProgramBinary == glad_lazy_glProgramBinary) glad_glProgramBinary = resolved;
+	resolved(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	PFNGLPROGRAMPARAMETERIPROC resolved = (PFNGLPROGRAMPARAMETERIPROC)glad_lazy_resolve(240, "glProgramParameteri");
+	if(glad_glProgramParameteri == glad_lazy_glProgramParameteri) glad_glProgramParameteri = resolved;
+	resolved(program, pname, value);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+	PFNGLPROVOKINGVERTEXPROC resolved = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve(241, "glProvokingVertex");
+	if(glad_glProvokingVertex == glad_lazy_glProvokingVertex) glad_glProvokingVertex = resolved;
+	resolved(mode);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+	PFNGLQUERYCOUNTERPROC resolved = (PFNGLQUERYCOUNTERPROC)glad_lazy_resolve(242, "glQueryCounter");
+	if(glad_glQueryCounter == glad_lazy_glQueryCounter) glad_glQueryCounter = resolved;
+	resolved(id, target);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+	PFNGLREADBUFFERPROC resolved = (PFNGLREADBUFFERPROC)glad_lazy_resolve(243, "glReadBuffer");
+	if(glad_glReadBuffer == glad_lazy_glReadBuffer) glad_glReadBuffer = resolved;
+	resolved(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	PFNGLREADPIXELSPROC resolved = (PFNGLREADPIXELSPROC)glad_lazy_resolve(244, "glReadPixels");
+	if(glad_glReadPixels == glad_lazy_glReadPixels) glad_glReadPixels = resolved;
+	resolved(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLRENDERBUFFERSTORAGEPROC resolved = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve(245, "glRenderbufferStorage");
+	if(glad_glRenderbufferStorage == glad_lazy_glRenderbufferStorage) glad_glRenderbufferStorage = resolved;
+	resolved(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC resolved = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve(246, "glRenderbufferStorageMultisample");
+	if(glad_glRenderbufferStorageMultisample == glad_lazy_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = resolved;
+	resolved(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	PFNGLSAMPLECOVERAGEPROC resolved = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve(247, "glSampleCoverage");
+	if(glad_glSampleCoverage == glad_lazy_glSampleCoverage) glad_glSampleCoverage = resolved;
+	resolved(value, invert);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	PFNGLSAMPLEMASKIPROC resolved = (PFNGLSAMPLEMASKIPROC)glad_lazy_resolve(248, "glSampleMaski");
+	if(glad_glSampleMaski == glad_lazy_glSampleMaski) glad_glSampleMaski = resolved;
+	resolved(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	PFNGLSAMPLERPARAMETERIIVPROC resolved = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve(249, "glSamplerParameterIiv");
+	if(glad_glSamplerParameterIiv == glad_lazy_glSamplerParameterIiv) glad_glSamplerParameterIiv = resolved;
+	resolved(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	PFNGLSAMPLERPARAMETERIUIVPROC resolved = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve(250, "glSamplerParameterIuiv");
+	if(glad_glSamplerParameterIuiv == glad_lazy_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = resolved;
+	resolved(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	PFNGLSAMPLERPARAMETERFPROC resolved = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve(251, "glSamplerParameterf");
+	if(glad_glSamplerParameterf == glad_lazy_glSamplerParameterf) glad_glSamplerParameterf = resolved;
+	resolved(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	PFNGLSAMPLERPARAMETERFVPROC resolved = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve(252, "glSamplerParameterfv");
+	if(glad_glSamplerParameterfv == glad_lazy_glSamplerParameterfv) glad_glSamplerParameterfv = resolved;
+	resolved(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	PFNGLSAMPLERPARAMETERIPROC resolved = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve(253, "glSamplerParameteri");
+	if(glad_glSamplerParameteri == glad_lazy_glSamplerParameteri) glad_glSamplerParameteri = resolved;
+	resolved(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	PFNGLSAMPLERPARAMETERIVPROC resolved = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve(254, "glSamplerParameteriv");
+	if(glad_glSamplerParameteriv == glad_lazy_glSamplerParameteriv) glad_glSamplerParameteriv = resolved;
+	resolved(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLSCISSORPROC resolved = (PFNGLSCISSORPROC)glad_lazy_resolve(255, "glScissor");
+	if(glad_glScissor == glad_lazy_glScissor) glad_glScissor = resolved;
+	resolved(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	PFNGLSECONDARYCOLORP3UIPROC resolved = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve(256, "glSecondaryColorP3ui");
+	if(glad_glSecondaryColorP3ui == glad_lazy_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = resolved;
+	resolved(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	PFNGLSECONDARYCOLORP3UIVPROC resolved = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve(257, "glSecondaryColorP3uiv");
+	if(glad_glSecondaryColorP3uiv == glad_lazy_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = resolved;
+	resolved(type, color);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	PFNGLSHADERSOURCEPROC resolved = (PFNGLSHADERSOURCEPROC)glad_lazy_resolve(258, "glShaderSource");
+	if(glad_glShaderSource == glad_lazy_glShaderSource) glad_glShaderSource = resolved;
+	resolved(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	PFNGLSTENCILFUNCPROC resolved = (PFNGLSTENCILFUNCPROC)glad_lazy_resolve(259, "glStencilFunc");
+	if(glad_glStencilFunc == glad_lazy_glStencilFunc) glad_glStencilFunc = resolved;
+	resolved(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	PFNGLSTENCILFUNCSEPARATEPROC resolved = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve(260, "glStencilFuncSeparate");
+	if(glad_glStencilFuncSeparate == glad_lazy_glStencilFuncSeparate) glad_glStencilFuncSeparate = resolved;
+	resolved(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+	PFNGLSTENCILMASKPROC resolved = (PFNGLSTENCILMASKPROC)glad_lazy_resolve(261, "glStencilMask");
+	if(glad_glStencilMask == glad_lazy_glStencilMask) glad_glStencilMask = resolved;
+	resolved(mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	PFNGLSTENCILMASKSEPARATEPROC resolved = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve(262, "glStencilMaskSeparate");
+	if(glad_glStencilMaskSeparate == glad_lazy_glStencilMaskSeparate) glad_glStencilMaskSeparate = resolved;
+	resolved(face, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	PFNGLSTENCILOPPROC resolved = (PFNGLSTENCILOPPROC)glad_lazy_resolve(263, "glStencilOp");
+	if(glad_glStencilOp == glad_lazy_glStencilOp) glad_glStencilOp = resolved;
+	resolved(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	PFNGLSTENCILOPSEPARATEPROC resolved = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve(264, "glStencilOpSeparate");
+	if(glad_glStencilOpSeparate == glad_lazy_glStencilOpSeparate) glad_glStencilOpSeparate = resolved;
+	resolved(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	PFNGLTEXBUFFERPROC resolved = (PFNGLTEXBUFFERPROC)glad_lazy_resolve(265, "glTexBuffer");
+	if(glad_glTexBuffer == glad_lazy_glTexBuffer) glad_glTexBuffer = resolved;
+	resolved(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP1UIPROC resolved = (PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve(266, "glTexCoordP1ui");
+	if(glad_glTexCoordP1ui == glad_lazy_glTexCoordP1ui) glad_glTexCoordP1ui = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP1UIVPROC resolved = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve(267, "glTexCoordP1uiv");
+	if(glad_glTexCoordP1uiv == glad_lazy_glTexCoordP1uiv) glad_glTexCoordP1uiv = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP2UIPROC resolved = (PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve(268, "glTexCoordP2ui");
+	if(glad_glTexCoordP2ui == glad_lazy_glTexCoordP2ui) glad_glTexCoordP2ui = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP2UIVPROC resolved = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve(269, "glTexCoordP2uiv");
+	if(glad_glTexCoordP2uiv == glad_lazy_glTexCoordP2uiv) glad_glTexCoordP2uiv = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP3UIPROC resolved = (PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve(270, "glTexCoordP3ui");
+	if(glad_glTexCoordP3ui == glad_lazy_glTexCoordP3ui) glad_glTexCoordP3ui = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP3UIVPROC resolved = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve(271, "glTexCoordP3uiv");
+	if(glad_glTexCoordP3uiv == glad_lazy_glTexCoordP3uiv) glad_glTexCoordP3uiv = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP4UIPROC resolved = (PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve(272, "glTexCoordP4ui");
+	if(glad_glTexCoordP4ui == glad_lazy_glTexCoordP4ui) glad_glTexCoordP4ui = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP4UIVPROC resolved = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve(273, "glTexCoordP4uiv");
+	if(glad_glTexCoordP4uiv == glad_lazy_glTexCoordP4uiv) glad_glTexCoordP4uiv = resolved;
+	resolved(type, coords);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXIMAGE1DPROC resolved = (PFNGLTEXIMAGE1DPROC)glad_lazy_resolve(274, "glTexImage1D");
+	if(glad_glTexImage1D == glad_lazy_glTexImage1D) glad_glTexImage1D = resolved;
+	resolved(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXIMAGE2DPROC resolved = (PFNGLTEXIMAGE2DPROC)glad_lazy_resolve(275, "glTexImage2D");
+	if(glad_glTexImage2D == glad_lazy_glTexImage2D) glad_glTexImage2D = resolved;
+	resolved(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC resolved = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve(276, "glTexImage2DMultisample");
+	if(glad_glTexImage2DMultisample == glad_lazy_glTexImage2DMultisample) glad_glTexImage2DMultisample = resolved;
+	resolved(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXIMAGE3DPROC resolved = (PFNGLTEXIMAGE3DPROC)glad_lazy_resolve(277, "glTexImage3D");
+	if(glad_glTexImage3D == glad_lazy_glTexImage3D) glad_glTexImage3D = resolved;
+	resolved(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	PFNGLTEXIMAGE3DMULTISAMPLEPROC resolved = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve(278, "glTexImage3DMultisample");
+	if(glad_glTexImage3DMultisample == glad_lazy_glTexImage3DMultisample) glad_glTexImage3DMultisample = resolved;
+	resolved(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	PFNGLTEXPARAMETERIIVPROC resolved = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve(279, "glTexParameterIiv");
+	if(glad_glTexParameterIiv == glad_lazy_glTexParameterIiv) glad_glTexParameterIiv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	PFNGLTEXPARAMETERIUIVPROC resolved = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve(280, "glTexParameterIuiv");
+	if(glad_glTexParameterIuiv == glad_lazy_glTexParameterIuiv) glad_glTexParameterIuiv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	PFNGLTEXPARAMETERFPROC resolved = (PFNGLTEXPARAMETERFPROC)glad_lazy_resolve(281, "glTexParameterf");
+	if(glad_glTexParameterf == glad_lazy_glTexParameterf) glad_glTexParameterf = resolved;
+	resolved(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	PFNGLTEXPARAMETERFVPROC resolved = (PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve(282, "glTexParameterfv");
+	if(glad_glTexParameterfv == glad_lazy_glTexParameterfv) glad_glTexParameterfv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	PFNGLTEXPARAMETERIPROC resolved = (PFNGLTEXPARAMETERIPROC)glad_lazy_resolve(283, "glTexParameteri");
+	if(glad_glTexParameteri == glad_lazy_glTexParameteri) glad_glTexParameteri = resolved;
+	resolved(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	PFNGLTEXPARAMETERIVPROC resolved = (PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve(284, "glTexParameteriv");
+	if(glad_glTexParameteriv == glad_lazy_glTexParameteriv) glad_glTexParameteriv = resolved;
+	resolved(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	PFNGLTEXSTORAGE1DPROC resolved = (PFNGLTEXSTORAGE1DPROC)glad_lazy_resolve(285, "glTexStorage1D");
+	if(glad_glTexStorage1D == glad_lazy_glTexStorage1D) glad_glTexStorage1D = resolved;
+	resolved(target, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLTEXSTORAGE2DPROC resolved = (PFNGLTEXSTORAGE2DPROC)glad_lazy_resolve(286, "glTexStorage2D");
+	if(glad_glTexStorage2D == glad_lazy_glTexStorage2D) glad_glTexStorage2D = resolved;
+	resolved(target, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	PFNGLTEXSTORAGE3DPROC resolved = (PFNGLTEXSTORAGE3DPROC)glad_lazy_resolve(287, "glTexStorage3D");
+	if(glad_glTexStorage3D == glad_lazy_glTexStorage3D) glad_glTexStorage3D = resolved;
+	resolved(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXSUBIMAGE1DPROC resolved = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve(288, "glTexSubImage1D");
+	if(glad_glTexSubImage1D == glad_lazy_glTexSubImage1D) glad_glTexSubImage1D = resolved;
+	resolved(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXSUBIMAGE2DPROC resolved = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve(289, "glTexSubImage2D");
+	if(glad_glTexSubImage2D == glad_lazy_glTexSubImage2D) glad_glTexSubImage2D = resolved;
+	resolved(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXSUBIMAGE3DPROC resolved = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve(290, "glTexSubImage3D");
+	if(glad_glTexSubImage3D == glad_lazy_glTexSubImage3D) glad_glTexSubImage3D = resolved;
+	resolved(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	PFNGLTEXTUREPARAMETERIPROC resolved = (PFNGLTEXTUREPARAMETERIPROC)glad_lazy_resolve(291, "glTextureParameteri");
+	if(glad_glTextureParameteri == glad_lazy_glTextureParameteri) glad_glTextureParameteri = resolved;
+	resolved(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLTEXTURESTORAGE2DPROC resolved = (PFNGLTEXTURESTORAGE2DPROC)glad_lazy_resolve(292, "glTextureStorage2D");
+	if(glad_glTextureStorage2D == glad_lazy_glTextureStorage2D) glad_glTextureStorage2D = resolved;
+	resolved(texture, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXTURESUBIMAGE2DPROC resolved = (PFNGLTEXTURESUBIMAGE2DPROC)glad_lazy_resolve(293, "glTextureSubImage2D");
+	if(glad_glTextureSubImage2D == glad_lazy_glTextureSubImage2D) glad_glTextureSubImage2D = resolved;
+	resolved(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	PFNGLTRANSFORMFEEDBACKVARYINGSPROC resolved = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve(294, "glTransformFeedbackVaryings");
+	if(glad_glTransformFeedbackVaryings == glad_lazy_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = resolved;
+	resolved(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+	PFNGLUNIFORM1FPROC resolved = (PFNGLUNIFORM1FPROC)glad_lazy_resolve(295, "glUniform1f");
+	if(glad_glUniform1f == glad_lazy_glUniform1f) glad_glUniform1f = resolved;
+	resolved(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM1FVPROC resolved = (PFNGLUNIFORM1FVPROC)glad_lazy_resolve(296, "glUniform1fv");
+	if(glad_glUniform1fv == glad_lazy_glUniform1fv) glad_glUniform1fv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+	PFNGLUNIFORM1IPROC resolved = (PFNGLUNIFORM1IPROC)glad_lazy_resolve(297, "glUniform1i");
+	if(glad_glUniform1i == glad_lazy_glUniform1i) glad_glUniform1i = resolved;
+	resolved(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM1IVPROC resolved = (PFNGLUNIFORM1IVPROC)glad_lazy_resolve(298, "glUniform1iv");
+	if(glad_glUniform1iv == glad_lazy_glUniform1iv) glad_glUniform1iv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+	PFNGLUNIFORM1UIPROC resolved = (PFNGLUNIFORM1UIPROC)glad_lazy_resolve(299, "glUniform1ui");
+	if(glad_glUniform1ui == glad_lazy_glUniform1ui) glad_glUniform1ui = resolved;
+	resolved(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM1UIVPROC resolved = (PFNGLUNIFORM1UIVPROC)glad_lazy_resolve(300, "glUniform1uiv");
+	if(glad_glUniform1uiv == glad_lazy_glUniform1uiv) glad_glUniform1uiv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	PFNGLUNIFORM2FPROC resolved = (PFNGLUNIFORM2FPROC)glad_lazy_resolve(301, "glUniform2f");
+	if(glad_glUniform2f == glad_lazy_glUniform2f) glad_glUniform2f = resolved;
+	resolved(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM2FVPROC resolved = (PFNGLUNIFORM2FVPROC)glad_lazy_resolve(302, "glUniform2fv");
+	if(glad_glUniform2fv == glad_lazy_glUniform2fv) glad_glUniform2fv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	PFNGLUNIFORM2IPROC resolved = (PFNGLUNIFORM2IPROC)glad_lazy_resolve(303, "glUniform2i");
+	if(glad_glUniform2i == glad_lazy_glUniform2i) glad_glUniform2i = resolved;
+	resolved(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM2IVPROC resolved = (PFNGLUNIFORM2IVPROC)glad_lazy_resolve(304, "glUniform2iv");
+	if(glad_glUniform2iv == glad_lazy_glUniform2iv) glad_glUniform2iv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	PFNGLUNIFORM2UIPROC resolved = (PFNGLUNIFORM2UIPROC)glad_lazy_resolve(305, "glUniform2ui");
+	if(glad_glUniform2ui == glad_lazy_glUniform2ui) glad_glUniform2ui = resolved;
+	resolved(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM2UIVPROC resolved = (PFNGLUNIFORM2UIVPROC)glad_lazy_resolve(306, "glUniform2uiv");
+	if(glad_glUniform2uiv == glad_lazy_glUniform2uiv) glad_glUniform2uiv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	PFNGLUNIFORM3FPROC resolved = (PFNGLUNIFORM3FPROC)glad_lazy_resolve(307, "glUniform3f");
+	if(glad_glUniform3f == glad_lazy_glUniform3f) glad_glUniform3f = resolved;
+	resolved(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM3FVPROC resolved = (PFNGLUNIFORM3FVPROC)glad_lazy_resolve(308, "glUniform3fv");
+	if(glad_glUniform3fv == glad_lazy_glUniform3fv) glad_glUniform3fv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	PFNGLUNIFORM3IPROC resolved = (PFNGLUNIFORM3IPROC)glad_lazy_resolve(309, "glUniform3i");
+	if(glad_glUniform3i == glad_lazy_glUniform3i) glad_glUniform3i = resolved;
+	resolved(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM3IVPROC resolved = (PFNGLUNIFORM3IVPROC)glad_lazy_resolve(310, "glUniform3iv");
+	if(glad_glUniform3iv == glad_lazy_glUniform3iv) glad_glUniform3iv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	PFNGLUNIFORM3UIPROC resolved = (PFNGLUNIFORM3UIPROC)glad_lazy_resolve(311, "glUniform3ui");
+	if(glad_glUniform3ui == glad_lazy_glUniform3ui) glad_glUniform3ui = resolved;
+	resolved(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM3UIVPROC resolved = (PFNGLUNIFORM3UIVPROC)glad_lazy_resolve(312, "glUniform3uiv");
+	if(glad_glUniform3uiv == glad_lazy_glUniform3uiv) glad_glUniform3uiv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	PFNGLUNIFORM4FPROC resolved = (PFNGLUNIFORM4FPROC)glad_lazy_resolve(313, "glUniform4f");
+	if(glad_glUniform4f == glad_lazy_glUniform4f) glad_glUniform4f = resolved;
+	resolved(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM4FVPROC resolved = (PFNGLUNIFORM4FVPROC)glad_lazy_resolve(314, "glUniform4fv");
+	if(glad_glUniform4fv == glad_lazy_glUniform4fv) glad_glUniform4fv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	PFNGLUNIFORM4IPROC resolved = (PFNGLUNIFORM4IPROC)glad_lazy_resolve(315, "glUniform4i");
+	if(glad_glUniform4i == glad_lazy_glUniform4i) glad_glUniform4i = resolved;
+	resolved(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM4IVPROC resolved = (PFNGLUNIFORM4IVPROC)glad_lazy_resolve(316, "glUniform4iv");
+	if(glad_glUniform4iv == glad_lazy_glUniform4iv) glad_glUniform4iv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	PFNGLUNIFORM4UIPROC resolved = (PFNGLUNIFORM4UIPROC)glad_lazy_resolve(317, "glUniform4ui");
+	if(glad_glUniform4ui == glad_lazy_glUniform4ui) glad_glUniform4ui = resolved;
+	resolved(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM4UIVPROC resolved = (PFNGLUNIFORM4UIVPROC)glad_lazy_resolve(318, "glUniform4uiv");
+	if(glad_glUniform4uiv == glad_lazy_glUniform4uiv) glad_glUniform4uiv = resolved;
+	resolved(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	PFNGLUNIFORMBLOCKBINDINGPROC resolved = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve(319, "glUniformBlockBinding");
+	if(glad_glUniformBlockBinding == glad_lazy_glUniformBlockBinding) glad_glUniformBlockBinding = resolved;
+	resolved(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX2FVPROC resolved = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve(320, "glUniformMatrix2fv");
+	if(glad_glUniformMatrix2fv == glad_lazy_glUniformMatrix2fv) glad_glUniformMatrix2fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX2X3FVPROC resolved = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve(321, "glUniformMatrix2x3fv");
+	if(glad_glUniformMatrix2x3fv == glad_lazy_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX2X4FVPROC resolved = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve(322, "glUniformMatrix2x4fv");
+	if(glad_glUniformMatrix2x4fv == glad_lazy_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX3FVPROC resolved = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve(323, "glUniformMatrix3fv");
+	if(glad_glUniformMatrix3fv == glad_lazy_glUniformMatrix3fv) glad_glUniformMatrix3fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX3X2FVPROC resolved = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve(324, "glUniformMatrix3x2fv");
+	if(glad_glUniformMatrix3x2fv == glad_lazy_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX3X4FVPROC resolved = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve(325, "glUniformMatrix3x4fv");
+	if(glad_glUniformMatrix3x4fv == glad_lazy_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX4FVPROC resolved = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve(326, "glUniformMatrix4fv");
+	if(glad_glUniformMatrix4fv == glad_lazy_glUniformMatrix4fv) glad_glUniformMatrix4fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX4X2FVPROC resolved = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve(327, "glUniformMatrix4x2fv");
+	if(glad_glUniformMatrix4x2fv == glad_lazy_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX4X3FVPROC resolved = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve(328, "glUniformMatrix4x3fv");
+	if(glad_glUniformMatrix4x3fv == glad_lazy_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = resolved;
+	resolved(location, count, transpose, value);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+	PFNGLUNMAPBUFFERPROC resolved = (PFNGLUNMAPBUFFERPROC)glad_lazy_resolve(329, "glUnmapBuffer");
+	if(glad_glUnmapBuffer == glad_lazy_glUnmapBuffer) glad_glUnmapBuffer = resolved;
+	return resolved(target);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapNamedBuffer(GLuint buffer) {
+	PFNGLUNMAPNAMEDBUFFERPROC resolved = (PFNGLUNMAPNAMEDBUFFERPROC)glad_lazy_resolve(330, "glUnmapNamedBuffer");
+	if(glad_glUnmapNamedBuffer == glad_lazy_glUnmapNamedBuffer) glad_glUnmapNamedBuffer = resolved;
+	return resolved(buffer);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+	PFNGLUSEPROGRAMPROC resolved = (PFNGLUSEPROGRAMPROC)glad_lazy_resolve(331, "glUseProgram");
+	if(glad_glUseProgram == glad_lazy_glUseProgram) glad_glUseProgram = resolved;
+	resolved(program);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+	PFNGLVALIDATEPROGRAMPROC resolved = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve(332, "glValidateProgram");
+	if(glad_glValidateProgram == glad_lazy_glValidateProgram) glad_glValidateProgram = resolved;
+	resolved(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	PFNGLVERTEXATTRIB1DPROC resolved = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve(333, "glVertexAttrib1d");
+	if(glad_glVertexAttrib1d == glad_lazy_glVertexAttrib1d) glad_glVertexAttrib1d = resolved;
+	resolved(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB1DVPROC resolved = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve(334, "glVertexAttrib1dv");
+	if(glad_glVertexAttrib1dv == glad_lazy_glVertexAttrib1dv) glad_glVertexAttrib1dv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	PFNGLVERTEXATTRIB1FPROC resolved = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve(335, "glVertexAttrib1f");
+	if(glad_glVertexAttrib1f == glad_lazy_glVertexAttrib1f) glad_glVertexAttrib1f = resolved;
+	resolved(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB1FVPROC resolved = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve(336, "glVertexAttrib1fv");
+	if(glad_glVertexAttrib1fv == glad_lazy_glVertexAttrib1fv) glad_glVertexAttrib1fv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	PFNGLVERTEXATTRIB1SPROC resolved = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve(337, "glVertexAttrib1s");
+	if(glad_glVertexAttrib1s == glad_lazy_glVertexAttrib1s) glad_glVertexAttrib1s = resolved;
+	resolved(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB1SVPROC resolved = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve(338, "glVertexAttrib1sv");
+	if(glad_glVertexAttrib1sv == glad_lazy_glVertexAttrib1sv) glad_glVertexAttrib1sv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	PFNGLVERTEXATTRIB2DPROC resolved = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve(339, "glVertexAttrib2d");
+	if(glad_glVertexAttrib2d == glad_lazy_glVertexAttrib2d) glad_glVertexAttrib2d = resolved;
+	resolved(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB2DVPROC resolved = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve(340, "glVertexAttrib2dv");
+	if(glad_glVertexAttrib2dv == glad_lazy_glVertexAttrib2dv) glad_glVertexAttrib2dv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	PFNGLVERTEXATTRIB2FPROC resolved = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve(341, "glVertexAttrib2f");
+	if(glad_glVertexAttrib2f == glad_lazy_glVertexAttrib2f) glad_glVertexAttrib2f = resolved;
+	resolved(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB2FVPROC resolved = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve(342, "glVertexAttrib2fv");
+	if(glad_glVertexAttrib2fv == glad_lazy_glVertexAttrib2fv) glad_glVertexAttrib2fv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	PFNGLVERTEXATTRIB2SPROC resolved = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve(343, "glVertexAttrib2s");
+	if(glad_glVertexAttrib2s == glad_lazy_glVertexAttrib2s) glad_glVertexAttrib2s = resolved;
+	resolved(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB2SVPROC resolved = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve(344, "glVertexAttrib2sv");
+	if(glad_glVertexAttrib2sv == glad_lazy_glVertexAttrib2sv) glad_glVertexAttrib2sv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	PFNGLVERTEXATTRIB3DPROC resolved = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve(345, "glVertexAttrib3d");
+	if(glad_glVertexAttrib3d == glad_lazy_glVertexAttrib3d) glad_glVertexAttrib3d = resolved;
+	resolved(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB3DVPROC resolved = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve(346, "glVertexAttrib3dv");
+	if(glad_glVertexAttrib3dv == glad_lazy_glVertexAttrib3dv) glad_glVertexAttrib3dv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	PFNGLVERTEXATTRIB3FPROC resolved = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve(347, "glVertexAttrib3f");
+	if(glad_glVertexAttrib3f == glad_lazy_glVertexAttrib3f) glad_glVertexAttrib3f = resolved;
+	resolved(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB3FVPROC resolved = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve(348, "glVertexAttrib3fv");
+	if(glad_glVertexAttrib3fv == glad_lazy_glVertexAttrib3fv) glad_glVertexAttrib3fv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	PFNGLVERTEXATTRIB3SPROC resolved = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve(349, "glVertexAttrib3s");
+	if(glad_glVertexAttrib3s == glad_lazy_glVertexAttrib3s) glad_glVertexAttrib3s = resolved;
+	resolved(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB3SVPROC resolved = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve(350, "glVertexAttrib3sv");
+	if(glad_glVertexAttrib3sv == glad_lazy_glVertexAttrib3sv) glad_glVertexAttrib3sv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	PFNGLVERTEXATTRIB4NBVPROC resolved = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve(351, "glVertexAttrib4Nbv");
+	if(glad_glVertexAttrib4Nbv == glad_lazy_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIB4NIVPROC resolved = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve(352, "glVertexAttrib4Niv");
+	if(glad_glVertexAttrib4Niv == glad_lazy_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB4NSVPROC resolved = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve(353, "glVertexAttrib4Nsv");
+	if(glad_glVertexAttrib4Nsv == glad_lazy_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	PFNGLVERTEXATTRIB4NUBPROC resolved = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve(354, "glVertexAttrib4Nub");
+	if(glad_glVertexAttrib4Nub == glad_lazy_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = resolved;
+	resolved(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	PFNGLVERTEXATTRIB4NUBVPROC resolved = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve(355, "glVertexAttrib4Nubv");
+	if(glad_glVertexAttrib4Nubv == glad_lazy_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIB4NUIVPROC resolved = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve(356, "glVertexAttrib4Nuiv");
+	if(glad_glVertexAttrib4Nuiv == glad_lazy_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	PFNGLVERTEXATTRIB4NUSVPROC resolved = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve(357, "glVertexAttrib4Nusv");
+	if(glad_glVertexAttrib4Nusv == glad_lazy_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	PFNGLVERTEXATTRIB4BVPROC resolved = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve(358, "glVertexAttrib4bv");
+	if(glad_glVertexAttrib4bv == glad_lazy_glVertexAttrib4bv) glad_glVertexAttrib4bv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	PFNGLVERTEXATTRIB4DPROC resolved = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve(359, "glVertexAttrib4d");
+	if(glad_glVertexAttrib4d == glad_lazy_glVertexAttrib4d) glad_glVertexAttrib4d = resolved;
+	resolved(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB4DVPROC resolved = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve(360, "glVertexAttrib4dv");
+	if(glad_glVertexAttrib4dv == glad_lazy_glVertexAttrib4dv) glad_glVertexAttrib4dv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	PFNGLVERTEXATTRIB4FPROC resolved = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve(361, "glVertexAttrib4f");
+	if(glad_glVertexAttrib4f == glad_lazy_glVertexAttrib4f) glad_glVertexAttrib4f = resolved;
+	resolved(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB4FVPROC resolved = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve(362, "glVertexAttrib4fv");
+	if(glad_glVertexAttrib4fv == glad_lazy_glVertexAttrib4fv) glad_glVertexAttrib4fv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIB4IVPROC resolved = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve(363, "glVertexAttrib4iv");
+	if(glad_glVertexAttrib4iv == glad_lazy_glVertexAttrib4iv) glad_glVertexAttrib4iv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	PFNGLVERTEXATTRIB4SPROC resolved = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve(364, "glVertexAttrib4s");
+	if(glad_glVertexAttrib4s == glad_lazy_glVertexAttrib4s) glad_glVertexAttrib4s = resolved;
+	resolved(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB4SVPROC resolved = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve(365, "glVertexAttrib4sv");
+	if(glad_glVertexAttrib4sv == glad_lazy_glVertexAttrib4sv) glad_glVertexAttrib4sv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	PFNGLVERTEXATTRIB4UBVPROC resolved = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve(366, "glVertexAttrib4ubv");
+	if(glad_glVertexAttrib4ubv == glad_lazy_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIB4UIVPROC resolved = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve(367, "glVertexAttrib4uiv");
+	if(glad_glVertexAttrib4uiv == glad_lazy_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	PFNGLVERTEXATTRIB4USVPROC resolved = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve(368, "glVertexAttrib4usv");
+	if(glad_glVertexAttrib4usv == glad_lazy_glVertexAttrib4usv) glad_glVertexAttrib4usv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	PFNGLVERTEXATTRIBDIVISORPROC resolved = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve(369, "glVertexAttribDivisor");
+	if(glad_glVertexAttribDivisor == glad_lazy_glVertexAttribDivisor) glad_glVertexAttribDivisor = resolved;
+	resolved(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	PFNGLVERTEXATTRIBI1IPROC resolved = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve(370, "glVertexAttribI1i");
+	if(glad_glVertexAttribI1i == glad_lazy_glVertexAttribI1i) glad_glVertexAttribI1i = resolved;
+	resolved(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI1IVPROC resolved = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve(371, "glVertexAttribI1iv");
+	if(glad_glVertexAttribI1iv == glad_lazy_glVertexAttribI1iv) glad_glVertexAttribI1iv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	PFNGLVERTEXATTRIBI1UIPROC resolved = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve(372, "glVertexAttribI1ui");
+	if(glad_glVertexAttribI1ui == glad_lazy_glVertexAttribI1ui) glad_glVertexAttribI1ui = resolved;
+	resolved(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI1UIVPROC resolved = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve(373, "glVertexAttribI1uiv");
+	if(glad_glVertexAttribI1uiv == glad_lazy_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	PFNGLVERTEXATTRIBI2IPROC resolved = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve(374, "glVertexAttribI2i");
+	if(glad_glVertexAttribI2i == glad_lazy_glVertexAttribI2i) glad_glVertexAttribI2i = resolved;
+	resolved(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI2IVPROC resolved = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve(375, "glVertexAttribI2iv");
+	if(glad_glVertexAttribI2iv == glad_lazy_glVertexAttribI2iv) glad_glVertexAttribI2iv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	PFNGLVERTEXATTRIBI2UIPROC resolved = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve(376, "glVertexAttribI2ui");
+	if(glad_glVertexAttribI2ui == glad_lazy_glVertexAttribI2ui) glad_glVertexAttribI2ui = resolved;
+	resolved(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI2UIVPROC resolved = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve(377, "glVertexAttribI2uiv");
+	if(glad_glVertexAttribI2uiv == glad_lazy_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	PFNGLVERTEXATTRIBI3IPROC resolved = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve(378, "glVertexAttribI3i");
+	if(glad_glVertexAttribI3i == glad_lazy_glVertexAttribI3i) glad_glVertexAttribI3i = resolved;
+	resolved(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI3IVPROC resolved = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve(379, "glVertexAttribI3iv");
+	if(glad_glVertexAttribI3iv == glad_lazy_glVertexAttribI3iv) glad_glVertexAttribI3iv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	PFNGLVERTEXATTRIBI3UIPROC resolved = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve(380, "glVertexAttribI3ui");
+	if(glad_glVertexAttribI3ui == glad_lazy_glVertexAttribI3ui) glad_glVertexAttribI3ui = resolved;
+	resolved(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI3UIVPROC resolved = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve(381, "glVertexAttribI3uiv");
+	if(glad_glVertexAttribI3uiv == glad_lazy_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	PFNGLVERTEXATTRIBI4BVPROC resolved = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve(382, "glVertexAttribI4bv");
+	if(glad_glVertexAttribI4bv == glad_lazy_glVertexAttribI4bv) glad_glVertexAttribI4bv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	PFNGLVERTEXATTRIBI4IPROC resolved = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve(383, "glVertexAttribI4i");
+	if(glad_glVertexAttribI4i == glad_lazy_glVertexAttribI4i) glad_glVertexAttribI4i = resolved;
+	resolved(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI4IVPROC resolved = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve(384, "glVertexAttribI4iv");
+	if(glad_glVertexAttribI4iv == glad_lazy_glVertexAttribI4iv) glad_glVertexAttribI4iv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIBI4SVPROC resolved = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve(385, "glVertexAttribI4sv");
+	if(glad_glVertexAttribI4sv == glad_lazy_glVertexAttribI4sv) glad_glVertexAttribI4sv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	PFNGLVERTEXATTRIBI4UBVPROC resolved = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve(386, "glVertexAttribI4ubv");
+	if(glad_glVertexAttribI4ubv == glad_lazy_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	PFNGLVERTEXATTRIBI4UIPROC resolved = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve(387, "glVertexAttribI4ui");
+	if(glad_glVertexAttribI4ui == glad_lazy_glVertexAttribI4ui) glad_glVertexAttribI4ui = resolved;
+	resolved(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI4UIVPROC resolved = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve(388, "glVertexAttribI4uiv");
+	if(glad_glVertexAttribI4uiv == glad_lazy_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	PFNGLVERTEXATTRIBI4USVPROC resolved = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve(389, "glVertexAttribI4usv");
+	if(glad_glVertexAttribI4usv == glad_lazy_glVertexAttribI4usv) glad_glVertexAttribI4usv = resolved;
+	resolved(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	PFNGLVERTEXATTRIBIPOINTERPROC resolved = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve(390, "glVertexAttribIPointer");
+	if(glad_glVertexAttribIPointer == glad_lazy_glVertexAttribIPointer) glad_glVertexAttribIPointer = resolved;
+	resolved(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP1UIPROC resolved = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve(391, "glVertexAttribP1ui");
+	if(glad_glVertexAttribP1ui == glad_lazy_glVertexAttribP1ui) glad_glVertexAttribP1ui = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP1UIVPROC resolved = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve(392, "glVertexAttribP1uiv");
+	if(glad_glVertexAttribP1uiv == glad_lazy_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP2UIPROC resolved = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve(393, "glVertexAttribP2ui");
+	if(glad_glVertexAttribP2ui == glad_lazy_glVertexAttribP2ui) glad_glVertexAttribP2ui = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP2UIVPROC resolved = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve(394, "glVertexAttribP2uiv");
+	if(glad_glVertexAttribP2uiv == glad_lazy_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP3UIPROC resolved = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve(395, "glVertexAttribP3ui");
+	if(glad_glVertexAttribP3ui == glad_lazy_glVertexAttribP3ui) glad_glVertexAttribP3ui = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP3UIVPROC resolved = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve(396, "glVertexAttribP3uiv");
+	if(glad_glVertexAttribP3uiv == glad_lazy_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP4UIPROC resolved = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve(397, "glVertexAttribP4ui");
+	if(glad_glVertexAttribP4ui == glad_lazy_glVertexAttribP4ui) glad_glVertexAttribP4ui = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP4UIVPROC resolved = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve(398, "glVertexAttribP4uiv");
+	if(glad_glVertexAttribP4uiv == glad_lazy_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = resolved;
+	resolved(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	PFNGLVERTEXATTRIBPOINTERPROC resolved = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve(399, "glVertexAttribPointer");
+	if(glad_glVertexAttribPointer == glad_lazy_glVertexAttribPointer) glad_glVertexAttribPointer = resolved;
+	resolved(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+	PFNGLVERTEXP2UIPROC resolved = (PFNGLVERTEXP2UIPROC)glad_lazy_resolve(400, "glVertexP2ui");
+	if(glad_glVertexP2ui == glad_lazy_glVertexP2ui) glad_glVertexP2ui = resolved;
+	resolved(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	PFNGLVERTEXP2UIVPROC resolved = (PFNGLVERTEXP2UIVPROC)glad_lazy_resolve(401, "glVertexP2uiv");
+	if(glad_glVertexP2uiv == glad_lazy_glVertexP2uiv) glad_glVertexP2uiv = resolved;
+	resolved(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+	PFNGLVERTEXP3UIPROC resolved = (PFNGLVERTEXP3UIPROC)glad_lazy_resolve(402, "glVertexP3ui");
+	if(glad_glVertexP3ui == glad_lazy_glVertexP3ui) glad_glVertexP3ui = resolved;
+	resolved(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	PFNGLVERTEXP3UIVPROC resolved = (PFNGLVERTEXP3UIVPROC)glad_lazy_resolve(403, "glVertexP3uiv");
+	if(glad_glVertexP3uiv == glad_lazy_glVertexP3uiv) glad_glVertexP3uiv = resolved;
+	resolved(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+	PFNGLVERTEXP4UIPROC resolved = (PFNGLVERTEXP4UIPROC)glad_lazy_resolve(404, "glVertexP4ui");
+	if(glad_glVertexP4ui == glad_lazy_glVertexP4ui) glad_glVertexP4ui = resolved;
+	resolved(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	PFNGLVERTEXP4UIVPROC resolved = (PFNGLVERTEXP4UIVPROC)glad_lazy_resolve(405, "glVertexP4uiv");
+	if(glad_glVertexP4uiv == glad_lazy_glVertexP4uiv) glad_glVertexP4uiv = resolved;
+	resolved(type, value);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLVIEWPORTPROC resolved = (PFNGLVIEWPORTPROC)glad_lazy_resolve(406, "glViewport");
+	if(glad_glViewport == glad_lazy_glViewport) glad_glViewport = resolved;
+	resolved(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	PFNGLWAITSYNCPROC resolved = (PFNGLWAITSYNCPROC)glad_lazy_resolve(407, "glWaitSync");
+	if(glad_glWaitSync == glad_lazy_glWaitSync) glad_glWaitSync = resolved;
+	resolved(sync, flags, timeout);
+}
+
+typedef struct {
+    const char *name;
+    void *trampoline;
+} glad_lazy_entry;
+
+/* sorted by name, indices match glad_lazy_resolved */
+static const glad_lazy_entry glad_lazy_table[] = {
+	{"glActiveTexture", (void*)glad_lazy_glActiveTexture},
+	{"glAttachShader", (void*)glad_lazy_glAttachShader},
+	{"glBeginConditionalRender", (void*)glad_lazy_glBeginConditionalRender},
+	{"glBeginQuery", (void*)glad_lazy_glBeginQuery},
+	{"glBeginTransformFeedback", (void*)glad_lazy_glBeginTransformFeedback},
+	{"glBindAttribLocation", (void*)glad_lazy_glBindAttribLocation},
+	{"glBindBuffer", (void*)glad_lazy_glBindBuffer},
+	{"glBindBufferBase", (void*)glad_lazy_glBindBufferBase},
+	{"glBindBufferRange", (void*)glad_lazy_glBindBufferRange},
+	{"glBindFragDataLocation", (void*)glad_lazy_glBindFragDataLocation},
+	{"glBindFragDataLocationIndexed", (void*)glad_lazy_glBindFragDataLocationIndexed},
+	{"glBindFramebuffer", (void*)glad_lazy_glBindFramebuffer},
+	{"glBindRenderbuffer", (void*)glad_lazy_glBindRenderbuffer},
+	{"glBindSampler", (void*)glad_lazy_glBindSampler},
+	{"glBindTexture", (void*)glad_lazy_glBindTexture},
+	{"glBindTextureUnit", (void*)glad_lazy_glBindTextureUnit},
+	{"glBindVertexArray", (void*)glad_lazy_glBindVertexArray},
+	{"glBlendColor", (void*)glad_lazy_glBlendColor},
+	{"glBlendEquation", (void*)glad_lazy_glBlendEquation},
+	{"glBlendEquationSeparate", (void*)glad_lazy_glBlendEquationSeparate},
+	{"glBlendFunc", (void*)glad_lazy_glBlendFunc},
+	{"glBlendFuncSeparate", (void*)glad_lazy_glBlendFuncSeparate},
+	{"glBlitFramebuffer", (void*)glad_lazy_glBlitFramebuffer},
+	{"glBufferData", (void*)glad_lazy_glBufferData},
+	{"glBufferStorage", (void*)glad_lazy_glBufferStorage},
+	{"glBufferSubData", (void*)glad_lazy_glBufferSubData},
+	{"glCheckFramebufferStatus", (void*)glad_lazy_glCheckFramebufferStatus},
+	{"glClampColor", (void*)glad_lazy_glClampColor},
+	{"glClear", (void*)glad_lazy_glClear},
+	{"glClearBufferfi", (void*)glad_lazy_glClearBufferfi},
+	{"glClearBufferfv", (void*)glad_lazy_glClearBufferfv},
+	{"glClearBufferiv", (void*)glad_lazy_glClearBufferiv},
+	{"glClearBufferuiv", (void*)glad_lazy_glClearBufferuiv},
+	{"glClearColor", (void*)glad_lazy_glClearColor},
+	{"glClearDepth", (void*)glad_lazy_glClearDepth},
+	{"glClearStencil", (void*)glad_lazy_glClearStencil},
+	{"glClientWaitSync", (void*)glad_lazy_glClientWaitSync},
+	{"glColorMask", (void*)glad_lazy_glColorMask},
+	{"glColorMaski", (void*)glad_lazy_glColorMaski},
+	{"glColorP3ui", (void*)glad_lazy_glColorP3ui},
+	{"glColorP3uiv", (void*)glad_lazy_glColorP3uiv},
+	{"glColorP4ui", (void*)glad_lazy_glColorP4ui},
+	{"glColorP4uiv", (void*)glad_lazy_glColorP4uiv},
+	{"glCompileShader", (void*)glad_lazy_glCompileShader},
+	{"glCompressedTexImage1D", (void*)glad_lazy_glCompressedTexImage1D},
+	{"glCompressedTexImage2D", (void*)glad_lazy_glCompressedTexImage2D},
+	{"glCompressedTexImage3D", (void*)glad_lazy_glCompressedTexImage3D},
+	{"glCompressedTexSubImage1D", (void*)glad_lazy_glCompressedTexSubImage1D},
+	{"glCompressedTexSubImage2D", (void*)glad_lazy_glCompressedTexSubImage2D},
+	{"glCompressedTexSubImage3D", (void*)glad_lazy_glCompressedTexSubImage3D},
+	{"glCopyBufferSubData", (void*)glad_lazy_glCopyBufferSubData},
+	{"glCopyTexImage1D", (void*)glad_lazy_glCopyTexImage1D},
+	{"glCopyTexImage2D", (void*)glad_lazy_glCopyTexImage2D},
+	{"glCopyTexSubImage1D", (void*)glad_lazy_glCopyTexSubImage1D},
+	{"glCopyTexSubImage2D", (void*)glad_lazy_glCopyTexSubImage2D},
+	{"glCopyTexSubImage3D", (void*)glad_lazy_glCopyTexSubImage3D},
+	{"glCreateBuffers", (void*)glad_lazy_glCreateBuffers},
+	{"glCreateProgram", (void*)glad_lazy_glCreateProgram},
+	{"glCreateShader", (void*)glad_lazy_glCreateShader},
+	{"glCreateTextures", (void*)glad_lazy_glCreateTextures},
+	{"glCullFace", (void*)glad_lazy_glCullFace},
+	{"glDebugMessageCallbackARB", (void*)glad_lazy_glDebugMessageCallbackARB},
+	{"glDebugMessageControlARB", (void*)glad_lazy_glDebugMessageControlARB},
+	{"glDebugMessageInsertARB", (void*)glad_lazy_glDebugMessageInsertARB},
+	{"glDeleteBuffers", (void*)glad_lazy_glDeleteBuffers},
+	{"glDeleteFramebuffers", (void*)glad_lazy_glDeleteFramebuffers},
+	{"glDeleteProgram", (void*)glad_lazy_glDeleteProgram},
+	{"glDeleteQueries", (void*)glad_lazy_glDeleteQueries},
+	{"glDeleteRenderbuffers", (void*)glad_lazy_glDeleteRenderbuffers},
+	{"glDeleteSamplers", (void*)glad_lazy_glDeleteSamplers},
+	{"glDeleteShader", (void*)glad_lazy_glDeleteShader},
+	{"glDeleteSync", (void*)glad_lazy_glDeleteSync},
+	{"glDeleteTextures", (void*)glad_lazy_glDeleteTextures},
+	{"glDeleteVertexArrays", (void*)glad_lazy_glDeleteVertexArrays},
+	{"glDepthFunc", (void*)glad_lazy_glDepthFunc},
+	{"glDepthMask", (void*)glad_lazy_glDepthMask},
+	{"glDepthRange", (void*)glad_lazy_glDepthRange},
+	{"glDetachShader", (void*)glad_lazy_glDetachShader},
+	{"glDisable", (void*)glad_lazy_glDisable},
+	{"glDisableVertexAttribArray", (void*)glad_lazy_glDisableVertexAttribArray},
+	{"glDisablei", (void*)glad_lazy_glDisablei},
+	{"glDrawArrays", (void*)glad_lazy_glDrawArrays},
+	{"glDrawArraysIndirect", (void*)glad_lazy_glDrawArraysIndirect},
+	{"glDrawArraysInstanced", (void*)glad_lazy_glDrawArraysInstanced},
+	{"glDrawBuffer", (void*)glad_lazy_glDrawBuffer},
+	{"glDrawBuffers", (void*)glad_lazy_glDrawBuffers},
+	{"glDrawElements", (void*)glad_lazy_glDrawElements},
+	{"glDrawElementsBaseVertex", (void*)glad_lazy_glDrawElementsBaseVertex},
+	{"glDrawElementsIndirect", (void*)glad_lazy_glDrawElementsIndirect},
+	{"glDrawElementsInstanced", (void*)glad_lazy_glDrawElementsInstanced},
+	{"glDrawElementsInstancedBaseVertex", (void*)glad_lazy_glDrawElementsInstancedBaseVertex},
+	{"glDrawRangeElements", (void*)glad_lazy_glDrawRangeElements},
+	{"glDrawRangeElementsBaseVertex", (void*)glad_lazy_glDrawRangeElementsBaseVertex},
+	{"glEnable", (void*)glad_lazy_glEnable},
+	{"glEnableVertexAttribArray", (void*)glad_lazy_glEnableVertexAttribArray},
+	{"glEnablei", (void*)glad_lazy_glEnablei},
+	{"glEndConditionalRender", (void*)glad_lazy_glEndConditionalRender},
+	{"glEndQuery", (void*)glad_lazy_glEndQuery},
+	{"glEndTransformFeedback", (void*)glad_lazy_glEndTransformFeedback},
+	{"glFenceSync", (void*)glad_lazy_glFenceSync},
+	{"glFinish", (void*)glad_lazy_glFinish},
+	{"glFlush", (void*)glad_lazy_glFlush},
+	{"glFlushMappedBufferRange", (void*)glad_lazy_glFlushMappedBufferRange},
+	{"glFramebufferRenderbuffer", (void*)glad_lazy_glFramebufferRenderbuffer},
+	{"glFramebufferTexture", (void*)glad_lazy_glFramebufferTexture},
+	{"glFramebufferTexture1D", (void*)glad_lazy_glFramebufferTexture1D},
+	{"glFramebufferTexture2D", (void*)glad_lazy_glFramebufferTexture2D},
+	{"glFramebufferTexture3D", (void*)glad_lazy_glFramebufferTexture3D},
+	{"glFramebufferTextureLayer", (void*)glad_lazy_glFramebufferTextureLayer},
+	{"glFrontFace", (void*)glad_lazy_glFrontFace},
+	{"glGenBuffers", (void*)glad_lazy_glGenBuffers},
+	{"glGenFramebuffers", (void*)glad_lazy_glGenFramebuffers},
+	{"glGenQueries", (void*)glad_lazy_glGenQueries},
+	{"glGenRenderbuffers", (void*)glad_lazy_glGenRenderbuffers},
+	{"glGenSamplers", (void*)glad_lazy_glGenSamplers},
+	{"glGenTextures", (void*)glad_lazy_glGenTextures},
+	{"glGenVertexArrays", (void*)glad_lazy_glGenVertexArrays},
+	{"glGenerateMipmap", (void*)glad_lazy_glGenerateMipmap},
+	{"glGenerateTextureMipmap", (void*)glad_lazy_glGenerateTextureMipmap},
+	{"glGetActiveAttrib", (void*)glad_lazy_glGetActiveAttrib},
+	{"glGetActiveUniform", (void*)glad_lazy_glGetActiveUniform},
+	{"glGetActiveUniformBlockName", (void*)glad_lazy_glGetActiveUniformBlockName},
+	{"glGetActiveUniformBlockiv", (void*)glad_lazy_glGetActiveUniformBlockiv},
+	{"glGetActiveUniformName", (void*)glad_lazy_glGetActiveUniformName},
+	{"glGetActiveUniformsiv", (void*)glad_lazy_glGetActiveUniformsiv},
+	{"glGetAttachedShaders", (void*)glad_lazy_glGetAttachedShaders},
+	{"glGetAttribLocation", (void*)glad_lazy_glGetAttribLocation},
+	{"glGetBooleani_v", (void*)glad_lazy_glGetBooleani_v},
+	{"glGetBooleanv", (void*)glad_lazy_glGetBooleanv},
+	{"glGetBufferParameteri64v", (void*)glad_lazy_glGetBufferParameteri64v},
+	{"glGetBufferParameteriv", (void*)glad_lazy_glGetBufferParameteriv},
+	{"glGetBufferPointerv", (void*)glad_lazy_glGetBufferPointerv},
+	{"glGetBufferSubData", (void*)glad_lazy_glGetBufferSubData},
+	{"glGetCompressedTexImage", (void*)glad_lazy_glGetCompressedTexImage},
+	{"glGetDebugMessageLogARB", (void*)glad_lazy_glGetDebugMessageLogARB},
+	{"glGetDoublev", (void*)glad_lazy_glGetDoublev},
+	{"glGetError", (void*)glad_lazy_glGetError},
+	{"glGetFloatv", (void*)glad_lazy_glGetFloatv},
+	{"glGetFragDataIndex", (void*)glad_lazy_glGetFragDataIndex},
+	{"glGetFragDataLocation", (void*)glad_lazy_glGetFragDataLocation},
+	{"glGetFramebufferAttachmentParameteriv", (void*)glad_lazy_glGetFramebufferAttachmentParameteriv},
+	{"glGetInteger64i_v", (void*)glad_lazy_glGetInteger64i_v},
+	{"glGetInteger64v", (void*)glad_lazy_glGetInteger64v},
+	{"glGetIntegeri_v", (void*)glad_lazy_glGetIntegeri_v},
+	{"glGetIntegerv", (void*)glad_lazy_glGetIntegerv},
+	{"glGetMultisamplefv", (void*)glad_lazy_glGetMultisamplefv},
+	{"glGetProgramBinary", (void*)glad_lazy_glGetProgramBinary},
+	{"glGetProgramInfoLog", (void*)glad_lazy_glGetProgramInfoLog},
+	{"glGetProgramiv", (void*)glad_lazy_glGetProgramiv},
+	{"glGetQueryObjecti64v", (void*)glad_lazy_glGetQueryObjecti64v},
+	{"glGetQueryObjectiv", (void*)glad_lazy_glGetQueryObjectiv},
+	{"glGetQueryObjectui64v", (void*)glad_lazy_glGetQueryObjectui64v},
+	{"glGetQueryObjectuiv", (void*)glad_lazy_glGetQueryObjectuiv},
+	{"glGetQueryiv", (void*)glad_lazy_glGetQueryiv},
+	{"glGetRenderbufferParameteriv", (void*)glad_lazy_glGetRenderbufferParameteriv},
+	{"glGetSamplerParameterIiv", (void*)glad_lazy_glGetSamplerParameterIiv},
+	{"glGetSamplerParameterIuiv", (void*)glad_lazy_glGetSamplerParameterIuiv},
+	{"glGetSamplerParameterfv", (void*)glad_lazy_glGetSamplerParameterfv},
+	{"glGetSamplerParameteriv", (void*)glad_lazy_glGetSamplerParameteriv},
+	{"glGetShaderInfoLog", (void*)glad_lazy_glGetShaderInfoLog},
+	{"glGetShaderSource", (void*)glad_lazy_glGetShaderSource},
+	{"glGetShaderiv", (void*)glad_lazy_glGetShaderiv},
+	{"glGetString", (void*)glad_lazy_glGetString},
+	{"glGetStringi", (void*)glad_lazy_glGetStringi},
+	{"glGetSynciv", (void*)glad_lazy_glGetSynciv},
+	{"glGetTexImage", (void*)glad_lazy_glGetTexImage},
+	{"glGetTexLevelParameterfv", (void*)glad_lazy_glGetTexLevelParameterfv},
+	{"glGetTexLevelParameteriv", (void*)glad_lazy_glGetTexLevelParameteriv},
+	{"glGetTexParameterIiv", (void*)glad_lazy_glGetTexParameterIiv},
+	{"glGetTexParameterIuiv", (void*)glad_lazy_glGetTexParameterIuiv},
+	{"glGetTexParameterfv", (void*)glad_lazy_glGetTexParameterfv},
+	{"glGetTexParameteriv", (void*)glad_lazy_glGetTexParameteriv},
+	{"glGetTransformFeedbackVarying", (void*)glad_lazy_glGetTransformFeedbackVarying},
+	{"glGetUniformBlockIndex", (void*)glad_lazy_glGetUniformBlockIndex},
+	{"glGetUniformIndices", (void*)glad_lazy_glGetUniformIndices},
+	{"glGetUniformLocation", (void*)glad_lazy_glGetUniformLocation},
+	{"glGetUniformfv", (void*)glad_lazy_glGetUniformfv},
+	{"glGetUniformiv", (void*)glad_lazy_glGetUniformiv},
+	{"glGetUniformuiv", (void*)glad_lazy_glGetUniformuiv},
+	{"glGetVertexAttribIiv", (void*)glad_lazy_glGetVertexAttribIiv},
+	{"glGetVertexAttribIuiv", (void*)glad_lazy_glGetVertexAttribIuiv},
+	{"glGetVertexAttribPointerv", (void*)glad_lazy_glGetVertexAttribPointerv},
+	{"glGetVertexAttribdv", (void*)glad_lazy_glGetVertexAttribdv},
+	{"glGetVertexAttribfv", (void*)glad_lazy_glGetVertexAttribfv},
+	{"glGetVertexAttribiv", (void*)glad_lazy_glGetVertexAttribiv},
+	{"glHint", (void*)glad_lazy_glHint},
+	{"glInvalidateBufferData", (void*)glad_lazy_glInvalidateBufferData},
+	{"glInvalidateBufferSubData", (void*)glad_lazy_glInvalidateBufferSubData},
+	{"glInvalidateFramebuffer", (void*)glad_lazy_glInvalidateFramebuffer},
+	{"glInvalidateSubFramebuffer", (void*)glad_lazy_glInvalidateSubFramebuffer},
+	{"glInvalidateTexImage", (void*)glad_lazy_glInvalidateTexImage},
+	{"glInvalidateTexSubImage", (void*)glad_lazy_glInvalidateTexSubImage},
+	{"glIsBuffer", (void*)glad_lazy_glIsBuffer},
+	{"glIsEnabled", (void*)glad_lazy_glIsEnabled},
+	{"glIsEnabledi", (void*)glad_lazy_glIsEnabledi},
+	{"glIsFramebuffer", (void*)glad_lazy_glIsFramebuffer},
+	{"glIsProgram", (void*)glad_lazy_glIsProgram},
+	{"glIsQuery", (void*)glad_lazy_glIsQuery},
+	{"glIsRenderbuffer", (void*)glad_lazy_glIsRenderbuffer},
+	{"glIsSampler", (void*)glad_lazy_glIsSampler},
+	{"glIsShader", (void*)glad_lazy_glIsShader},
+	{"glIsSync", (void*)glad_lazy_glIsSync},
+	{"glIsTexture", (void*)glad_lazy_glIsTexture},
+	{"glIsVertexArray", (void*)glad_lazy_glIsVertexArray},
+	{"glLineWidth", (void*)glad_lazy_glLineWidth},
+	{"glLinkProgram", (void*)glad_lazy_glLinkProgram},
+	{"glLogicOp", (void*)glad_lazy_glLogicOp},
+	{"glMapBuffer", (void*)glad_lazy_glMapBuffer},
+	{"glMapBufferRange", (void*)glad_lazy_glMapBufferRange},
+	{"glMapNamedBufferRange", (void*)glad_lazy_glMapNamedBufferRange},
+	{"glMaxShaderCompilerThreadsARB", (void*)glad_lazy_glMaxShaderCompilerThreadsARB},
+	{"glMaxShaderCompilerThreadsKHR", (void*)glad_lazy_glMaxShaderCompilerThreadsKHR},
+	{"glMultiDrawArrays", (void*)glad_lazy_glMultiDrawArrays},
+	{"glMultiDrawArraysIndirect", (void*)glad_lazy_glMultiDrawArraysIndirect},
+	{"glMultiDrawElements", (void*)glad_lazy_glMultiDrawElements},
+	{"glMultiDrawElementsBaseVertex", (void*)glad_lazy_glMultiDrawElementsBaseVertex},
+	{"glMultiDrawElementsIndirect", (void*)glad_lazy_glMultiDrawElementsIndirect},
+	{"glMultiTexCoordP1ui", (void*)glad_lazy_glMultiTexCoordP1ui},
+	{"glMultiTexCoordP1uiv", (void*)glad_lazy_glMultiTexCoordP1uiv},
+	{"glMultiTexCoordP2ui", (void*)glad_lazy_glMultiTexCoordP2ui},
+	{"glMultiTexCoordP2uiv", (void*)glad_lazy_glMultiTexCoordP2uiv},
+	{"glMultiTexCoordP3ui", (void*)glad_lazy_glMultiTexCoordP3ui},
+	{"glMultiTexCoordP3uiv", (void*)glad_lazy_glMultiTexCoordP3uiv},
+	{"glMultiTexCoordP4ui", (void*)glad_lazy_glMultiTexCoordP4ui},
+	{"glMultiTexCoordP4uiv", (void*)glad_lazy_glMultiTexCoordP4uiv},
+	{"glNamedBufferStorage", (void*)glad_lazy_glNamedBufferStorage},
+	{"glNamedBufferSubData", (void*)glad_lazy_glNamedBufferSubData},
+	{"glNormalP3ui", (void*)glad_lazy_glNormalP3ui},
+	{"glNormalP3uiv", (void*)glad_lazy_glNormalP3uiv},
+	{"glPixelStoref", (void*)glad_lazy_glPixelStoref},
+	{"glPixelStorei", (void*)glad_lazy_glPixelStorei},
+	{"glPointParameterf", (void*)glad_lazy_glPointParameterf},
+	{"glPointParameterfv", (void*)glad_lazy_glPointParameterfv},
+	{"glPointParameteri", (void*)glad_lazy_glPointParameteri},
+	{"glPointParameteriv", (void*)glad_lazy_glPointParameteriv},
+	{"glPointSize", (void*)glad_lazy_glPointSize},
+	{"glPolygonMode", (void*)glad_lazy_glPolygonMode},
+	{"glPolygonOffset", (void*)glad_lazy_glPolygonOffset},
+	{"glPrimitiveRestartIndex", (void*)glad_lazy_glPrimitiveRestartIndex},
+	{"glProgramBinary", (void*)glad_lazy_glProgramBinary},
+	{"glProgramParameteri", (void*)glad_lazy_glProgramParameteri},
+	{"glProvokingVertex", (void*)glad_lazy_glProvokingVertex},
+	{"glQueryCounter", (void*)glad_lazy_glQueryCounter},
+	{"glReadBuffer", (void*)glad_lazy_glReadBuffer},
+	{"glReadPixels", (void*)glad_lazy_glReadPixels},
+	{"glRenderbufferStorage", (void*)glad_lazy_glRenderbufferStorage},
+	{"glRenderbufferStorageMultisample", (void*)glad_lazy_glRenderbufferStorageMultisample},
+	{"glSampleCoverage", (void*)glad_lazy_glSampleCoverage},
+	{"glSampleMaski", (void*)glad_lazy_glSampleMaski},
+	{"glSamplerParameterIiv", (void*)glad_lazy_glSamplerParameterIiv},
+	{"glSamplerParameterIuiv", (void*)glad_lazy_glSamplerParameterIuiv},
+	{"glSamplerParameterf", (void*)glad_lazy_glSamplerParameterf},
+	{"glSamplerParameterfv", (void*)glad_lazy_glSamplerParameterfv},
+	{"glSamplerParameteri", (void*)glad_lazy_glSamplerParameteri},
+	{"glSamplerParameteriv", (void*)glad_lazy_glSamplerParameteriv},
+	{"glScissor", (void*)glad_lazy_glScissor},
+	{"glSecondaryColorP3ui", (void*)glad_lazy_glSecondaryColorP3ui},
+	{"glSecondaryColorP3uiv", (void*)glad_lazy_glSecondaryColorP3uiv},
+	{"glShaderSource", (void*)glad_lazy_glShaderSource},
+	{"glStencilFunc", (void*)glad_lazy_glStencilFunc},
+	{"glStencilFuncSeparate", (void*)glad_lazy_glStencilFuncSeparate},
+	{"glStencilMask", (void*)glad_lazy_glStencilMask},
+	{"glStencilMaskSeparate", (void*)glad_lazy_glStencilMaskSeparate},
+	{"glStencilOp", (void*)glad_lazy_glStencilOp},
+	{"glStencilOpSeparate", (void*)glad_lazy_glStencilOpSeparate},
+	{"glTexBuffer", (void*)glad_lazy_glTexBuffer},
+	{"glTexCoordP1ui", (void*)glad_lazy_glTexCoordP1ui},
+	{"glTexCoordP1uiv", (void*)glad_lazy_glTexCoordP1uiv},
+	{"glTexCoordP2ui", (void*)glad_lazy_glTexCoordP2ui},
+	{"glTexCoordP2uiv", (void*)glad_lazy_glTexCoordP2uiv},
+	{"glTexCoordP3ui", (void*)glad_lazy_glTexCoordP3ui},
+	{"glTexCoordP3uiv", (void*)glad_lazy_glTexCoordP3uiv},
+	{"glTexCoordP4ui", (void*)glad_lazy_glTexCoordP4ui},
+	{"glTexCoordP4uiv", (void*)glad_lazy_glTexCoordP4uiv},
+	{"glTexImage1D", (void*)glad_lazy_glTexImage1D},
+	{"glTexImage2D", (void*)glad_lazy_glTexImage2D},
+	{"glTexImage2DMultisample", (void*)glad_lazy_glTexImage2DMultisample},
+	{"glTexImage3D", (void*)glad_lazy_glTexImage3D},
+	{"glTexImage3DMultisample", (void*)glad_lazy_glTexImage3DMultisample},
+	{"glTexParameterIiv", (void*)glad_lazy_glTexParameterIiv},
+	{"glTexParameterIuiv", (void*)glad_lazy_glTexParameterIuiv},
+	{"glTexParameterf", (void*)glad_lazy_glTexParameterf},
+	{"glTexParameterfv", (void*)glad_lazy_glTexParameterfv},
+	{"glTexParameteri", (void*)glad_lazy_glTexParameteri},
+	{"glTexParameteriv", (void*)glad_lazy_glTexParameteriv},
+	{"glTexStorage1D", (void*)glad_lazy_glTexStorage1D},
+	{"glTexStorage2D", (void*)glad_lazy_glTexStorage2D},
+	{"glTexStorage3D", (void*)glad_lazy_glTexStorage3D},
+	{"glTexSubImage1D", (void*)glad_lazy_glTexSubImage1D},
+	{"glTexSubImage2D", (void*)glad_lazy_glTexSubImage2D},
+	{"glTexSubImage3D", (void*)glad_lazy_glTexSubImage3D},
+	{"glTextureParameteri", (void*)glad_lazy_glTextureParameteri},
+	{"glTextureStorage2D", (void*)glad_lazy_glTextureStorage2D},
+	{"glTextureSubImage2D", (void*)glad_lazy_glTextureSubImage2D},
+	{"glTransformFeedbackVaryings", (void*)glad_lazy_glTransformFeedbackVaryings},
+	{"glUniform1f", (void*)glad_lazy_glUniform1f},
+	{"glUniform1fv", (void*)glad_lazy_glUniform1fv},
+	{"glUniform1i", (void*)glad_lazy_glUniform1i},
+	{"glUniform1iv", (void*)glad_lazy_glUniform1iv},
+	{"glUniform1ui", (void*)glad_lazy_glUniform1ui},
+	{"glUniform1uiv", (void*)glad_lazy_glUniform1uiv},
+	{"glUniform2f", (void*)glad_lazy_glUniform2f},
+	{"glUniform2fv", (void*)glad_lazy_glUniform2fv},
+	{"glUniform2i", (void*)glad_lazy_glUniform2i},
+	{"glUniform2iv", (void*)glad_lazy_glUniform2iv},
+	{"glUniform2ui", (void*)glad_lazy_glUniform2ui},
+	{"glUniform2uiv", (void*)glad_lazy_glUniform2uiv},
+	{"glUniform3f", (void*)glad_lazy_glUniform3f},
+	{"glUniform3fv", (void*)glad_lazy_glUniform3fv},
+	{"glUniform3i", (void*)glad_lazy_glUniform3i},
+	{"glUniform3iv", (void*)glad_lazy_glUniform3iv},
+	{"glUniform3ui", (void*)glad_lazy_glUniform3ui},
+	{"glUniform3uiv", (void*)glad_lazy_glUniform3uiv},
+	{"glUniform4f", (void*)glad_lazy_glUniform4f},
+	{"glUniform4fv", (void*)glad_lazy_glUniform4fv},
+	{"glUniform4i", (void*)glad_lazy_glUniform4i},
+	{"glUniform4iv", (void*)glad_lazy_glUniform4iv},
+	{"glUniform4ui", (void*)glad_lazy_glUniform4ui},
+	{"glUniform4uiv", (void*)glad_lazy_glUniform4uiv},
+	{"glUniformBlockBinding", (void*)glad_lazy_glUniformBlockBinding},
+	{"glUniformMatrix2fv", (void*)glad_lazy_glUniformMatrix2fv},
+	{"glUniformMatrix2x3fv", (void*)glad_lazy_glUniformMatrix2x3fv},
+	{"glUniformMatrix2x4fv", (void*)glad_lazy_glUniformMatrix2x4fv},
+	{"glUniformMatrix3fv", (void*)glad_lazy_glUniformMatrix3fv},
+	{"glUniformMatrix3x2fv", (void*)glad_lazy_glUniformMatrix3x2fv},
+	{"glUniformMatrix3x4fv", (void*)glad_lazy_glUniformMatrix3x4fv},
+	{"glUniformMatrix4fv", (void*)glad_lazy_glUniformMatrix4fv},
+	{"glUniformMatrix4x2fv", (void*)glad_lazy_glUniformMatrix4x2fv},
+	{"glUniformMatrix4x3fv", (void*)glad_lazy_glUniformMatrix4x3fv},
+	{"glUnmapBuffer", (void*)glad_lazy_glUnmapBuffer},
+	{"glUnmapNamedBuffer", (void*)glad_lazy_glUnmapNamedBuffer},
+	{"glUseProgram", (void*)glad_lazy_glUseProgram},
+	{"glValidateProgram", (void*)glad_lazy_glValidateProgram},
+	{"glVertexAttrib1d", (void*)glad_lazy_glVertexAttrib1d},
+	{"glVertexAttrib1dv", (void*)glad_lazy_glVertexAttrib1dv},
+	{"glVertexAttrib1f", (void*)glad_lazy_glVertexAttrib1f},
+	{"glVertexAttrib1fv", (void*)glad_lazy_glVertexAttrib1fv},
+	{"glVertexAttrib1s", (void*)glad_lazy_glVertexAttrib1s},
+	{"glVertexAttrib1sv", (void*)glad_lazy_glVertexAttrib1sv},
+	{"glVertexAttrib2d", (void*)glad_lazy_glVertexAttrib2d},
+	{"glVertexAttrib2dv", (void*)glad_lazy_glVertexAttrib2dv},
+	{"glVertexAttrib2f", (void*)glad_lazy_glVertexAttrib2f},
+	{"glVertexAttrib2fv", (void*)glad_lazy_glVertexAttrib2fv},
+	{"glVertexAttrib2s", (void*)glad_lazy_glVertexAttrib2s},
+	{"glVertexAttrib2sv", (void*)glad_lazy_glVertexAttrib2sv},
+	{"glVertexAttrib3d", (void*)glad_lazy_glVertexAttrib3d},
+	{"glVertexAttrib3dv", (void*)glad_lazy_glVertexAttrib3dv},
+	{"glVertexAttrib3f", (void*)glad_lazy_glVertexAttrib3f},
+	{"glVertexAttrib3fv", (void*)glad_lazy_glVertexAttrib3fv},
+	{"glVertexAttrib3s", (void*)glad_lazy_glVertexAttrib3s},
+	{"glVertexAttrib3sv", (void*)glad_lazy_glVertexAttrib3sv},
+	{"glVertexAttrib4Nbv", (void*)glad_lazy_glVertexAttrib4Nbv},
+	{"glVertexAttrib4Niv", (void*)glad_lazy_glVertexAttrib4Niv},
+	{"glVertexAttrib4Nsv", (void*)glad_lazy_glVertexAttrib4Nsv},
+	{"glVertexAttrib4Nub", (void*)glad_lazy_glVertexAttrib4Nub},
+	{"glVertexAttrib4Nubv", (void*)glad_lazy_glVertexAttrib4Nubv},
+	{"glVertexAttrib4Nuiv", (void*)glad_lazy_glVertexAttrib4Nuiv},
+	{"glVertexAttrib4Nusv", (void*)glad_lazy_glVertexAttrib4Nusv},
+	{"glVertexAttrib4bv", (void*)glad_lazy_glVertexAttrib4bv},
+	{"glVertexAttrib4d", (void*)glad_lazy_glVertexAttrib4d},
+	{"glVertexAttrib4dv", (void*)glad_lazy_glVertexAttrib4dv},
+	{"glVertexAttrib4f", (void*)glad_lazy_glVertexAttrib4f},
+	{"glVertexAttrib4fv", (void*)glad_lazy_glVertexAttrib4fv},
+	{"glVertexAttrib4iv", (void*)glad_lazy_glVertexAttrib4iv},
+	{"glVertexAttrib4s", (void*)glad_lazy_glVertexAttrib4s},
+	{"glVertexAttrib4sv", (void*)glad_lazy_glVertexAttrib4sv},
+	{"glVertexAttrib4ubv", (void*)glad_lazy_glVertexAttrib4ubv},
+	{"glVertexAttrib4uiv", (void*)glad_lazy_glVertexAttrib4uiv},
+	{"glVertexAttrib4usv", (void*)glad_lazy_glVertexAttrib4usv},
+	{"glVertexAttribDivisor", (void*)glad_lazy_glVertexAttribDivisor},
+	{"glVertexAttribI1i", (void*)glad_lazy_glVertexAttribI1i},
+	{"glVertexAttribI1iv", (void*)glad_lazy_glVertexAttribI1iv},
+	{"glVertexAttribI1ui", (void*)glad_lazy_glVertexAttribI1ui},
+	{"glVertexAttribI1uiv", (void*)glad_lazy_glVertexAttribI1uiv},
+	{"glVertexAttribI2i", (void*)glad_lazy_glVertexAttribI2i},
+	{"glVertexAttribI2iv", (void*)glad_lazy_glVertexAttribI2iv},
+	{"glVertexAttribI2ui", (void*)glad_lazy_glVertexAttribI2ui},
+	{"glVertexAttribI2uiv", (void*)glad_lazy_glVertexAttribI2uiv},
+	{"glVertexAttribI3i", (void*)glad_lazy_glVertexAttribI3i},
+	{"glVertexAttribI3iv", (void*)glad_lazy_glVertexAttribI3iv},
+	{"glVertexAttribI3ui", (void*)glad_lazy_glVertexAttribI3ui},
+	{"glVertexAttribI3uiv", (void*)glad_lazy_glVertexAttribI3uiv},
+	{"glVertexAttribI4bv", (void*)glad_lazy_glVertexAttribI4bv},
+	{"glVertexAttribI4i", (void*)glad_lazy_glVertexAttribI4i},
+	{"glVertexAttribI4iv", (void*)glad_lazy_glVertexAttribI4iv},
+	{"glVertexAttribI4sv", (void*)glad_lazy_glVertexAttribI4sv},
+	{"glVertexAttribI4ubv", (void*)glad_lazy_glVertexAttribI4ubv},
+	{"glVertexAttribI4ui", (void*)glad_lazy_glVertexAttribI4ui},
+	{"glVertexAttribI4uiv", (void*)glad_lazy_glVertexAttribI4uiv},
+	{"glVertexAttribI4usv", (void*)glad_lazy_glVertexAttribI4usv},
+	{"glVertexAttribIPointer", (void*)glad_lazy_glVertexAttribIPointer},
+	{"glVertexAttribP1ui", (void*)glad_lazy_glVertexAttribP1ui},
+	{"glVertexAttribP1uiv", (void*)glad_lazy_glVertexAttribP1uiv},
+	{"glVertexAttribP2ui", (void*)glad_lazy_glVertexAttribP2ui},
+	{"glVertexAttribP2uiv", (void*)glad_lazy_glVertexAttribP2uiv},
+	{"glVertexAttribP3ui", (void*)glad_lazy_glVertexAttribP3ui},
+	{"glVertexAttribP3uiv", (void*)glad_lazy_glVertexAttribP3uiv},
+	{"glVertexAttribP4ui", (void*)glad_lazy_glVertexAttribP4ui},
+	{"glVertexAttribP4uiv", (void*)glad_lazy_glVertexAttribP4uiv},
+	{"glVertexAttribPointer", (void*)glad_lazy_glVertexAttribPointer},
+	{"glVertexP2ui", (void*)glad_lazy_glVertexP2ui},
+	{"glVertexP2uiv", (void*)glad_lazy_glVertexP2uiv},
+	{"glVertexP3ui", (void*)glad_lazy_glVertexP3ui},
+	{"glVertexP3uiv", (void*)glad_lazy_glVertexP3uiv},
+	{"glVertexP4ui", (void*)glad_lazy_glVertexP4ui},
+	{"glVertexP4uiv", (void*)glad_lazy_glVertexP4uiv},
+	{"glViewport", (void*)glad_lazy_glViewport},
+	{"glWaitSync", (void*)glad_lazy_glWaitSync},
+};
+
+static void* glad_lazy_proc(const char *name) {
+    int low = 0, high = (int)(sizeof(glad_lazy_table) / sizeof(glad_lazy_table[0])) - 1;
+    while(low <= high) {
+        int middle = (low + high) / 2;
+        int order = strcmp(glad_lazy_table[middle].name, name);
+        if(order == 0) return glad_lazy_table[middle].trampoline;
+        if(order < 0) low = middle + 1;
+        else high = middle - 1;
+    }
+    return NULL;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_loader = load;
+	memset(glad_lazy_resolved, 0, sizeof(glad_lazy_resolved));
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	load_GL_VERSION_1_0(glad_lazy_proc);
+	load_GL_VERSION_1_1(glad_lazy_proc);
+	load_GL_VERSION_1_2(glad_lazy_proc);
+	load_GL_VERSION_1_3(glad_lazy_proc);
+	load_GL_VERSION_1_4(glad_lazy_proc);
+	load_GL_VERSION_1_5(glad_lazy_proc);
+	load_GL_VERSION_2_0(glad_lazy_proc);
+	load_GL_VERSION_2_1(glad_lazy_proc);
+	load_GL_VERSION_3_0(glad_lazy_proc);
+	load_GL_VERSION_3_1(glad_lazy_proc);
+	load_GL_VERSION_3_2(glad_lazy_proc);
+	load_GL_VERSION_3_3(glad_lazy_proc);
+
+	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(glad_lazy_proc);
+	load_GL_ARB_debug_output(glad_lazy_proc);
+	load_GL_ARB_direct_state_access(glad_lazy_proc);
+	load_GL_ARB_draw_indirect(glad_lazy_proc);
+	load_GL_ARB_get_program_binary(glad_lazy_proc);
+	load_GL_ARB_invalidate_subdata(glad_lazy_proc);
+	load_GL_ARB_multi_draw_indirect(glad_lazy_proc);
+	load_GL_ARB_parallel_shader_compile(glad_lazy_proc);
+	load_GL_ARB_texture_storage(glad_lazy_proc);
+	load_GL_ARB_timer_query(glad_lazy_proc);
+	load_GL_KHR_parallel_shader_compile(glad_lazy_proc);
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
@@ -0,0 +1,16 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in ivec2 aTexLayer; // (texture array, layer), per vertex or per instance
+
+out vec3 ourColor;
+out vec2 texCoord;
+flat out ivec2 texLayer;
+
+void main() {
+	gl_Position = vec4(aPos, 1.0);
+	ourColor = aColor;
+	texCoord = aTexCoord;
+	texLayer = aTexLayer;
+}
@@ -3,11 +3,15 @@ layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aColor;
 layout (location = 2) in vec2 aTexCoord;
 
+// quantized positions: aPos is in [-1, 1] across the mesh bounds
+uniform vec3 positionScale;
+uniform vec3 positionBias;
+
 out vec3 ourColor;
 out vec2 texCoord;
 
 void main() {
-	gl_Position = vec4(aPos, 1.0);
+	gl_Position = vec4(aPos * positionScale + positionBias, 1.0);
 	ourColor = aColor;
 	texCoord = aTexCoord;
 }
\ No newline at end of file